@@ -32,6 +32,7 @@
 #include "plotly_plotter/json_converter_decl.h"
 #include "plotly_plotter/json_value.h"
 #include "plotly_plotter/to_string.h"
+#include "plotly_plotter/tracing/tracer.h"
 #include "plotly_plotter/utils/calculate_histogram_bin_width.h"
 
 namespace plotly_plotter {
@@ -153,17 +154,24 @@ public:
  * \brief Class of columns in tables of data.
  *
  * \tparam T Type of the value.
+ * \tparam Storage Type of the storage of values. Columns own their values in
+ * std::vector by default. Non-owning views of values (e.g., Eigen::Map in
+ * eigen.h) can be used for columns without copying the values.
  *
  * \note Objects of this class should be created from \ref data_table objects.
  * \note Objects of this class doesn't manage the memory of the value,
  * so the objects can be simply copied or moved.
+ * \note Values in non-owning views must be valid while the column is used.
  */
-template <typename T>
+template <typename T, typename Storage = std::vector<T>>
 class data_column : public data_column_base {
 public:
     //! Type of values.
     using value_type = T;
 
+    //! Type of the storage of values.
+    using storage_type = Storage;
+
     /*!
      * \brief Constructor.
      */
@@ -174,7 +182,7 @@ public:
      *
      * \param[in] data Data.
      */
-    explicit data_column(std::vector<T> data) : data_(std::move(data)) {}
+    explicit data_column(Storage data) : data_(std::move(data)) {}
 
     /*!
      * \brief Constructor.
@@ -198,17 +206,17 @@ public:
     }
 
     //! \copydoc data_column_base::to_json
-    void to_json(json_value to) const override { to = as_array(data_); }
+    void to_json(json_value to) const override { to = data_; }
 
     //! \copydoc data_column_base::to_json_partial
     void to_json_partial(
         json_value to, const std::vector<bool>& mask) const override {
-        if (mask.size() != data_.size()) {
+        if (mask.size() != size()) {
             throw std::invalid_argument("Mask size does not match data size.");
         }
 
         to.set_to_array();
-        for (std::size_t i = 0; i < data_.size(); ++i) {
+        for (std::size_t i = 0; i < size(); ++i) {
             if (mask[i]) {
                 to.push_back(data_[i]);
             }
@@ -218,11 +226,12 @@ public:
     //! \copydoc data_column_base::generate_group
     [[nodiscard]] std::pair<std::vector<std::string>, std::vector<std::size_t>>
     generate_group() const override {
+        PLOTLY_PLOTTER_TRACE_SPAN("data_column::generate_group", "builder");
         std::unordered_map<value_type, std::size_t> group_to_index;
         std::vector<std::string> groups;
         std::vector<std::size_t> indices;
-        indices.reserve(data_.size());
-        for (std::size_t i = 0; i < data_.size(); ++i) {
+        indices.reserve(size());
+        for (std::size_t i = 0; i < size(); ++i) {
             const auto& value = data_[i];
             auto it = group_to_index.find(value);
             if (it == group_to_index.end()) {
@@ -236,7 +245,7 @@ public:
 
     //! \copydoc data_column_base::size
     [[nodiscard]] std::size_t size() const noexcept override {
-        return data_.size();
+        return static_cast<std::size_t>(data_.size());
     }
 
     //! \copydoc data_column_base::is_numeric
@@ -310,7 +319,7 @@ public:
                 "as_double_vector is not supported for this type.");
         } else {
             std::vector<double> result;
-            result.reserve(data_.size());
+            result.reserve(size());
             for (const auto& value : data_) {
                 result.push_back(static_cast<double>(value));
             }
@@ -327,7 +336,7 @@ public:
             throw std::runtime_error(
                 "as_masked_double_vector is not supported for this type.");
         } else {
-            if (mask.size() != data_.size()) {
+            if (mask.size() != size()) {
                 throw std::invalid_argument(
                     "Mask size does not match data size.");
             }
@@ -344,9 +353,34 @@ public:
 
 private:
     //! Data.
-    std::vector<value_type> data_;
+    Storage data_;
 };
 
+namespace details {
+
+/*!
+ * \brief Check whether a type is a non-owning view of values usable as the
+ * storage of \ref data_column objects.
+ *
+ * \tparam T Type.
+ *
+ * \note Specializations are defined in headers for external libraries
+ * (e.g., eigen.h).
+ */
+template <typename T, typename = void>
+struct is_column_view : std::false_type {};
+
+/*!
+ * \brief Check whether a type is a non-owning view of values usable as the
+ * storage of \ref data_column objects.
+ *
+ * \tparam T Type.
+ */
+template <typename T>
+constexpr bool is_column_view_v = is_column_view<T>::value;
+
+}  // namespace details
+
 /*!
  * \brief Specialization of json_converter class for data_column_base.
  */
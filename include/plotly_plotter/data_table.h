@@ -87,7 +87,8 @@ public:
     template <typename Container,
         typename = std::enable_if_t<details::has_iterator_v<Container> &&
             !std::is_same_v<std::decay_t<Container>,
-                std::vector<typename Container::value_type>>>>
+                std::vector<typename Container::value_type>> &&
+            !details::is_column_view_v<std::decay_t<Container>>>>
     std::shared_ptr<data_column<typename Container::value_type>> emplace(
         std::string name, Container&& values) {  // NOLINT(*-std-forward)
         std::vector<typename Container::value_type> vec(
@@ -95,6 +96,28 @@ public:
         return emplace(std::move(name), std::move(vec));
     }
 
+    /*!
+     * \brief Append a column referring to values without copying them.
+     *
+     * \tparam View Type of the non-owning view of values (e.g., Eigen::Map of
+     * vectors in eigen.h).
+     * \param[in] name Name of the column.
+     * \param[in] values View of values in the column.
+     * \return Column.
+     *
+     * \note Values must be valid while the column is used.
+     */
+    template <typename View,
+        typename = std::enable_if_t<details::is_column_view_v<View>>>
+    std::shared_ptr<data_column<typename View::value_type, View>> emplace(
+        std::string name, const View& values) {
+        auto column =
+            std::make_shared<data_column<typename View::value_type, View>>(
+                values);
+        data_.try_emplace(std::move(name), column);
+        return column;
+    }
+
     /*!
      * \brief Get a column.
      *
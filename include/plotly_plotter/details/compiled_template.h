@@ -0,0 +1,155 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of compiled_template class.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+namespace plotly_plotter::details {
+
+/*!
+ * \brief Class of templates split into static segments and placeholders.
+ *
+ * Placeholders are written as `{{ name }}`.
+ * Templates are parsed only once in the constructor,
+ * and placeholders are identified by indices in the list of names given to
+ * the constructor.
+ *
+ * \note Source strings of templates must outlive objects of this class.
+ */
+class compiled_template {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] source Source string of the template.
+     * \param[in] placeholder_names Names of placeholders.
+     */
+    compiled_template(std::string_view source,
+        std::initializer_list<std::string_view> placeholder_names)
+        : num_placeholders_(placeholder_names.size()) {
+        constexpr std::string_view placeholder_begin = "{{ ";
+        constexpr std::string_view placeholder_end = " }}";
+
+        std::string_view remaining = source;
+        while (!remaining.empty()) {
+            const std::size_t next_placeholder =
+                remaining.find(placeholder_begin);
+            if (next_placeholder == std::string_view::npos) {
+                segments_.push_back(segment{remaining, literal_segment});
+                break;
+            }
+            if (next_placeholder > 0) {
+                segments_.push_back(segment{
+                    remaining.substr(0, next_placeholder), literal_segment});
+            }
+            remaining =
+                remaining.substr(next_placeholder + placeholder_begin.size());
+
+            const std::size_t name_end = remaining.find(placeholder_end);
+            if (name_end == std::string_view::npos) {
+                throw std::runtime_error(
+                    "Invalid placeholder in the template.");
+            }
+            const std::string_view name = remaining.substr(0, name_end);
+            const auto* name_iter = std::find(
+                placeholder_names.begin(), placeholder_names.end(), name);
+            if (name_iter == placeholder_names.end()) {
+                throw std::runtime_error(
+                    "Invalid placeholder in the template.");
+            }
+            segments_.push_back(segment{std::string_view(),
+                static_cast<std::size_t>(
+                    name_iter - placeholder_names.begin())});
+            remaining = remaining.substr(name_end + placeholder_end.size());
+        }
+    }
+
+    /*!
+     * \brief Get the number of placeholder names.
+     *
+     * \return Number of placeholder names.
+     */
+    [[nodiscard]] std::size_t num_placeholders() const noexcept {
+        return num_placeholders_;
+    }
+
+    /*!
+     * \brief Append strings filling placeholders to a list.
+     *
+     * \param[out] parts List of strings.
+     * \param[in] values Values of placeholders in the order of names given to
+     * the constructor. (Values must outlive the list.)
+     */
+    void append_to(std::vector<std::string_view>& parts,
+        const std::string_view* values) const {
+        append_to(parts, [values](std::vector<std::string_view>& target,
+                             std::size_t placeholder_index) {
+            target.push_back(values[placeholder_index]);
+        });
+    }
+
+    /*!
+     * \brief Append strings filling placeholders to a list.
+     *
+     * \tparam PlaceholderAppender Type of the function to append strings of
+     * placeholders.
+     * \param[out] parts List of strings.
+     * \param[in] append_placeholder Function to append strings of a
+     * placeholder. This function receives the list and the index of the
+     * placeholder in the names given to the constructor.
+     */
+    template <typename PlaceholderAppender>
+    void append_to(std::vector<std::string_view>& parts,
+        PlaceholderAppender&& append_placeholder) const {
+        for (const auto& current : segments_) {
+            if (current.placeholder_index == literal_segment) {
+                parts.push_back(current.text);
+            } else {
+                append_placeholder(parts, current.placeholder_index);
+            }
+        }
+    }
+
+private:
+    //! Index used for literal segments.
+    static constexpr std::size_t literal_segment = static_cast<std::size_t>(-1);
+
+    //! Struct of segments.
+    struct segment {
+        //! Text. (Used for literal segments.)
+        std::string_view text;
+
+        //! Index of the placeholder, or literal_segment.
+        std::size_t placeholder_index;
+    };
+
+    //! Segments.
+    std::vector<segment> segments_;
+
+    //! Number of placeholder names.
+    std::size_t num_placeholders_;
+};
+
+}  // namespace plotly_plotter::details
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of compress_uniform_coordinates function.
+ */
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include "plotly_plotter/details/plotly_plotter_export.h"
+#include "plotly_plotter/json_document.h"
+
+namespace plotly_plotter::details {
+
+/*!
+ * \brief Default minimum number of elements of coordinates to compress.
+ */
+static constexpr std::size_t default_min_uniform_coordinates_size = 16;
+
+/*!
+ * \brief Struct of uniform spacing of coordinates.
+ */
+struct uniform_spacing {
+    //! First coordinate.
+    double start;
+
+    //! Difference between consecutive coordinates.
+    double step;
+};
+
+/*!
+ * \brief Detect uniform spacing of coordinates.
+ *
+ * \param[in] values Coordinates.
+ * \param[in] size Number of coordinates.
+ * \return Spacing, or null if the coordinates are not an arithmetic sequence
+ * with a non-zero step within rounding errors.
+ */
+[[nodiscard]] PLOTLY_PLOTTER_EXPORT std::optional<uniform_spacing>
+detect_uniform_spacing(const double* values, std::size_t size) noexcept;
+
+/*!
+ * \brief Replace uniformly spaced coordinates in traces with the first
+ * coordinates and steps.
+ *
+ * Arrays `x` and `y` of scatter, scattergl, bar, and heatmap traces are
+ * replaced with `x0` and `dx`, and `y0` and `dy` respectively.
+ * Coordinates of edges of cells in heatmaps are converted to coordinates of
+ * centers.
+ * A trace in animation frames is compressed only when coordinates in all
+ * the frames can be compressed, because coordinates in frames overwrite
+ * those in the figure.
+ *
+ * \param[in,out] document Document of a figure.
+ * \param[in] min_size Minimum number of elements of coordinates to compress.
+ * \return Number of arrays removed.
+ */
+PLOTLY_PLOTTER_EXPORT std::size_t compress_uniform_coordinates(
+    json_document& document,
+    std::size_t min_size = default_min_uniform_coordinates_size);
+
+}  // namespace plotly_plotter::details
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of encode_base64 function.
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace plotly_plotter::details {
+
+/*!
+ * \brief Encode bytes in Base64.
+ *
+ * \param[in] input Input bytes.
+ * \return Encoded string.
+ */
+[[nodiscard]] inline std::string encode_base64(std::string_view input) {
+    constexpr std::string_view table =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    constexpr std::size_t bytes_per_group = 3;
+    constexpr std::size_t chars_per_group = 4;
+    constexpr unsigned int mask = 0x3FU;
+
+    const std::size_t num_groups =
+        (input.size() + bytes_per_group - 1) / bytes_per_group;
+    std::string output(num_groups * chars_per_group, '=');
+    std::size_t out = 0;
+    std::size_t in = 0;
+    for (; in + bytes_per_group <= input.size(); in += bytes_per_group) {
+        const unsigned int group =
+            (static_cast<unsigned char>(input[in]) << 16U) |
+            (static_cast<unsigned char>(input[in + 1]) << 8U) |
+            static_cast<unsigned char>(input[in + 2]);
+        output[out++] = table[(group >> 18U) & mask];
+        output[out++] = table[(group >> 12U) & mask];
+        output[out++] = table[(group >> 6U) & mask];
+        output[out++] = table[group & mask];
+    }
+    const std::size_t remaining = input.size() - in;
+    if (remaining > 0) {
+        unsigned int group = static_cast<unsigned char>(input[in]) << 16U;
+        if (remaining > 1) {
+            group |= static_cast<unsigned char>(input[in + 1]) << 8U;
+        }
+        output[out++] = table[(group >> 18U) & mask];
+        output[out++] = table[(group >> 12U) & mask];
+        if (remaining > 1) {
+            output[out] = table[(group >> 6U) & mask];
+        }
+    }
+    return output;
+}
+
+}  // namespace plotly_plotter::details
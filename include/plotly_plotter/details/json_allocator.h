@@ -0,0 +1,109 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of json_allocator class.
+ */
+#pragma once
+
+#include <cstddef>
+
+#include <yyjson.h>
+
+#include "plotly_plotter/details/plotly_plotter_export.h"
+
+namespace plotly_plotter::details {
+
+/*!
+ * \brief Class of allocators of yyjson counting allocated bytes.
+ *
+ * \note yyjson releases memory of mutable documents only when the documents
+ * are freed, so the number of allocated bytes is the size of memory used by
+ * a document.
+ * \note Objects of this class must not be moved while documents use them,
+ * because the allocators refer to the objects.
+ */
+class PLOTLY_PLOTTER_EXPORT json_allocator {
+public:
+    /*!
+     * \brief Constructor.
+     */
+    json_allocator() noexcept;
+
+    json_allocator(const json_allocator&) = delete;
+    json_allocator(json_allocator&&) = delete;
+    json_allocator& operator=(const json_allocator&) = delete;
+    json_allocator& operator=(json_allocator&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~json_allocator() = default;
+
+    /*!
+     * \brief Get the allocator of yyjson.
+     *
+     * \return Allocator.
+     */
+    [[nodiscard]] const yyjson_alc* get() const noexcept { return &allocator_; }
+
+    /*!
+     * \brief Get the number of allocated bytes.
+     *
+     * \return Number of allocated bytes.
+     */
+    [[nodiscard]] std::size_t allocated_bytes() const noexcept {
+        return allocated_bytes_;
+    }
+
+private:
+    /*!
+     * \brief Allocate memory.
+     *
+     * \param[in] context Pointer to the json_allocator object.
+     * \param[in] size Size.
+     * \return Allocated memory. (Null on failure.)
+     */
+    static void* allocate(void* context, std::size_t size) noexcept;
+
+    /*!
+     * \brief Reallocate memory.
+     *
+     * \param[in] context Pointer to the json_allocator object.
+     * \param[in] pointer Memory to reallocate.
+     * \param[in] old_size Old size.
+     * \param[in] size New size.
+     * \return Reallocated memory. (Null on failure.)
+     */
+    static void* reallocate(void* context, void* pointer, std::size_t old_size,
+        std::size_t size) noexcept;
+
+    /*!
+     * \brief Deallocate memory.
+     *
+     * \param[in] context Pointer to the json_allocator object.
+     * \param[in] pointer Memory to deallocate.
+     */
+    static void deallocate(void* context, void* pointer) noexcept;
+
+    //! Allocator of yyjson.
+    yyjson_alc allocator_;
+
+    //! Number of allocated bytes.
+    std::size_t allocated_bytes_{0};
+};
+
+}  // namespace plotly_plotter::details
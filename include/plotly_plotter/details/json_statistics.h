@@ -0,0 +1,56 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Declaration of functions to compute statistics of JSON values.
+ */
+#pragma once
+
+#include <cstdint>
+
+#include <yyjson.h>
+
+#include "plotly_plotter/details/plotly_plotter_export.h"
+
+namespace plotly_plotter {
+
+struct json_statistics;
+
+namespace details {
+
+/*!
+ * \brief Accumulate statistics of JSON values in a tree.
+ *
+ * \param[in] value Root of the tree.
+ * \param[in,out] statistics Statistics.
+ *
+ * \note This function doesn't set json_statistics::allocated_bytes,
+ * because it is a property of documents.
+ */
+PLOTLY_PLOTTER_EXPORT void accumulate_json_statistics(
+    yyjson_mut_val* value, json_statistics& statistics);
+
+/*!
+ * \brief Count JSON values in a tree.
+ *
+ * \param[in] value Root of the tree.
+ * \return Number of values including the root. (Keys are not counted.)
+ */
+[[nodiscard]] PLOTLY_PLOTTER_EXPORT std::uint64_t count_json_nodes(
+    yyjson_mut_val* value);
+
+}  // namespace details
+}  // namespace plotly_plotter
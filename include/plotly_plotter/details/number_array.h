@@ -0,0 +1,141 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions to create JSON arrays of numbers at once.
+ */
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <yyjson.h>
+
+#include "plotly_plotter/json_value.h"
+
+namespace plotly_plotter::details {
+
+/*!
+ * \brief Check whether a type is converted to JSON numbers.
+ *
+ * \tparam T Type.
+ */
+template <typename T>
+constexpr bool is_json_number_v =
+    std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+/*!
+ * \brief Create a JSON array of numbers at once.
+ *
+ * \tparam T Type of values.
+ * \param[in] document Document.
+ * \param[in] values Pointer to the values.
+ * \param[in] size Number of values.
+ * \return Created array.
+ *
+ * \note Nodes of the elements are allocated in a contiguous block.
+ * \note Non-finite floating-point values are converted to null values
+ * as in json_converter class.
+ */
+template <typename T>
+[[nodiscard]] yyjson_mut_val* create_number_array(
+    yyjson_mut_doc* document, const T* values, std::size_t size) {
+    static_assert(is_json_number_v<T>, "Values must be numbers.");
+
+    yyjson_mut_val* array = nullptr;
+    if constexpr (std::is_floating_point_v<T>) {
+        bool has_non_finite = false;
+        for (std::size_t i = 0; i < size; ++i) {
+            if (!std::isfinite(values[i])) {
+                has_non_finite = true;
+                break;
+            }
+        }
+        if constexpr (std::is_same_v<T, double>) {
+            array = yyjson_mut_arr_with_real(document, values, size);
+        } else {
+            const std::vector<double> buffer(values, values + size);
+            array = yyjson_mut_arr_with_real(document, buffer.data(), size);
+        }
+        if (array != nullptr && has_non_finite) {
+            yyjson_mut_arr_iter iter;
+            yyjson_mut_arr_iter_init(array, &iter);
+            for (std::size_t i = 0; i < size; ++i) {
+                yyjson_mut_val* element = yyjson_mut_arr_iter_next(&iter);
+                if (!std::isfinite(values[i])) {
+                    yyjson_mut_set_null(element);
+                }
+            }
+        }
+    } else if constexpr (std::is_signed_v<T>) {
+        if constexpr (std::is_same_v<T, std::int64_t>) {
+            array = yyjson_mut_arr_with_sint64(document, values, size);
+        } else {
+            const std::vector<std::int64_t> buffer(values, values + size);
+            array = yyjson_mut_arr_with_sint64(document, buffer.data(), size);
+        }
+    } else {
+        if constexpr (std::is_same_v<T, std::uint64_t>) {
+            array = yyjson_mut_arr_with_uint64(document, values, size);
+        } else {
+            const std::vector<std::uint64_t> buffer(values, values + size);
+            array = yyjson_mut_arr_with_uint64(document, buffer.data(), size);
+        }
+    }
+    if (array == nullptr) {
+        throw std::runtime_error("Failed to create a JSON array.");
+    }
+    return array;
+}
+
+/*!
+ * \brief Assign a JSON array of numbers at once.
+ *
+ * \tparam T Type of values.
+ * \param[in] values Pointer to the values.
+ * \param[in] size Number of values.
+ * \param[out] to JSON value to assign to.
+ */
+template <typename T>
+void assign_number_array(const T* values, std::size_t size, json_value& to) {
+    yyjson_mut_val* array =
+        create_number_array(to.internal_document(), values, size);
+    // Elements of arrays in yyjson refer to each other but not to the
+    // array itself, so the header of the created array can be copied.
+    yyjson_mut_val* target = to.internal_value();
+    target->tag = array->tag;
+    target->uni = array->uni;
+}
+
+/*!
+ * \brief Append a JSON array of numbers to an array.
+ *
+ * \tparam T Type of values.
+ * \param[in] values Pointer to the values.
+ * \param[in] size Number of values.
+ * \param[out] to JSON array to append to.
+ */
+template <typename T>
+void append_number_array(const T* values, std::size_t size, json_value& to) {
+    yyjson_mut_arr_append(to.internal_value(),
+        create_number_array(to.internal_document(), values, size));
+}
+
+}  // namespace plotly_plotter::details
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of parsed_json class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include <yyjson.h>
+
+#include "plotly_plotter/details/plotly_plotter_export.h"
+
+namespace plotly_plotter::details {
+
+/*!
+ * \brief Class of immutable JSON documents parsed from files.
+ *
+ * Files are mapped to memory when possible, and parsed in place
+ * so that strings in the documents refer to the mapped memory
+ * without copies.
+ */
+class PLOTLY_PLOTTER_EXPORT parsed_json {
+public:
+    /*!
+     * \brief Parse a JSON file.
+     *
+     * \param[in] file_path File path.
+     * \return Parsed document.
+     */
+    [[nodiscard]] static std::shared_ptr<const parsed_json> parse_file(
+        const std::string& file_path);
+
+    /*!
+     * \brief Get the document.
+     *
+     * \return Document.
+     */
+    [[nodiscard]] yyjson_doc* document() const noexcept { return document_; }
+
+    /*!
+     * \brief Check whether the file is mapped to memory.
+     *
+     * \return Whether the file is mapped to memory.
+     */
+    [[nodiscard]] bool is_memory_mapped() const noexcept {
+        return is_memory_mapped_;
+    }
+
+    parsed_json(const parsed_json&) = delete;
+    parsed_json(parsed_json&&) = delete;
+    parsed_json& operator=(const parsed_json&) = delete;
+    parsed_json& operator=(parsed_json&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~parsed_json();
+
+private:
+    /*!
+     * \brief Constructor.
+     */
+    parsed_json() = default;
+
+    /*!
+     * \brief Load a file to the buffer.
+     *
+     * \param[in] file_path File path.
+     */
+    void load(const std::string& file_path);
+
+    //! Buffer of the file.
+    char* buffer_{nullptr};
+
+    //! Size of the mapped memory or the allocated buffer.
+    std::size_t buffer_size_{0};
+
+    //! Size of the file.
+    std::size_t file_size_{0};
+
+    //! Whether the buffer is mapped to memory.
+    bool is_memory_mapped_{false};
+
+    //! Document.
+    yyjson_doc* document_{nullptr};
+};
+
+}  // namespace plotly_plotter::details
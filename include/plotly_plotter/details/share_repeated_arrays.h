@@ -0,0 +1,61 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of share_repeated_arrays function.
+ */
+#pragma once
+
+#include <cstddef>
+
+#include "plotly_plotter/details/plotly_plotter_export.h"
+#include "plotly_plotter/json_document.h"
+
+namespace plotly_plotter::details {
+
+/*!
+ * \brief Key of the table of shared arrays in the root object.
+ */
+static constexpr const char* shared_arrays_key = "shared_arrays";
+
+/*!
+ * \brief Key of references to shared arrays.
+ */
+static constexpr const char* shared_array_reference_key = "$shared_array";
+
+/*!
+ * \brief Default minimum number of elements of arrays to share.
+ */
+static constexpr std::size_t default_min_shared_array_size = 16;
+
+/*!
+ * \brief Store arrays repeated in a document once in a table.
+ *
+ * Arrays of numbers, strings, booleans, and null values which appear more
+ * than once in the document are added to an array in the root object with
+ * key \ref shared_arrays_key, and the occurrences are replaced with objects
+ * like `{"$shared_array": index}`.
+ * HTML templates restore the arrays before plotting.
+ *
+ * \param[in,out] document Document. (The root must be an object.)
+ * \param[in] min_size Minimum number of elements of arrays to share.
+ * \return Number of arrays replaced with references.
+ */
+PLOTLY_PLOTTER_EXPORT std::size_t share_repeated_arrays(
+    json_document& document,
+    std::size_t min_size = default_min_shared_array_size);
+
+}  // namespace plotly_plotter::details
@@ -0,0 +1,36 @@
+/*
+ * Copyright 2025 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of plotly_page_figure variable.
+ *
+ * This file is generated from scripts/templates/plotly_page_figure.html.jinja.
+ * Change this file only via scripts/generate_template_headers.py script.
+ */
+#pragma once
+
+#include <string_view>
+
+namespace plotly_plotter::details::templates {
+
+/*!
+ * \brief HTML template for each plot in pages with multiple plots.
+ */
+static constexpr std::string_view plotly_page_figure = R"(        <div id="plot{{ index }}" class="container" data-dataset-id="dataset{{ index }}" data-template-index="{{ template_index }}"></div>
+        <div id="dataset{{ index }}" style="display:none">{{ escaped_data }}</div>
+)";
+
+}  // namespace plotly_plotter::details::templates
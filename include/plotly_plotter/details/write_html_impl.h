@@ -21,8 +21,11 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <string>
+#include <string_view>
 
 #include "plotly_plotter/details/plotly_plotter_export.h"
+#include "plotly_plotter/io/output_sink.h"
 #include "plotly_plotter/json_document.h"
 
 namespace plotly_plotter::details {
@@ -41,6 +44,29 @@ enum class html_template_type : std::uint8_t {
     png = 3
 };
 
+/*!
+ * \brief Struct of data of figures prepared for HTML.
+ */
+struct html_figure_data {
+    //! Data of the figure in JSON escaped for HTML.
+    std::string_view escaped_data;
+
+    //! Whether the figure has frames of animation.
+    bool has_frames;
+
+    //! Whether the figure has arrays shared in the figure.
+    bool has_shared_arrays;
+};
+
+/*!
+ * \brief Serialize data of a figure and escape it for HTML.
+ *
+ * \param[in] data Data.
+ * \return Escaped data.
+ */
+[[nodiscard]] PLOTLY_PLOTTER_EXPORT std::string serialize_for_html(
+    const json_document& data);
+
 /*!
  * \brief Write a figure to an HTML file.
  *
@@ -55,4 +81,106 @@ PLOTLY_PLOTTER_EXPORT void write_html_impl(const char* file_path,
     const char* html_title, const json_document& data,
     html_template_type template_type, std::size_t width, std::size_t height);
 
+/*!
+ * \brief Write a figure in HTML to a sink.
+ *
+ * \param[in] sink Sink.
+ * \param[in] html_title Title of the HTML file.
+ * \param[in] data Data.
+ * \param[in] template_type Template type.
+ * \param[in] width Width of the plot. (Used for PDF output.)
+ * \param[in] height Height of the plot. (Used for PDF output.)
+ */
+PLOTLY_PLOTTER_EXPORT void write_html_impl(io::output_sink& sink,
+    const char* html_title, const json_document& data,
+    html_template_type template_type, std::size_t width, std::size_t height);
+
+/*!
+ * \brief Write a figure to an HTML file.
+ *
+ * \param[in] file_path File path.
+ * \param[in] html_title Title of the HTML file.
+ * \param[in] data Data prepared for HTML.
+ * \param[in] template_type Template type.
+ * \param[in] width Width of the plot. (Used for PDF output.)
+ * \param[in] height Height of the plot. (Used for PDF output.)
+ */
+PLOTLY_PLOTTER_EXPORT void write_html_impl(const char* file_path,
+    const char* html_title, const html_figure_data& data,
+    html_template_type template_type, std::size_t width, std::size_t height);
+
+/*!
+ * \brief Write a figure in HTML to a sink.
+ *
+ * \param[in] sink Sink.
+ * \param[in] html_title Title of the HTML file.
+ * \param[in] data Data prepared for HTML.
+ * \param[in] template_type Template type.
+ * \param[in] width Width of the plot. (Used for PDF output.)
+ * \param[in] height Height of the plot. (Used for PDF output.)
+ */
+PLOTLY_PLOTTER_EXPORT void write_html_impl(io::output_sink& sink,
+    const char* html_title, const html_figure_data& data,
+    html_template_type template_type, std::size_t width, std::size_t height);
+
+/*!
+ * \brief Class to write figures with frames of animation in HTML writing
+ * frames one by one.
+ *
+ * Frames are written as soon as they are given, so frames can be released
+ * before creating the next frames.
+ * Because configurations of figures depend on all frames,
+ * frames are written before other data of the figure in the JSON object.
+ */
+class PLOTLY_PLOTTER_EXPORT html_frame_stream_writer {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] sink Sink.
+     * \param[in] html_title Title of the HTML file.
+     *
+     * \note This writes the template before the data of the figure.
+     */
+    html_frame_stream_writer(io::output_sink& sink, const char* html_title);
+
+    /*!
+     * \brief Write a frame.
+     *
+     * \param[in] frame Data of the frame.
+     */
+    void write_frame(const json_document& frame);
+
+    /*!
+     * \brief Write the remaining data of the figure and the template.
+     *
+     * \param[in] data Data of the figure without frames.
+     *
+     * \note The template after the data is selected here, because arrays
+     * are shared only in the data without frames.
+     */
+    void finish(const json_document& data);
+
+    html_frame_stream_writer(const html_frame_stream_writer&) = delete;
+    html_frame_stream_writer(html_frame_stream_writer&&) = delete;
+    html_frame_stream_writer& operator=(
+        const html_frame_stream_writer&) = delete;
+    html_frame_stream_writer& operator=(html_frame_stream_writer&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~html_frame_stream_writer() = default;
+
+private:
+    //! Sink.
+    io::output_sink& sink_;
+
+    //! Title escaped for HTML.
+    std::string escaped_title_;
+
+    //! Whether a frame has been written.
+    bool has_written_frame_{false};
+};
+
 }  // namespace plotly_plotter::details
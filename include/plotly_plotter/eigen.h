@@ -23,30 +23,273 @@
 #error "Eigen library is not found. Please install Eigen library."
 #endif
 
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
 #include <Eigen/Core>
 
 #include <yyjson.h>
 
+#include "plotly_plotter/data_column.h"
+#include "plotly_plotter/details/number_array.h"
 #include "plotly_plotter/json_converter.h"
 #include "plotly_plotter/json_converter_decl.h"
 #include "plotly_plotter/json_value.h"
+#include "plotly_plotter/matrix_view.h"
+#include "plotly_plotter/typed_array.h"
 
 namespace plotly_plotter {
 
+namespace details {
+
+/*!
+ * \brief Check whether a type in Eigen library gives direct access to the
+ * buffer of values.
+ *
+ * \tparam Derived Type of the matrix or the expression.
+ */
+template <typename Derived>
+constexpr bool has_eigen_direct_access_v =
+    (static_cast<unsigned int>(Derived::Flags) &
+        static_cast<unsigned int>(Eigen::DirectAccessBit)) != 0U;
+
+/*!
+ * \brief Check whether a type is a product in Eigen library.
+ *
+ * \tparam T Type.
+ */
+template <typename T>
+struct is_eigen_product : std::false_type {};
+
+/*!
+ * \brief Check whether a type is a product in Eigen library.
+ *
+ * \tparam Lhs Type of the left-hand-side.
+ * \tparam Rhs Type of the right-hand-side.
+ * \tparam Option Option of the product.
+ */
+template <typename Lhs, typename Rhs, int Option>
+struct is_eigen_product<Eigen::Product<Lhs, Rhs, Option>> : std::true_type {};
+
+/*!
+ * \brief Create a view of a matrix in Eigen library with direct access to
+ * the buffer.
+ *
+ * \tparam Derived Type of the matrix.
+ * \param[in] matrix Matrix.
+ * \return View.
+ *
+ * \note Vectors with inner strides are supported, but matrices with inner
+ * strides are not supported.
+ */
+template <typename Derived>
+[[nodiscard]] matrix_view<typename Derived::Scalar> as_eigen_matrix_view(
+    const Eigen::DenseBase<Derived>& matrix) {
+    static_assert(has_eigen_direct_access_v<Derived>,
+        "Views can be created only for types with direct access to values. "
+        "Use the conversion to JSON values for expressions.");
+    const auto rows = static_cast<std::size_t>(matrix.rows());
+    const auto cols = static_cast<std::size_t>(matrix.cols());
+    const auto inner_stride =
+        static_cast<std::size_t>(matrix.derived().innerStride());
+    const auto outer_stride =
+        static_cast<std::size_t>(matrix.derived().outerStride());
+    if (inner_stride == 1) {
+        return matrix_view<typename Derived::Scalar>(matrix.derived().data(),
+            rows, cols,
+            Derived::IsRowMajor ? storage_order::row_major
+                                : storage_order::column_major,
+            outer_stride);
+    }
+    // Vectors with inner strides are handled as matrices with one value in
+    // each row or column.
+    if (rows == 1) {
+        return matrix_view<typename Derived::Scalar>(matrix.derived().data(),
+            rows, cols, storage_order::column_major, inner_stride);
+    }
+    if (cols == 1) {
+        return matrix_view<typename Derived::Scalar>(matrix.derived().data(),
+            rows, cols, storage_order::row_major, inner_stride);
+    }
+    throw std::invalid_argument(
+        "Matrices with inner strides are not supported.");
+}
+
+/*!
+ * \brief Call a function for each row of a matrix or an expression in Eigen
+ * library with a contiguous buffer of the row.
+ *
+ * \tparam Derived Type of the matrix or the expression.
+ * \tparam Function Type of the function.
+ * \param[in] matrix Matrix or expression.
+ * \param[in] function Function called with the index of the row and the
+ * pointer to the values in the row.
+ *
+ * \note Values in buffers are used directly if possible. Otherwise,
+ * coefficients of expressions are evaluated into a buffer of a block of rows,
+ * without evaluating the whole expression into a temporary matrix.
+ */
+template <typename Derived, typename Function>
+void for_each_eigen_row(
+    const Eigen::DenseBase<Derived>& matrix, Function&& function) {
+    using scalar_type = typename Derived::Scalar;
+    if constexpr (has_eigen_direct_access_v<Derived>) {
+        if (matrix.derived().innerStride() == 1 || matrix.rows() == 1 ||
+            matrix.cols() == 1) {
+            for_each_matrix_row(
+                as_eigen_matrix_view(matrix), std::forward<Function>(function));
+            return;
+        }
+    }
+
+    const auto rows = static_cast<std::size_t>(matrix.rows());
+    const auto cols = static_cast<std::size_t>(matrix.cols());
+    // Coefficients are evaluated in the storage order of the expression.
+    const std::size_t block_rows = Derived::IsRowMajor
+        ? std::min<std::size_t>(rows, 1)
+        : std::min(rows, matrix_gather_block_rows);
+    // std::vector is not used to support bool.
+    // NOLINTNEXTLINE(*-avoid-c-arrays)
+    const auto buffer = std::make_unique<scalar_type[]>(block_rows * cols);
+    for (std::size_t row_begin = 0; row_begin < rows;
+        row_begin += block_rows) {
+        const std::size_t num_rows = std::min(block_rows, rows - row_begin);
+        if constexpr (Derived::IsRowMajor) {
+            for (std::size_t j = 0; j < cols; ++j) {
+                buffer[j] = matrix.coeff(static_cast<Eigen::Index>(row_begin),
+                    static_cast<Eigen::Index>(j));
+            }
+        } else {
+            for (std::size_t j = 0; j < cols; ++j) {
+                for (std::size_t k = 0; k < num_rows; ++k) {
+                    buffer[k * cols + j] =
+                        matrix.coeff(static_cast<Eigen::Index>(row_begin + k),
+                            static_cast<Eigen::Index>(j));
+                }
+            }
+        }
+        for (std::size_t k = 0; k < num_rows; ++k) {
+            function(row_begin + k, buffer.get() + k * cols);
+        }
+    }
+}
+
 /*!
- * \brief Specialization of json_converter class for Eigen::Matrix.
- *
- * \tparam Scalar Type of values in Eigen::Matrix.
- * \tparam Rows Number of rows in Eigen::Matrix.
- * \tparam Cols Number of columns in Eigen::Matrix.
- * \tparam Options Options of Eigen::Matrix.
- * \tparam MaxRows Maximum number of rows in Eigen::Matrix.
- * \tparam MaxCols Maximum number of columns in Eigen::Matrix.
+ * \brief Convert a vector in Eigen library to a JSON array.
+ *
+ * \tparam Derived Type of the row vector or the expression.
+ * \param[in] from Row vector to convert from.
+ * \param[out] to JSON value to convert to.
+ */
+template <typename Derived>
+void eigen_row_vector_to_json(
+    const Eigen::DenseBase<Derived>& from, json_value& to) {
+    using scalar_type = typename Derived::Scalar;
+    const auto size = static_cast<std::size_t>(from.size());
+    if (size == 0) {
+        yyjson_mut_set_arr(to.internal_value());
+        yyjson_mut_arr_clear(to.internal_value());
+        return;
+    }
+    for_each_eigen_row(
+        from, [&to, size](std::size_t /*row*/, const scalar_type* values) {
+            if constexpr (is_json_number_v<scalar_type>) {
+                assign_number_array(values, size, to);
+            } else {
+                yyjson_mut_set_arr(to.internal_value());
+                yyjson_mut_arr_clear(to.internal_value());
+                for (std::size_t i = 0; i < size; ++i) {
+                    to.push_back(values[i]);
+                }
+            }
+        });
+}
+
+/*!
+ * \brief Check whether a type is Eigen::Map of vectors.
+ *
+ * \tparam T Type.
  */
-template <typename Scalar, int Rows, int Cols, int Options, int MaxRows,
-    int MaxCols>
-class json_converter<
-    Eigen::Matrix<Scalar, Rows, Cols, Options, MaxRows, MaxCols>> {
+template <typename T>
+struct is_eigen_vector_map : std::false_type {};
+
+/*!
+ * \brief Check whether a type is Eigen::Map of vectors.
+ *
+ * \tparam PlainObjectType Type of the mapped vector.
+ * \tparam MapOptions Options of the map.
+ * \tparam StrideType Type of strides.
+ */
+template <typename PlainObjectType, int MapOptions, typename StrideType>
+struct is_eigen_vector_map<Eigen::Map<PlainObjectType, MapOptions, StrideType>>
+    : std::bool_constant<PlainObjectType::IsVectorAtCompileTime != 0> {};
+
+/*!
+ * \brief Specialization of is_column_view for Eigen::Map of vectors.
+ *
+ * \tparam T Type.
+ */
+template <typename T>
+struct is_column_view<T, std::enable_if_t<is_eigen_vector_map<T>::value>>
+    : std::true_type {};
+
+}  // namespace details
+
+/*!
+ * \brief Create a view of a matrix in Eigen library.
+ *
+ * \tparam Derived Type of the matrix. (Eigen::Matrix, Eigen::Array,
+ * Eigen::Map, Eigen::Ref, or blocks of them.)
+ * \param[in] matrix Matrix.
+ * \return View.
+ *
+ * \note Expressions without buffers of values are not supported.
+ */
+template <typename Derived>
+[[nodiscard]] matrix_view<typename Derived::Scalar> as_matrix(
+    const Eigen::DenseBase<Derived>& matrix) {
+    return details::as_eigen_matrix_view(matrix);
+}
+
+/*!
+ * \brief Create a view of a matrix in Eigen library converted to a typed
+ * array.
+ *
+ * \tparam Derived Type of the matrix. (Eigen::Matrix, Eigen::Array,
+ * Eigen::Map, Eigen::Ref, or blocks of them.)
+ * \param[in] matrix Matrix.
+ * \return View.
+ *
+ * \note Vectors are converted to one-dimensional typed arrays.
+ * \note Expressions without buffers of values are not supported.
+ */
+template <typename Derived>
+[[nodiscard]] typed_array_view<typename Derived::Scalar> as_typed_array(
+    const Eigen::DenseBase<Derived>& matrix) {
+    const bool is_vector = matrix.rows() == 1 || matrix.cols() == 1;
+    return typed_array_view<typename Derived::Scalar>(
+        details::as_eigen_matrix_view(matrix), !is_vector);
+}
+
+/*!
+ * \brief Specialization of json_converter class for matrices, arrays, and
+ * expressions in Eigen library.
+ *
+ * \tparam Derived Type of the matrix or the expression.
+ *
+ * \note Values are written to JSON values directly from buffers if possible.
+ * Expressions are evaluated coefficient-wise without temporary matrices,
+ * except for products which are evaluated at once.
+ * \note Vectors are converted to JSON arrays of values, and matrices are
+ * converted to JSON arrays of rows.
+ */
+template <typename Derived>
+class json_converter<Derived,
+    std::enable_if_t<std::is_base_of_v<Eigen::DenseBase<Derived>, Derived>>> {
 public:
     /*!
      * \brief Convert an object to a JSON value.
@@ -54,29 +297,36 @@ public:
      * \param[in] from Object to convert from.
      * \param[out] to JSON value to convert to.
      */
-    static void to_json(
-        const Eigen::Matrix<Scalar, Rows, Cols, Options, MaxRows, MaxCols>&
-            from,
-        json_value& to) {
+    static void to_json(const Derived& from, json_value& to) {
         details::check_assignment(to);
-        if (from.rows() == 1 || from.cols() == 1) {
-            // Vectors.
-            yyjson_mut_set_arr(to.internal_value());
-            yyjson_mut_arr_clear(to.internal_value());
-            for (const auto& value : from.reshaped()) {
-                to.push_back(value);
-            }
+        using scalar_type = typename Derived::Scalar;
+        if constexpr (details::is_eigen_product<Derived>::value) {
+            // Coefficients of products can't be evaluated lazily.
+            json_converter<typename Derived::PlainObject>::to_json(
+                from.eval(), to);
+        } else if (from.rows() == 1) {
+            // Row vectors.
+            details::eigen_row_vector_to_json(from, to);
+        } else if (from.cols() == 1) {
+            // Column vectors.
+            details::eigen_row_vector_to_json(from.transpose(), to);
         } else {
             // Matrices.
             yyjson_mut_set_arr(to.internal_value());
             yyjson_mut_arr_clear(to.internal_value());
-            for (Eigen::Index i = 0; i < from.rows(); ++i) {
-                auto row_json = to.emplace_back();
-                yyjson_mut_set_arr(row_json.internal_value());
-                for (Eigen::Index j = 0; j < from.cols(); ++j) {
-                    row_json.push_back(from(i, j));
-                }
-            }
+            const auto cols = static_cast<std::size_t>(from.cols());
+            details::for_each_eigen_row(from,
+                [&to, cols](std::size_t /*row*/, const scalar_type* values) {
+                    if constexpr (details::is_json_number_v<scalar_type>) {
+                        details::append_number_array(values, cols, to);
+                    } else {
+                        auto row_json = to.emplace_back();
+                        yyjson_mut_set_arr(row_json.internal_value());
+                        for (std::size_t j = 0; j < cols; ++j) {
+                            row_json.push_back(values[j]);
+                        }
+                    }
+                });
         }
     }
 };
@@ -19,13 +19,19 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <string>
 #include <string_view>
+#include <utility>
 
 #include "plotly_plotter/config.h"
+#include "plotly_plotter/details/escape_for_html.h"
+#include "plotly_plotter/details/compress_uniform_coordinates.h"
+#include "plotly_plotter/details/share_repeated_arrays.h"
 #include "plotly_plotter/json_document.h"
 #include "plotly_plotter/json_value.h"
 #include "plotly_plotter/layout.h"
+#include "plotly_plotter/metrics/metrics_registry.h"
 #include "plotly_plotter/styles.h"
 #include "plotly_plotter/traces/bar.h"
 #include "plotly_plotter/traces/box.h"
@@ -52,7 +58,7 @@ public:
      * \return Added scatter trace.
      */
     [[nodiscard]] traces::scatter add_scatter() {
-        return traces::scatter(data_.emplace_back());
+        return traces::scatter(add_trace_data());
     }
 
     /*!
@@ -61,7 +67,7 @@ public:
      * \return Added scatter trace.
      */
     [[nodiscard]] traces::scatter_gl add_scatter_gl() {
-        return traces::scatter_gl(data_.emplace_back());
+        return traces::scatter_gl(add_trace_data());
     }
 
     /*!
@@ -70,7 +76,7 @@ public:
      * \return Added box trace.
      */
     [[nodiscard]] traces::box add_box() {
-        return traces::box(data_.emplace_back());
+        return traces::box(add_trace_data());
     }
 
     /*!
@@ -79,7 +85,7 @@ public:
      * \return Added violin trace.
      */
     [[nodiscard]] traces::violin add_violin() {
-        return traces::violin(data_.emplace_back());
+        return traces::violin(add_trace_data());
     }
 
     /*!
@@ -88,7 +94,7 @@ public:
      * \return Added bar trace.
      */
     [[nodiscard]] traces::bar add_bar() {
-        return traces::bar(data_.emplace_back());
+        return traces::bar(add_trace_data());
     }
 
     /*!
@@ -97,7 +103,7 @@ public:
      * \return Added heatmap trace.
      */
     [[nodiscard]] traces::heatmap add_heatmap() {
-        return traces::heatmap(data_.emplace_back());
+        return traces::heatmap(add_trace_data());
     }
 
     /*!
@@ -106,7 +112,7 @@ public:
      * \return Added histogram trace.
      */
     [[nodiscard]] traces::histogram add_histogram() {
-        return traces::histogram(data_.emplace_back());
+        return traces::histogram(add_trace_data());
     }
 
     ///@}
@@ -117,20 +123,16 @@ public:
      * \return Layout of this figure.
      */
     [[nodiscard]] plotly_plotter::layouts::layout layout() {
-        return plotly_plotter::layouts::layout(layout_);
+        json_value layout_data = frame_data()["layout"];
+        layout_data.set_to_object();
+        return plotly_plotter::layouts::layout(layout_data);
     }
 
 protected:
     /*!
      * \brief Constructor.
-     *
-     * \param[in] data JSON data.
      */
-    explicit figure_frame_base(json_value data)
-        : data_(data["data"]), layout_(data["layout"]) {
-        data_.set_to_array();
-        layout_.set_to_object();
-    }
+    figure_frame_base() noexcept = default;
 
     /*!
      * \brief Copy constructor.
@@ -161,26 +163,42 @@ protected:
      */
     ~figure_frame_base() = default;
 
-private:
-    //! JSON data of traces.
-    json_value data_;
+    /*!
+     * \brief Get the JSON data of this figure or frame.
+     *
+     * \return JSON data.
+     */
+    [[nodiscard]] virtual json_value frame_data() = 0;
 
-    //! JSON data of layout.
-    json_value layout_;
+private:
+    /*!
+     * \brief Add JSON data of a trace.
+     *
+     * \return JSON data of the added trace.
+     */
+    [[nodiscard]] json_value add_trace_data() {
+        metrics::metrics_registry::get_instance().add(
+            metrics::counter_type::traces_created);
+        json_value traces_data = frame_data()["data"];
+        traces_data.set_to_array();
+        return traces_data.emplace_back();
+    }
 };
 
 /*!
  * \brief Class of frames in animation in Plotly.
  */
-class animation_frame : public figure_frame_base {
+class animation_frame final : public figure_frame_base {
 public:
     /*!
      * \brief Constructor.
      *
      * \param[in] data JSON data.
      */
-    explicit animation_frame(json_value data)
-        : figure_frame_base(data), json_data_(data) {}
+    explicit animation_frame(json_value data) : json_data_(data) {
+        json_data_["data"].set_to_array();
+        json_data_["layout"].set_to_object();
+    }
 
     /*!
      * \brief Set the name of this frame.
@@ -190,14 +208,100 @@ public:
     void name(std::string_view value) { json_data_["name"] = value; }
 
 private:
+    //! \copydoc figure_frame_base::frame_data
+    [[nodiscard]] json_value frame_data() override { return json_data_; }
+
     //! JSON data.
     json_value json_data_;
 };
 
+/*!
+ * \brief Class of figures frozen into data serialized for outputs.
+ *
+ * Objects of this class are created by \ref figure::freeze function.
+ * Functions to write figures use the serialized data directly,
+ * so a frozen figure written several times (e.g., to HTML, PNG, and PDF)
+ * is serialized only once.
+ *
+ * \note Objects of this class are immutable.
+ */
+class frozen_figure {
+public:
+    /*!
+     * \brief Get the title in HTML.
+     *
+     * \return Title in HTML.
+     */
+    [[nodiscard]] const std::string& html_title() const noexcept {
+        return html_title_;
+    }
+
+    /*!
+     * \brief Get the data of the figure in JSON escaped for HTML.
+     *
+     * \return Data.
+     */
+    [[nodiscard]] std::string_view escaped_data() const noexcept {
+        return escaped_data_;
+    }
+
+    /*!
+     * \brief Check whether the figure has frames of animation.
+     *
+     * \return Whether the figure has frames of animation.
+     */
+    [[nodiscard]] bool has_frames() const noexcept { return has_frames_; }
+
+    /*!
+     * \brief Check whether the figure has arrays shared in the figure.
+     *
+     * \return Whether the figure has arrays shared in the figure.
+     */
+    [[nodiscard]] bool has_shared_arrays() const noexcept {
+        return has_shared_arrays_;
+    }
+
+private:
+    //! Allow figure class to create objects.
+    friend class figure;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] html_title Title in HTML.
+     * \param[in] escaped_data Data of the figure in JSON escaped for HTML.
+     * \param[in] has_frames Whether the figure has frames of animation.
+     * \param[in] has_shared_arrays Whether the figure has arrays shared in the
+     * figure.
+     */
+    frozen_figure(std::string html_title, std::string escaped_data,
+        bool has_frames, bool has_shared_arrays)
+        : html_title_(std::move(html_title)),
+          escaped_data_(std::move(escaped_data)),
+          has_frames_(has_frames),
+          has_shared_arrays_(has_shared_arrays) {}
+
+    //! Title in HTML.
+    std::string html_title_;
+
+    //! Data of the figure in JSON escaped for HTML.
+    std::string escaped_data_;
+
+    //! Whether the figure has frames of animation.
+    bool has_frames_;
+
+    //! Whether the figure has arrays shared in the figure.
+    bool has_shared_arrays_;
+};
+
 /*!
  * \brief Class of figures in Plotly.
+ *
+ * \note Figures created from JSON documents by \ref from_document function
+ * and copies of such figures access their documents only when the figures are
+ * changed, so writing them outputs the documents as is.
  */
-class figure : public figure_frame_base {
+class figure final : public figure_frame_base {
 public:
     /*!
      * \brief Constructor.
@@ -215,7 +319,7 @@ public:
      * \return Added scatter trace.
      */
     [[nodiscard]] traces::scatter add_scatter_template() {
-        return traces::scatter(data_template_.emplace_back());
+        return traces::scatter(add_trace_template_data());
     }
 
     /*!
@@ -224,7 +328,7 @@ public:
      * \return Added scatter trace.
      */
     [[nodiscard]] traces::scatter_gl add_scatter_gl_template() {
-        return traces::scatter_gl(data_template_.emplace_back());
+        return traces::scatter_gl(add_trace_template_data());
     }
 
     /*!
@@ -233,7 +337,7 @@ public:
      * \return Added box trace.
      */
     [[nodiscard]] traces::box add_box_template() {
-        return traces::box(data_template_.emplace_back());
+        return traces::box(add_trace_template_data());
     }
 
     /*!
@@ -242,7 +346,7 @@ public:
      * \return Added violin trace.
      */
     [[nodiscard]] traces::violin add_violin_template() {
-        return traces::violin(data_template_.emplace_back());
+        return traces::violin(add_trace_template_data());
     }
 
     /*!
@@ -251,7 +355,7 @@ public:
      * \return Added bar trace.
      */
     [[nodiscard]] traces::bar add_bar_template() {
-        return traces::bar(data_template_.emplace_back());
+        return traces::bar(add_trace_template_data());
     }
 
     /*!
@@ -260,7 +364,7 @@ public:
      * \return Added heatmap trace.
      */
     [[nodiscard]] traces::heatmap add_heatmap_template() {
-        return traces::heatmap(data_template_.emplace_back());
+        return traces::heatmap(add_trace_template_data());
     }
 
     /*!
@@ -269,7 +373,7 @@ public:
      * \return Added histogram trace.
      */
     [[nodiscard]] traces::histogram add_histogram_template() {
-        return traces::histogram(data_template_.emplace_back());
+        return traces::histogram(add_trace_template_data());
     }
 
     ///@}
@@ -280,7 +384,9 @@ public:
      * \return Configuration of this figure.
      */
     [[nodiscard]] plotly_plotter::config config() {
-        return plotly_plotter::config(config_);
+        json_value config_data = document_.root()["config"];
+        config_data.set_to_object();
+        return plotly_plotter::config(config_data);
     }
 
     /*!
@@ -289,7 +395,9 @@ public:
      * \return Template of the layout.
      */
     [[nodiscard]] plotly_plotter::layouts::layout layout_template() {
-        return plotly_plotter::layouts::layout(layout_template_);
+        json_value layout_data = document_.root()["template"]["layout"];
+        layout_data.set_to_object();
+        return plotly_plotter::layouts::layout(layout_data);
     }
 
     /*!
@@ -356,6 +464,102 @@ public:
         html_title_ = static_cast<std::string>(value);
     }
 
+    /*!
+     * \brief Freeze this figure into data serialized for outputs.
+     *
+     * \return Frozen figure.
+     *
+     * \note Later changes of this figure are not reflected to the returned
+     * object. This figure can be destroyed to release the memory of the JSON
+     * document.
+     */
+    [[nodiscard]] frozen_figure freeze() const {
+        PLOTLY_PLOTTER_TRACE_SPAN("figure::freeze", "json");
+        const std::string serialized_data = document_.serialize_to_string();
+        return frozen_figure(html_title_,
+            details::escape_for_html(serialized_data),
+            document_.has_root_key("frames"),
+            document_.has_root_key("shared_arrays"));
+    }
+
+    /*!
+     * \brief Create a deep copy of this figure.
+     *
+     * \return Copied figure.
+     *
+     * \note This function copies the JSON document of this figure at once
+     * without applying default configurations and styles again,
+     * so copying a configured figure is faster than configuring a new figure.
+     */
+    [[nodiscard]] figure clone() const {
+        return figure(document_.clone(), html_title_);
+    }
+
+    /*!
+     * \brief Create a figure from a JSON document of a figure.
+     *
+     * \param[in] document JSON document with "data" and "layout" of a figure
+     * (for example, a document created by json_document::parse function).
+     * \param[in] html_title Title in HTML.
+     * \return Figure.
+     *
+     * \note Default configurations and styles are not applied, and no key is
+     * added to the document until this figure is changed.
+     */
+    [[nodiscard]] static figure from_document(json_document document,
+        std::string html_title = "Untitled Plot") {
+        return figure(std::move(document), std::move(html_title));
+    }
+
+    /*!
+     * \brief Replace uniformly spaced coordinates in traces with the first
+     * coordinates and steps.
+     *
+     * \param[in] min_size Minimum number of elements of coordinates to
+     * compress.
+     * \return Number of arrays removed.
+     *
+     * \note This function replaces `x` and `y` in scatter, bar, and heatmap
+     * traces with `x0`, `dx`, `y0`, and `dy` when the coordinates are
+     * arithmetic sequences within rounding errors.
+     * \note Figure builders call this function when
+     * `compress_uniform_coordinates(true)` is set to them.
+     */
+    std::size_t compress_uniform_coordinates(std::size_t min_size =
+            details::default_min_uniform_coordinates_size) {
+        return details::compress_uniform_coordinates(document_, min_size);
+    }
+
+    /*!
+     * \brief Store arrays repeated in this figure only once in a table.
+     *
+     * \param[in] min_size Minimum number of elements of arrays to share.
+     * \return Number of arrays replaced with references to the table.
+     *
+     * \note HTML templates in this library restore the arrays before
+     * plotting, so this function reduces the size of outputs and the time to
+     * parse them in browsers without changing plots. The script to restore
+     * the arrays is written only for figures with shared arrays.
+     * \note Figure builders call this function when
+     * `share_repeated_arrays(true)` is set to them.
+     */
+    std::size_t share_repeated_arrays(
+        std::size_t min_size = details::default_min_shared_array_size) {
+        return details::share_repeated_arrays(document_, min_size);
+    }
+
+    /*!
+     * \brief Compute statistics of the JSON data of this figure.
+     *
+     * \return Statistics.
+     *
+     * \note This function traverses all values in this figure,
+     * so it takes time proportional to the size of this figure.
+     */
+    [[nodiscard]] json_statistics compute_statistics() const {
+        return document_.compute_statistics();
+    }
+
     /*!
      * \brief Get the JSON document of this figure.
      *
@@ -393,35 +597,48 @@ private:
      *
      * \param[in] document JSON document.
      */
-    explicit figure(json_document document)
-        : figure_frame_base(document.root()), document_(std::move(document)) {
-        data_.set_to_array();
-        layout_.set_to_object();
-        config_.set_to_object();
-        data_template_.set_to_array();
-        layout_template_.set_to_object();
+    explicit figure(json_document document) : document_(std::move(document)) {
+        metrics::metrics_registry::get_instance().add(
+            metrics::counter_type::figures_created);
+        json_value root = document_.root();
+        root["data"].set_to_array();
+        root["layout"].set_to_object();
+        root["config"].set_to_object();
+        root["template"]["data"].set_to_array();
+        root["template"]["layout"].set_to_object();
         config().scroll_zoom(true);
         config().responsive(true);
-        styles::simple_style(plotly_plotter::layouts::layout(layout_template_));
+        styles::simple_style(layout_template());
     }
 
-    //! JSON document of this figure.
-    json_document document_;
-
-    //! JSON data of traces.
-    json_value data_{document_.root()["data"]};
-
-    //! JSON data of layout.
-    json_value layout_{document_.root()["layout"]};
+    /*!
+     * \brief Constructor to copy a figure.
+     *
+     * \param[in] document Copied JSON document.
+     * \param[in] html_title Title in HTML.
+     */
+    figure(json_document document, std::string html_title)
+        : document_(std::move(document)), html_title_(std::move(html_title)) {
+        metrics::metrics_registry::get_instance().add(
+            metrics::counter_type::figures_created);
+    }
 
-    //! JSON data of configuration.
-    json_value config_{document_.root()["config"]};
+    //! \copydoc figure_frame_base::frame_data
+    [[nodiscard]] json_value frame_data() override { return document_.root(); }
 
-    //! JSON data of data in templates.
-    json_value data_template_{document_.root()["template"]["data"]};
+    /*!
+     * \brief Add JSON data of a template of a trace.
+     *
+     * \return JSON data of the added template.
+     */
+    [[nodiscard]] json_value add_trace_template_data() {
+        json_value templates_data = document_.root()["template"]["data"];
+        templates_data.set_to_array();
+        return templates_data.emplace_back();
+    }
 
-    //! JSON data of layout in templates.
-    json_value layout_template_{document_.root()["template"]["layout"]};
+    //! JSON document of this figure.
+    json_document document_;
 
     //! Title of the HTML page.
     std::string html_title_{"Untitled Plot"};
@@ -0,0 +1,49 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of aggregation_function enumeration.
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace plotly_plotter::figure_builders {
+
+/*!
+ * \brief Enumeration of functions to aggregate values in groups of rows.
+ */
+enum class aggregation_function : std::uint8_t {
+    //! Number of values.
+    count,
+
+    //! Sum of values.
+    sum,
+
+    //! Average of values.
+    average,
+
+    //! Minimum of values.
+    minimum,
+
+    //! Maximum of values.
+    maximum,
+
+    //! Quantile of values.
+    quantile
+};
+
+}  // namespace plotly_plotter::figure_builders
@@ -21,6 +21,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -28,8 +29,10 @@
 
 #include "plotly_plotter/data_table.h"
 #include "plotly_plotter/details/plotly_plotter_export.h"
+#include "plotly_plotter/figure_builders/aggregation_function.h"
 #include "plotly_plotter/figure_builders/color_sequences.h"
 #include "plotly_plotter/figure_builders/figure_builder_base.h"
+#include "plotly_plotter/traces/bar.h"
 
 namespace plotly_plotter::figure_builders {
 
@@ -68,6 +71,36 @@ public:
      */
     bar& y(std::string value);
 
+    /*!
+     * \brief Set the function to aggregate y values in rows with the same x
+     * coordinate.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     *
+     * \note Without this option, a bar is plotted for each row.
+     * \note Values are aggregated in each group, subplot, and animation
+     * frame.
+     * \note y values are required for functions other than count.
+     * \note Additional data in hovers are not shown when values are
+     * aggregated.
+     */
+    bar& function(aggregation_function value);
+
+    /*!
+     * \brief Set the probability of quantiles used in
+     * aggregation_function::quantile.
+     *
+     * \param[in] value Value. (Must be in [0, 1].)
+     * \return This object.
+     *
+     * \note This function throws std::invalid_argument for values out of
+     * [0, 1].
+     * \note Quantiles are defined as in the linear method of plotly.js,
+     * which is also used in box plots.
+     */
+    bar& quantile_probability(double value);
+
     /*!
      * \brief Set the column name of groups.
      *
@@ -163,6 +196,54 @@ public:
      */
     bar& title(std::string value);
 
+    /*!
+     * \brief Set the budget of the number of rows in the data plotted in the
+     * figure.
+     *
+     * \param[in] max_rows Maximum number of rows. (0 for no limit.)
+     * \param[in] policy Policy when the number of rows exceeds the budget.
+     * \return This object.
+     *
+     * \note The budget is checked against the number of rows in the data
+     * table, not the number of values written to the figure.
+     */
+    bar& row_budget(std::size_t max_rows,
+        row_budget_policy policy = row_budget_policy::throw_error);
+
+    /*!
+     * \brief Set whether to remove attributes of traces constant among
+     * frames of animation from the frames.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     *
+     * \note Removing the attributes reduces the size of figures with many
+     * frames. Plotly takes the removed attributes from the traces of the
+     * figure when switching frames.
+     */
+    bar& remove_constant_frame_attributes(bool value);
+
+    /*!
+     * \brief Set whether to replace uniformly spaced coordinates with
+     * `x0`, `dx`, `y0`, and `dy`.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     */
+    bar& compress_uniform_coordinates(bool value);
+
+    /*!
+     * \brief Set whether to store arrays repeated in the figure only once.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     *
+     * \note HTML files written by this library restore the arrays, but
+     * other programs reading JSON of figures need to restore them
+     * themselves.
+     */
+    bar& share_repeated_arrays(bool value);
+
 private:
     //! Enumeration of modes of coloring.
     enum class color_mode : std::uint8_t {
@@ -195,6 +276,32 @@ private:
     [[nodiscard]] std::vector<std::string> additional_hover_data_in_trace()
         const override;
 
+    //! \copydoc figure_builder_base::supports_row_downsampling
+    [[nodiscard]] bool supports_row_downsampling() const noexcept override;
+
+    /*!
+     * \brief Set aggregated values to a trace.
+     *
+     * \param[in] bar Trace.
+     * \param[in] mask Mask of rows in the trace.
+     */
+    void add_aggregated_values(
+        traces::bar& bar, const std::vector<bool>& mask) const;
+
+    /*!
+     * \brief Aggregate values in all traces.
+     *
+     * \return Aggregated values.
+     */
+    [[nodiscard]] std::vector<double> aggregate_values_in_all_traces() const;
+
+    /*!
+     * \brief Get the name of values in bars.
+     *
+     * \return Name.
+     */
+    [[nodiscard]] std::string value_name() const;
+
     //! Color sequence.
     std::vector<std::string> color_sequence_{color_sequence_plotly()};
 
@@ -218,6 +325,12 @@ private:
 
     //! Whether to use log scale in y-axis.
     bool log_y_{false};
+
+    //! Function to aggregate values. (Null to plot a bar for each row.)
+    std::optional<aggregation_function> function_;
+
+    //! Probability of quantiles.
+    double quantile_probability_{0.5};  // NOLINT(*-magic-numbers)
 };
 
 }  // namespace plotly_plotter::figure_builders
@@ -161,6 +161,54 @@ public:
      */
     bar_based_histogram& title(std::string value);
 
+    /*!
+     * \brief Set the budget of the number of rows in the data plotted in the
+     * figure.
+     *
+     * \param[in] max_rows Maximum number of rows. (0 for no limit.)
+     * \param[in] policy Policy when the number of rows exceeds the budget.
+     * \return This object.
+     *
+     * \note The budget is checked against the number of rows in the data
+     * table, not the number of values written to the figure.
+     */
+    bar_based_histogram& row_budget(std::size_t max_rows,
+        row_budget_policy policy = row_budget_policy::throw_error);
+
+    /*!
+     * \brief Set whether to remove attributes of traces constant among
+     * frames of animation from the frames.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     *
+     * \note Removing the attributes reduces the size of figures with many
+     * frames. Plotly takes the removed attributes from the traces of the
+     * figure when switching frames.
+     */
+    bar_based_histogram& remove_constant_frame_attributes(bool value);
+
+    /*!
+     * \brief Set whether to replace uniformly spaced coordinates with
+     * `x0`, `dx`, `y0`, and `dy`.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     */
+    bar_based_histogram& compress_uniform_coordinates(bool value);
+
+    /*!
+     * \brief Set whether to store arrays repeated in the figure only once.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     *
+     * \note HTML files written by this library restore the arrays, but
+     * other programs reading JSON of figures need to restore them
+     * themselves.
+     */
+    bar_based_histogram& share_repeated_arrays(bool value);
+
 private:
     //! Enumeration of modes of coloring.
     enum class color_mode : std::uint8_t {
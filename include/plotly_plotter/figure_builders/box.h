@@ -190,6 +190,23 @@ public:
      */
     box& box_points(std::string value);
 
+    /*!
+     * \brief Set whether to precompute statistics of boxes.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     *
+     * If true, quartiles, fences, means, and standard deviations of boxes
+     * are computed in this library and written to figures
+     * instead of all values of y coordinates,
+     * which reduces the size of figures for large data.
+     * Values are written only if they are displayed as points
+     * according to \ref box_points (only the outliers by default).
+     *
+     * \note Additional data in hovers are not shown in this mode.
+     */
+    box& precompute_statistics(bool value);
+
     /*!
      * \brief Set whether to use log scale in y-axis.
      *
@@ -206,6 +223,45 @@ public:
      */
     box& title(std::string value);
 
+    /*!
+     * \brief Set the budget of the number of rows in the data plotted in the
+     * figure.
+     *
+     * \param[in] max_rows Maximum number of rows. (0 for no limit.)
+     * \param[in] policy Policy when the number of rows exceeds the budget.
+     * \return This object.
+     *
+     * \note The budget is checked against the number of rows in the data
+     * table, not the number of values written to the figure.
+     */
+    box& row_budget(std::size_t max_rows,
+        row_budget_policy policy = row_budget_policy::throw_error);
+
+    /*!
+     * \brief Set whether to remove attributes of traces constant among
+     * frames of animation from the frames.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     *
+     * \note Removing the attributes reduces the size of figures with many
+     * frames. Plotly takes the removed attributes from the traces of the
+     * figure when switching frames.
+     */
+    box& remove_constant_frame_attributes(bool value);
+
+    /*!
+     * \brief Set whether to store arrays repeated in the figure only once.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     *
+     * \note HTML files written by this library restore the arrays, but
+     * other programs reading JSON of figures need to restore them
+     * themselves.
+     */
+    box& share_repeated_arrays(bool value);
+
 private:
     //! Enumeration of modes of coloring.
     enum class color_mode : std::uint8_t {
@@ -234,10 +290,22 @@ private:
         std::string_view hover_prefix,
         const std::vector<std::string>& additional_hover_text) const override;
 
+    /*!
+     * \brief Add precomputed statistics of boxes to a trace.
+     *
+     * \param[in] box Trace.
+     * \param[in] mask Mask of rows in the trace.
+     */
+    void add_precomputed_statistics(
+        traces::box& box, const std::vector<bool>& mask) const;
+
     //! \copydoc figure_builder_base::additional_hover_data_in_trace
     [[nodiscard]] std::vector<std::string> additional_hover_data_in_trace()
         const override;
 
+    //! \copydoc figure_builder_base::supports_row_downsampling
+    [[nodiscard]] bool supports_row_downsampling() const noexcept override;
+
     //! Color sequence.
     std::vector<std::string> color_sequence_{color_sequence_plotly()};
 
@@ -264,6 +332,9 @@ private:
 
     //! Whether to use log scale in y-axis.
     bool log_y_{false};
+
+    //! Whether to precompute statistics of boxes.
+    bool precompute_statistics_{false};
 };
 
 }  // namespace plotly_plotter::figure_builders
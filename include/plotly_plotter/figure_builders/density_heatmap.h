@@ -0,0 +1,298 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of density_heatmap class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "plotly_plotter/data_table.h"
+#include "plotly_plotter/details/plotly_plotter_export.h"
+#include "plotly_plotter/figure_builders/details/histogram_2d.h"
+#include "plotly_plotter/figure_builders/figure_builder_base.h"
+#include "plotly_plotter/figure_builders/aggregation_function.h"
+#include "plotly_plotter/utils/calculate_histogram_bin_width.h"
+
+namespace plotly_plotter::figure_builders {
+
+/*!
+ * \brief Class to create figures of heatmaps of densities of points
+ * (2D histograms).
+ *
+ * \note This class hold the reference of the data.
+ * So, the data must be valid until this object is destructed.
+ * \note Objects of this class can't be reused.
+ * \note Bins are calculated from all the data, so that traces in groups,
+ * subplots, and animation frames share the same bins.
+ */
+class PLOTLY_PLOTTER_EXPORT density_heatmap final : public figure_builder_base {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] data Data.
+     *
+     * \note This class hold the reference of the data.
+     * So, the data must be valid until this object is destructed.
+     */
+    explicit density_heatmap(const data_table& data);
+
+    /*!
+     * \brief Set the column name of x coordinates.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     */
+    density_heatmap& x(std::string value);
+
+    /*!
+     * \brief Set the column name of y coordinates.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     */
+    density_heatmap& y(std::string value);
+
+    /*!
+     * \brief Set the column name of values aggregated in bins.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     *
+     * \note This option is required for functions other than count.
+     */
+    density_heatmap& z(std::string value);
+
+    /*!
+     * \brief Set the function to aggregate values in bins.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     *
+     * \note This function throws std::invalid_argument for
+     * aggregation_function::quantile, which is not supported in density
+     * heatmaps.
+     */
+    density_heatmap& function(aggregation_function value);
+
+    /*!
+     * \brief Set the column name of groups.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     */
+    density_heatmap& group(std::string value);
+
+    /*!
+     * \brief Set the column name of rows in subplots.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     */
+    density_heatmap& subplot_row(std::string value);
+
+    /*!
+     * \brief Set the column name of columns in subplots.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     */
+    density_heatmap& subplot_column(std::string value);
+
+    /*!
+     * \brief Set the column name of frames in animation.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     */
+    density_heatmap& animation_frame(std::string value);
+
+    /*!
+     * \brief Set whether to use log scale in x-axis.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     */
+    density_heatmap& log_x(bool value);
+
+    /*!
+     * \brief Set whether to use log scale in y-axis.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     */
+    density_heatmap& log_y(bool value);
+
+    /*!
+     * \brief Set the method to calculate bin widths.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     */
+    density_heatmap& bin_width_method(utils::histogram_bin_width_method value);
+
+    /*!
+     * \brief Set the fixed bin width in x-axis.
+     *
+     * \param[in] value Value. (Width in logarithm of values in log scale.)
+     * \return This object.
+     */
+    density_heatmap& fixed_bin_width_x(double value);
+
+    /*!
+     * \brief Set the fixed bin width in y-axis.
+     *
+     * \param[in] value Value. (Width in logarithm of values in log scale.)
+     * \return This object.
+     */
+    density_heatmap& fixed_bin_width_y(double value);
+
+    /*!
+     * \brief Set the title of the figure.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     */
+    density_heatmap& title(std::string value);
+
+    /*!
+     * \brief Set the budget of the number of rows in the data plotted in the
+     * figure.
+     *
+     * \param[in] max_rows Maximum number of rows. (0 for no limit.)
+     * \param[in] policy Policy when the number of rows exceeds the budget.
+     * \return This object.
+     *
+     * \note The budget is checked against the number of rows in the data
+     * table, not the number of values written to the figure.
+     */
+    density_heatmap& row_budget(std::size_t max_rows,
+        row_budget_policy policy = row_budget_policy::throw_error);
+
+    /*!
+     * \brief Set whether to remove attributes of traces constant among
+     * frames of animation from the frames.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     *
+     * \note Removing the attributes reduces the size of figures with many
+     * frames. Plotly takes the removed attributes from the traces of the
+     * figure when switching frames.
+     */
+    density_heatmap& remove_constant_frame_attributes(bool value);
+
+    /*!
+     * \brief Set whether to replace uniformly spaced coordinates with
+     * `x0`, `dx`, `y0`, and `dy`.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     */
+    density_heatmap& compress_uniform_coordinates(bool value);
+
+    /*!
+     * \brief Set whether to store arrays repeated in the figure only once.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     *
+     * \note HTML files written by this library restore the arrays, but
+     * other programs reading JSON of figures need to restore them
+     * themselves.
+     */
+    density_heatmap& share_repeated_arrays(bool value);
+
+private:
+    //! \copydoc figure_builder_base::configure_axes
+    void configure_axes(figure& fig, std::size_t num_subplot_rows,
+        std::size_t num_subplot_columns,
+        bool require_manual_axis_ranges) const override;
+
+    //! \copydoc figure_builder_base::default_title
+    [[nodiscard]] std::string default_title() const override;
+
+    //! \copydoc figure_builder_base::add_trace
+    void add_trace(figure_frame_base& figure,
+        const std::vector<bool>& parent_mask, std::size_t subplot_index,
+        std::string_view group_name, std::size_t group_index,
+        std::string_view hover_prefix,
+        const std::vector<std::string>& additional_hover_text) const override;
+
+    //! \copydoc figure_builder_base::additional_hover_data_in_trace
+    [[nodiscard]] std::vector<std::string> additional_hover_data_in_trace()
+        const override;
+
+    /*!
+     * \brief Calculate bins.
+     */
+    void calculate_bins() const;
+
+    /*!
+     * \brief Get the name of the aggregated values.
+     *
+     * \return Name.
+     */
+    [[nodiscard]] std::string value_name() const;
+
+    //! Column name of x coordinates.
+    std::string x_;
+
+    //! Column name of y coordinates.
+    std::string y_;
+
+    //! Column name of values aggregated in bins.
+    std::string z_;
+
+    //! Function to aggregate values in bins.
+    aggregation_function function_{aggregation_function::count};
+
+    //! Whether to use log scale in x-axis.
+    bool log_x_{false};
+
+    //! Whether to use log scale in y-axis.
+    bool log_y_{false};
+
+    //! Method to calculate bin width.
+    utils::histogram_bin_width_method bin_width_method_{
+        utils::histogram_bin_width_method::freedman_diaconis};
+
+    //! Fixed bin width in x-axis. (Null for automatic selection.)
+    std::optional<double> fixed_bin_width_x_;
+
+    //! Fixed bin width in y-axis. (Null for automatic selection.)
+    std::optional<double> fixed_bin_width_y_;
+
+    //! Bins in x-axis.
+    mutable std::optional<details::histogram_axis> x_axis_;
+
+    //! Bins in y-axis.
+    mutable std::optional<details::histogram_axis> y_axis_;
+
+    //! Minimum of aggregated values in all traces.
+    mutable std::optional<double> min_value_;
+
+    //! Maximum of aggregated values in all traces.
+    mutable std::optional<double> max_value_;
+};
+
+}  // namespace plotly_plotter::figure_builders
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Declaration of box_statistics struct.
+ */
+#pragma once
+
+#include <vector>
+
+#include "plotly_plotter/details/plotly_plotter_export.h"
+
+namespace plotly_plotter::figure_builders::details {
+
+/*!
+ * \brief Struct of statistics of values in box plots.
+ *
+ * \note Statistics are calculated in the same way as plotly.js with the
+ * default settings (`quartilemethod` set to `"linear"`).
+ */
+struct box_statistics {
+    //! First quartile.
+    double q1;
+
+    //! Median.
+    double median;
+
+    //! Third quartile.
+    double q3;
+
+    //! Lower fence (the smallest value not less than q1 - 1.5 IQR).
+    double lower_fence;
+
+    //! Upper fence (the largest value not greater than q3 + 1.5 IQR).
+    double upper_fence;
+
+    //! Mean.
+    double mean;
+
+    //! Standard deviation.
+    double sd;
+};
+
+/*!
+ * \brief Calculate statistics of values in box plots.
+ *
+ * \param[in,out] values Values. The order of values is changed in this
+ * function.
+ * \return Statistics. (NaN for empty values.)
+ *
+ * \note Quantiles are calculated by \ref select_quantile function in linear
+ * time without sorting the values.
+ * \note NaN must be removed from values before calling this function.
+ */
+[[nodiscard]] PLOTLY_PLOTTER_EXPORT box_statistics calculate_box_statistics(
+    std::vector<double>& values);
+
+}  // namespace plotly_plotter::figure_builders::details
@@ -32,15 +32,13 @@ namespace plotly_plotter::figure_builders::details {
 /*!
  * \brief Calculate the range of an axis in linear scale.
  *
- * \param[in] data Data.
- * \param[in] column_name Column name.
+ * \param[in] column Column of values.
  * \param[in] extended_factor Factor of extension from the range of data.
  * \return Minimum and maximum values of the axis.
  */
 [[nodiscard]] inline std::pair<double, double> calculate_axis_range_in_linear(
-    const data_table& data, const std::string& column_name,
-    double extended_factor) {
-    const auto [min, max] = data.at(column_name)->get_range();
+    const data_column_base& column, double extended_factor) {
+    const auto [min, max] = column.get_range();
     const double range = max - min;
     const double min_extended = min - extended_factor * range;
     const double max_extended = max + extended_factor * range;
@@ -50,15 +48,13 @@ namespace plotly_plotter::figure_builders::details {
 /*!
  * \brief Calculate the range of an axis in log scale.
  *
- * \param[in] data Data.
- * \param[in] column_name Column name.
+ * \param[in] column Column of values.
  * \param[in] extended_factor Factor of extension from the range of data.
  * \return Minimum and maximum values of the axis.
  */
 [[nodiscard]] inline std::pair<double, double> calculate_axis_range_in_log(
-    const data_table& data, const std::string& column_name,
-    double extended_factor) {
-    const auto [min, max] = data.at(column_name)->get_positive_range();
+    const data_column_base& column, double extended_factor) {
+    const auto [min, max] = column.get_positive_range();
     const double min_log = std::log10(min);
     const double max_log = std::log10(max);
     const double range_log = max_log - min_log;
@@ -67,6 +63,22 @@ namespace plotly_plotter::figure_builders::details {
     return {min_log_extended, max_log_extended};
 }
 
+/*!
+ * \brief Calculate the range of an axis.
+ *
+ * \param[in] column Column of values.
+ * \param[in] extended_factor Factor of extension from the range of data.
+ * \param[in] log_scale Whether to use log scale.
+ * \return Minimum and maximum values of the axis.
+ */
+[[nodiscard]] inline std::pair<double, double> calculate_axis_range(
+    const data_column_base& column, double extended_factor, bool log_scale) {
+    if (log_scale) {
+        return calculate_axis_range_in_log(column, extended_factor);
+    }
+    return calculate_axis_range_in_linear(column, extended_factor);
+}
+
 /*!
  * \brief Calculate the range of an axis.
  *
@@ -79,10 +91,8 @@ namespace plotly_plotter::figure_builders::details {
 [[nodiscard]] inline std::pair<double, double> calculate_axis_range(
     const data_table& data, const std::string& column_name,
     double extended_factor, bool log_scale) {
-    if (log_scale) {
-        return calculate_axis_range_in_log(data, column_name, extended_factor);
-    }
-    return calculate_axis_range_in_linear(data, column_name, extended_factor);
+    return calculate_axis_range(
+        *data.at(column_name), extended_factor, log_scale);
 }
 
 }  // namespace plotly_plotter::figure_builders::details
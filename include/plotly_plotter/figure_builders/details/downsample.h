@@ -0,0 +1,50 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Declaration of downsample function.
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "plotly_plotter/data_column.h"
+#include "plotly_plotter/details/plotly_plotter_export.h"
+#include "plotly_plotter/figure_builders/figure_builder_base.h"
+
+namespace plotly_plotter::figure_builders::details {
+
+/*!
+ * \brief Downsample points in a trace.
+ *
+ * \param[in] method Method of downsampling.
+ * \param[in] x Column of x coordinates.
+ * (Null or non-numeric columns to use the order of rows instead.)
+ * \param[in] y Column of y coordinates.
+ * \param[in] parent_mask Mask of the values in the parent layer.
+ * \param[in] max_points Maximum number of points after downsampling.
+ * \return Mask of the values after downsampling.
+ *
+ * \note If y coordinates are not numeric, points are selected at a regular
+ * interval regardless of the method.
+ */
+[[nodiscard]] PLOTLY_PLOTTER_EXPORT std::vector<bool> downsample(
+    downsampling_method method, const data_column_base* x,
+    const data_column_base& y, const std::vector<bool>& parent_mask,
+    std::size_t max_points);
+
+}  // namespace plotly_plotter::figure_builders::details
@@ -22,6 +22,7 @@
 #include <cstddef>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 #include "plotly_plotter/figure.h"
@@ -41,6 +42,47 @@ void configure_axes_common(figure& fig, std::size_t num_subplot_rows,
     std::size_t num_subplot_columns, std::string_view x_title,
     std::string_view y_title);
 
+/*!
+ * \brief Remove attributes of traces in frames of animation which are the
+ * same in all frames.
+ *
+ * \param[in,out] fig Figure.
+ *
+ * \note Plotly merges attributes of traces in frames into the current traces,
+ * so attributes which are the same in the figure and all frames are not
+ * needed in frames.
+ * \note Nothing is removed if the numbers of traces differ among frames.
+ */
+void remove_constant_attributes_in_frames(figure& fig);
+
+/*!
+ * \brief Get the positions of rows selected by a mask among rows in a parent
+ * mask.
+ *
+ * \param[in] parent_mask Mask of rows in the parent layer (e.g., a trace).
+ * \param[in] mask Mask of selected rows. (Must be a subset of parent_mask.)
+ * \return Positions of the selected rows.
+ *
+ * \note These positions are the x coordinates which Plotly uses for traces
+ * without x coordinates when all rows in the parent mask are plotted.
+ */
+[[nodiscard]] std::vector<std::size_t> masked_row_positions(
+    const std::vector<bool>& parent_mask, const std::vector<bool>& mask);
+
+/*!
+ * \brief Combine indices of groups in two columns.
+ *
+ * \param[in] first_indices Indices of groups in the first column for rows.
+ * \param[in] second_indices Indices of groups in the second column for rows.
+ * \return Indices of the combined groups for rows, and the number of the
+ * combined groups.
+ *
+ * \note Combined groups are numbered in the order of their first rows.
+ */
+[[nodiscard]] std::pair<std::vector<std::size_t>, std::size_t>
+combine_group_indices(const std::vector<std::size_t>& first_indices,
+    const std::vector<std::size_t>& second_indices);
+
 /*!
  * \brief Add hover text to a trace.
  *
@@ -0,0 +1,287 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of group_accumulator class.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <thread>
+#include <vector>
+
+#include "plotly_plotter/figure_builders/aggregation_function.h"
+
+namespace plotly_plotter::figure_builders::details {
+
+/*!
+ * \brief Class of values accumulated in groups.
+ *
+ * \note Quantiles cannot be accumulated in a single pass, so only the numbers
+ * of values are accumulated for quantile.
+ */
+class group_accumulator {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] num_keys Number of keys.
+     * \param[in] function Function to aggregate values.
+     */
+    group_accumulator(std::size_t num_keys, aggregation_function function)
+        : function_(function),
+          values_(num_keys, initial_value(function)),
+          counts_(num_keys, 0) {}
+
+    /*!
+     * \brief Add a value.
+     *
+     * \param[in] key Key of the group.
+     * \param[in] value Value.
+     */
+    void add(std::size_t key, double value) noexcept {
+        ++counts_[key];
+        switch (function_) {
+        case aggregation_function::count:
+        case aggregation_function::quantile:
+            break;
+        case aggregation_function::sum:
+        case aggregation_function::average:
+            values_[key] += value;
+            break;
+        case aggregation_function::minimum:
+            values_[key] = std::min(values_[key], value);
+            break;
+        case aggregation_function::maximum:
+            values_[key] = std::max(values_[key], value);
+            break;
+        }
+    }
+
+    /*!
+     * \brief Merge values in another object.
+     *
+     * \param[in] other Another object.
+     */
+    void merge(const group_accumulator& other) noexcept {
+        for (std::size_t key = 0; key < counts_.size(); ++key) {
+            if (other.counts_[key] == 0) {
+                continue;
+            }
+            counts_[key] += other.counts_[key];
+            switch (function_) {
+            case aggregation_function::count:
+            case aggregation_function::quantile:
+                break;
+            case aggregation_function::sum:
+            case aggregation_function::average:
+                values_[key] += other.values_[key];
+                break;
+            case aggregation_function::minimum:
+                values_[key] = std::min(values_[key], other.values_[key]);
+                break;
+            case aggregation_function::maximum:
+                values_[key] = std::max(values_[key], other.values_[key]);
+                break;
+            }
+        }
+    }
+
+    /*!
+     * \brief Get the number of values in a group.
+     *
+     * \param[in] key Key of the group.
+     * \return Number of values.
+     */
+    [[nodiscard]] std::size_t count(std::size_t key) const noexcept {
+        return counts_[key];
+    }
+
+    /*!
+     * \brief Get the result in a group.
+     *
+     * \param[in] key Key of the group.
+     * \return Result. (NaN for groups without values except for count and
+     * sum, and always NaN for quantile.)
+     */
+    [[nodiscard]] double result(std::size_t key) const noexcept {
+        switch (function_) {
+        case aggregation_function::count:
+            return static_cast<double>(counts_[key]);
+        case aggregation_function::sum:
+            return values_[key];
+        case aggregation_function::average:
+            if (counts_[key] == 0) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            return values_[key] / static_cast<double>(counts_[key]);
+        case aggregation_function::minimum:
+        case aggregation_function::maximum:
+            if (counts_[key] == 0) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+            return values_[key];
+        case aggregation_function::quantile:
+            break;
+        }
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+private:
+    /*!
+     * \brief Get the initial value of groups.
+     *
+     * \param[in] function Function to aggregate values.
+     * \return Initial value.
+     */
+    [[nodiscard]] static double initial_value(
+        aggregation_function function) noexcept {
+        switch (function) {
+        case aggregation_function::minimum:
+            return std::numeric_limits<double>::infinity();
+        case aggregation_function::maximum:
+            return -std::numeric_limits<double>::infinity();
+        default:
+            return 0.0;
+        }
+    }
+
+    //! Function to aggregate values.
+    aggregation_function function_;
+
+    //! Accumulated values.
+    std::vector<double> values_;
+
+    //! Number of values.
+    std::vector<std::size_t> counts_;
+};
+
+/*!
+ * \brief Class to join threads on destruction.
+ *
+ * \note Threads are joined even when an exception is thrown while threads
+ * are running, because destruction of joinable threads terminates the
+ * process.
+ */
+class thread_joiner {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] threads Threads to join.
+     */
+    explicit thread_joiner(std::vector<std::thread>& threads) noexcept
+        : threads_(threads) {}
+
+    thread_joiner(const thread_joiner&) = delete;
+    thread_joiner(thread_joiner&&) = delete;
+    thread_joiner& operator=(const thread_joiner&) = delete;
+    thread_joiner& operator=(thread_joiner&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~thread_joiner() {
+        for (auto& thread : threads_) {
+            if (thread.joinable()) {
+                thread.join();
+            }
+        }
+    }
+
+private:
+    //! Threads to join.
+    std::vector<std::thread>& threads_;
+};
+
+/*!
+ * \brief Minimum number of values processed in a thread.
+ */
+constexpr std::size_t min_values_per_accumulation_thread = 65536;
+
+/*!
+ * \brief Accumulate values in groups using multiple threads for large inputs.
+ *
+ * \tparam Accumulate Type of the function to accumulate values.
+ * \param[in] num_keys Number of keys.
+ * \param[in] num_values Number of values.
+ * \param[in] function Function to aggregate values.
+ * \param[in] accumulate Function to accumulate values with indices in a range.
+ * (Called with a group_accumulator object, the first index, and the
+ * past-the-end index.)
+ * \return Accumulated values.
+ *
+ * \note Threads are used only when merging buffers of threads is cheaper than
+ * processing values.
+ * \note Exceptions thrown in threads are rethrown after all threads are
+ * joined.
+ */
+template <typename Accumulate>
+[[nodiscard]] group_accumulator accumulate_groups(std::size_t num_keys,
+    std::size_t num_values, aggregation_function function,
+    const Accumulate& accumulate) {
+    std::size_t num_threads =
+        std::min<std::size_t>(std::thread::hardware_concurrency(),
+            num_values / min_values_per_accumulation_thread);
+    if (num_keys > 0 && num_threads > num_values / num_keys) {
+        num_threads = num_values / num_keys;
+    }
+
+    group_accumulator accumulator(num_keys, function);
+    if (num_threads <= 1) {
+        accumulate(accumulator, 0, num_values);
+        return accumulator;
+    }
+
+    std::vector<group_accumulator> partial_results(
+        num_threads - 1, group_accumulator(num_keys, function));
+    std::vector<std::exception_ptr> exceptions(num_threads - 1);
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads - 1);
+    {
+        thread_joiner joiner(threads);
+        const std::size_t values_per_thread = num_values / num_threads;
+        for (std::size_t i = 0; i + 1 < num_threads; ++i) {
+            const std::size_t begin = (i + 1) * values_per_thread;
+            const std::size_t end = (i + 2 < num_threads)
+                ? (i + 2) * values_per_thread
+                : num_values;
+            threads.emplace_back([&accumulate, &partial_results, &exceptions,
+                                     i, begin, end] {
+                try {
+                    accumulate(partial_results[i], begin, end);
+                } catch (...) {
+                    exceptions[i] = std::current_exception();
+                }
+            });
+        }
+        accumulate(accumulator, 0, values_per_thread);
+    }
+    for (const auto& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+    for (const auto& partial_result : partial_results) {
+        accumulator.merge(partial_result);
+    }
+    return accumulator;
+}
+
+}  // namespace plotly_plotter::figure_builders::details
@@ -0,0 +1,64 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of internal functions to aggregate values in groups.
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "plotly_plotter/details/plotly_plotter_export.h"
+#include "plotly_plotter/figure_builders/aggregation_function.h"
+
+namespace plotly_plotter::figure_builders::details {
+
+/*!
+ * \brief Struct of values aggregated in groups.
+ */
+struct group_aggregation_result {
+    //! Keys of groups with values in the ascending order.
+    std::vector<std::size_t> keys;
+
+    //! Aggregated values of the groups.
+    std::vector<double> values;
+};
+
+/*!
+ * \brief Aggregate values in groups.
+ *
+ * \param[in] keys Keys of groups of values. (Smaller than num_keys.)
+ * \param[in] num_keys Number of keys.
+ * \param[in] values Values to aggregate. (Ignored for count if empty.)
+ * \param[in] function Function to aggregate values.
+ * \param[in] quantile_probability Probability of the quantile.
+ * (Used only for quantile.)
+ * \return Aggregated values.
+ *
+ * \note NaN values are ignored, and groups without values are not included
+ * in the result.
+ * \note Functions other than quantile process values in a single pass using
+ * multiple threads for large inputs, and partial results of threads are
+ * merged.
+ * \note Quantiles are defined as in \ref select_quantile function.
+ */
+[[nodiscard]] PLOTLY_PLOTTER_EXPORT group_aggregation_result aggregate_groups(
+    const std::vector<std::size_t>& keys, std::size_t num_keys,
+    const std::vector<double>& values, aggregation_function function,
+    double quantile_probability = 0.5);
+
+}  // namespace plotly_plotter::figure_builders::details
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Declaration of internal functions of 2D histograms.
+ */
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "plotly_plotter/data_column.h"
+#include "plotly_plotter/details/plotly_plotter_export.h"
+#include "plotly_plotter/figure_builders/aggregation_function.h"
+#include "plotly_plotter/utils/calculate_histogram_bin_width.h"
+
+namespace plotly_plotter::figure_builders::details {
+
+/*!
+ * \brief Maximum number of bins in an axis of 2D histograms.
+ */
+constexpr std::size_t max_histogram_2d_bins = 1000;
+
+/*!
+ * \brief Struct of bins in an axis of histograms.
+ */
+struct histogram_axis {
+    //! Minimum value. (Logarithm of the value in log scale.)
+    double min{0.0};
+
+    //! Width of bins. (Width in logarithm of values in log scale.)
+    double bin_width{1.0};
+
+    //! Number of bins.
+    std::size_t num_bins{1};
+
+    //! Whether to use log scale.
+    bool log_scale{false};
+
+    /*!
+     * \brief Get the index of the bin of a value.
+     *
+     * \param[in] value Value.
+     * \return Index of the bin. (\ref num_bins if the value is out of bins.)
+     */
+    [[nodiscard]] std::size_t bin_index(double value) const noexcept;
+
+    /*!
+     * \brief Get the edges of bins.
+     *
+     * \return Edges of bins. (The size is \ref num_bins + 1.)
+     */
+    [[nodiscard]] std::vector<double> edges() const;
+};
+
+/*!
+ * \brief Create bins in an axis of histograms.
+ *
+ * \param[in] column Column of values.
+ * \param[in] log_scale Whether to use log scale.
+ * \param[in] fixed_bin_width Fixed width of bins.
+ * (Null to calculate using the method.)
+ * \param[in] method Method to calculate the width of bins.
+ * \param[in] max_bins Maximum number of bins.
+ * \return Bins.
+ *
+ * \note In log scale, bins are created in logarithm of positive values,
+ * and the fixed width of bins is also interpreted in logarithm.
+ * \note The width of bins is widened when the number of bins exceeds the
+ * maximum number of bins.
+ */
+[[nodiscard]] PLOTLY_PLOTTER_EXPORT histogram_axis create_histogram_axis(
+    const data_column_base& column, bool log_scale,
+    std::optional<double> fixed_bin_width,
+    utils::histogram_bin_width_method method,
+    std::size_t max_bins = max_histogram_2d_bins);
+
+/*!
+ * \brief Compute a 2D histogram.
+ *
+ * \param[in] x_axis Bins in x-axis.
+ * \param[in] y_axis Bins in y-axis.
+ * \param[in] x Values in x-axis.
+ * \param[in] y Values in y-axis.
+ * \param[in] z Values to aggregate. (Ignored for count.)
+ * \param[in] function Function to aggregate values in bins.
+ * (Quantile is not supported.)
+ * \return Aggregated values in a 2D array.
+ * (The outer dimension is y and the inner dimension is x.
+ * NaN for bins without values except for count and sum.)
+ *
+ * \note Values are processed in a single pass using multiple threads for
+ * large inputs.
+ */
+[[nodiscard]] PLOTLY_PLOTTER_EXPORT std::vector<std::vector<double>>
+compute_histogram_2d(const histogram_axis& x_axis,
+    const histogram_axis& y_axis, const std::vector<double>& x,
+    const std::vector<double>& y, const std::vector<double>& z,
+    aggregation_function function);
+
+}  // namespace plotly_plotter::figure_builders::details
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Declaration of estimate_kernel_density function.
+ */
+#pragma once
+
+#include <vector>
+
+#include "plotly_plotter/details/plotly_plotter_export.h"
+#include "plotly_plotter/figure_builders/details/box_statistics.h"
+
+namespace plotly_plotter::figure_builders::details {
+
+/*!
+ * \brief Struct of results of kernel density estimation.
+ */
+struct kernel_density {
+    //! Bandwidth of the kernel. (Zero if all values are the same.)
+    double bandwidth;
+
+    //! Positions at which densities are evaluated in ascending order.
+    std::vector<double> positions;
+
+    //! Densities.
+    std::vector<double> densities;
+};
+
+/*!
+ * \brief Estimate the density of values using Gaussian kernels.
+ *
+ * \param[in] values Values. (NaN must be removed.)
+ * \param[in] statistics Statistics of the values.
+ * \return Result.
+ *
+ * \note The bandwidth and the positions are determined in the same way as
+ * violin traces in plotly.js with the default settings
+ * (Silverman's rule of thumb and `spanmode` set to `"soft"`).
+ * \note Values are linearly binned at the positions, and densities are
+ * calculated by convolution of the bins with a truncated kernel.
+ * Because the interval of the positions is a third of the bandwidth,
+ * the calculation takes linear time in the number of values.
+ */
+[[nodiscard]] PLOTLY_PLOTTER_EXPORT kernel_density estimate_kernel_density(
+    const std::vector<double>& values, const box_statistics& statistics);
+
+}  // namespace plotly_plotter::figure_builders::details
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Declaration of select_quantile function.
+ */
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "plotly_plotter/details/plotly_plotter_export.h"
+
+namespace plotly_plotter::figure_builders::details {
+
+/*!
+ * \brief Select a quantile of values.
+ *
+ * Quantiles are defined as in the linear method of plotly.js
+ * (`quartilemethod` set to `"linear"`):
+ * for \f$ n \f$ values sorted in the ascending order, the quantile of a
+ * probability \f$ p \f$ is the value at the position \f$ p n - 0.5 \f$
+ * clamped to \f$ [0, n - 1] \f$, linearly interpolated between the closest
+ * values.
+ *
+ * \param[in,out] begin Iterator to the first value. (Values are reordered.)
+ * \param[in,out] end Iterator to the past-the-end value.
+ * \param[in] probability Probability of the quantile in \f$ [0, 1] \f$.
+ * \param[in,out] num_ordered_values Number of the first values not greater than
+ * the other values. This is updated so that quantiles of larger probabilities
+ * are selected only in the remaining values.
+ * \return Quantile.
+ *
+ * \note Quantiles are selected by a selection algorithm in linear time without
+ * sorting the values.
+ * \note Values must not be empty and must not contain NaN.
+ */
+[[nodiscard]] PLOTLY_PLOTTER_EXPORT double select_quantile(
+    std::vector<double>::iterator begin, std::vector<double>::iterator end,
+    double probability, std::size_t& num_ordered_values);
+
+/*!
+ * \brief Select a quantile of values.
+ *
+ * \param[in,out] begin Iterator to the first value. (Values are reordered.)
+ * \param[in,out] end Iterator to the past-the-end value.
+ * \param[in] probability Probability of the quantile in \f$ [0, 1] \f$.
+ * \return Quantile.
+ *
+ * \note Quantiles are defined as in the other overload of this function.
+ */
+[[nodiscard]] inline double select_quantile(std::vector<double>::iterator begin,
+    std::vector<double>::iterator end, double probability) {
+    std::size_t num_ordered_values = 0;
+    return select_quantile(begin, end, probability, num_ordered_values);
+}
+
+}  // namespace plotly_plotter::figure_builders::details
@@ -20,6 +20,7 @@
 #pragma once
 
 #include <cstddef>
+#include <functional>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -28,9 +29,48 @@
 #include "plotly_plotter/data_table.h"
 #include "plotly_plotter/details/plotly_plotter_export.h"
 #include "plotly_plotter/figure.h"
+#include "plotly_plotter/figure_prototype.h"
+#include "plotly_plotter/io/output_sink.h"
+#include "plotly_plotter/json_document.h"
 
 namespace plotly_plotter::figure_builders {
 
+/*!
+ * \brief Enumeration of policies when the number of rows in data exceeds the
+ * budget of figures.
+ */
+enum class row_budget_policy {
+    //! Throw an exception before creating the figure.
+    throw_error,
+
+    /*!
+     * \brief Plot rows selected at a regular interval in each trace within
+     * the budget.
+     *
+     * \note Figure builders aggregating values in rows (e.g., histograms)
+     * throw an exception instead, because values like counts change with
+     * the number of rows.
+     */
+    downsample
+};
+
+/*!
+ * \brief Enumeration of methods to downsample points in each trace.
+ */
+enum class downsampling_method {
+    //! Plot all points.
+    none,
+
+    //! Largest-Triangle-Three-Buckets (LTTB) algorithm.
+    lttb,
+
+    //! Points with the minimum and maximum y values in each bucket of x.
+    min_max,
+
+    //! Points selected at a regular interval.
+    every_nth
+};
+
 /*!
  * \brief Base class to create figures.
  *
@@ -47,6 +87,46 @@ public:
      */
     [[nodiscard]] figure create() const;
 
+    /*!
+     * \brief Create a figure from a prototype.
+     *
+     * \param[in] prototype Prototype of the figure.
+     * \return Figure.
+     *
+     * \note Configurations in the prototype which are not set by this
+     * builder (e.g., templates and configurations) are kept in the figure.
+     */
+    [[nodiscard]] figure create(const figure_prototype& prototype) const;
+
+    /*!
+     * \brief Create a figure and write it to an HTML file writing frames of
+     * animation one by one.
+     *
+     * \param[in] file_path File path.
+     *
+     * \copydetails write_html_to
+     * \note The figure is written to a temporary file in the same directory
+     * and the file is renamed to the given path after all frames are written,
+     * so the file at the given path is not changed when this function throws
+     * an exception.
+     */
+    void write_html(const std::string& file_path) const;
+
+    /*!
+     * \brief Create a figure and write it in HTML to a sink writing frames of
+     * animation one by one.
+     *
+     * \param[in] sink Sink.
+     *
+     * \note Each frame of animation is written as soon as it is created and
+     * released before creating the next frame, so the memory used for frames
+     * is bounded by a frame even for long animations.
+     * \note Attributes constant among frames are not removed from frames
+     * even if the removal is enabled, because frames are written before all
+     * frames are created.
+     */
+    void write_html_to(io::output_sink& sink) const;
+
     figure_builder_base& operator=(const figure_builder_base&) = delete;
     figure_builder_base& operator=(figure_builder_base&&) = delete;
 
@@ -118,6 +198,38 @@ protected:
      */
     void set_title(std::string value);
 
+    /*!
+     * \brief Set the budget of the number of rows in the data plotted in the
+     * figure.
+     *
+     * \param[in] max_rows Maximum number of rows. (0 for no limit.)
+     * \param[in] policy Policy when the number of rows exceeds the budget.
+     */
+    void set_row_budget(std::size_t max_rows, row_budget_policy policy);
+
+    /*!
+     * \brief Set whether to remove attributes of traces constant among
+     * frames of animation from the frames.
+     *
+     * \param[in] value Value.
+     */
+    void set_remove_constant_frame_attributes(bool value);
+
+    /*!
+     * \brief Set whether to replace uniformly spaced coordinates with
+     * `x0`, `dx`, `y0`, and `dy`.
+     *
+     * \param[in] value Value.
+     */
+    void set_compress_uniform_coordinates(bool value);
+
+    /*!
+     * \brief Set whether to store arrays repeated in the figure only once.
+     *
+     * \param[in] value Value.
+     */
+    void set_share_repeated_arrays(bool value);
+
     /*!
      * \brief Get the data.
      *
@@ -125,6 +237,48 @@ protected:
      */
     [[nodiscard]] const data_table& data() const noexcept;
 
+    /*!
+     * \brief Get the column name of groups.
+     *
+     * \return Column name of groups. (Empty if groups are not used.)
+     */
+    [[nodiscard]] const std::string& group_column() const noexcept;
+
+    /*!
+     * \brief Get the indices of traces of rows.
+     *
+     * \return Indices of traces for rows.
+     *
+     * \note Rows with the same values in the columns of groups, subplots,
+     * and frames of animation have the same index, so values can be
+     * aggregated in all traces at once using these indices.
+     */
+    [[nodiscard]] std::vector<std::size_t> trace_indices_of_rows() const;
+
+    /*!
+     * \brief Check whether rows are thinned to keep the row budget.
+     *
+     * \retval true Rows are thinned.
+     * \retval false All rows are plotted.
+     */
+    [[nodiscard]] bool is_thinned_by_row_budget() const noexcept;
+
+    /*!
+     * \brief Select rows in a trace plotted within the row budget.
+     *
+     * \param[in] trace_mask Mask of rows in the trace.
+     * \return Mask of rows to plot.
+     *
+     * \note The budget is divided among traces in proportion to the numbers
+     * of rows, and at least one row is kept in each trace with rows, so that
+     * no group, subplot, or frame disappears.
+     * \note Traces without x coordinates in data must write the positions of
+     * the selected rows in the trace as x coordinates when rows are thinned,
+     * otherwise Plotly places the remaining points at consecutive positions.
+     */
+    [[nodiscard]] std::vector<bool> apply_row_budget(
+        const std::vector<bool>& trace_mask) const;
+
     /*!
      * \brief Configure the axes.
      *
@@ -171,7 +325,33 @@ protected:
     [[nodiscard]] virtual std::vector<std::string>
     additional_hover_data_in_trace() const = 0;
 
+    /*!
+     * \brief Check whether rows can be thinned by
+     * \ref row_budget_policy::downsample policy.
+     *
+     * \retval true Rows can be thinned in \ref add_trace function using
+     * \ref apply_row_budget function.
+     * \retval false Rows can't be thinned, because values in rows are
+     * aggregated.
+     */
+    [[nodiscard]] virtual bool supports_row_downsampling() const noexcept;
+
 private:
+    //! Type of functions to write frames of animation.
+    using frame_writer = std::function<void(const json_document&)>;
+
+    /*!
+     * \brief Create a figure.
+     *
+     * \param[in] prototype Prototype of the figure. (Null to use the default
+     * figure.)
+     * \param[in] write_frame Function to write frames of animation.
+     * (Empty to add frames to the figure.)
+     * \return Figure.
+     */
+    [[nodiscard]] figure create_from(const figure_prototype* prototype,
+        const frame_writer& write_frame = frame_writer()) const;
+
     /*!
      * \brief Handle animation frames.
      *
@@ -179,12 +359,15 @@ private:
      * \param[in] parent_mask Mask of the values in the parent layer.
      * \param[in] hover_prefix Prefix of the hover text.
      * \param[in] additional_hover_text Additional hover text.
+     * \param[in] write_frame Function to write frames of animation.
+     * (Empty to add frames to the figure.)
      * \return Number of rows and columns of subplots.
      */
     [[nodiscard]] std::pair<std::size_t, std::size_t> handle_animation_frame(
         figure& fig, const std::vector<bool>& parent_mask,
         std::string_view hover_prefix,
-        const std::vector<std::string>& additional_hover_text) const;
+        const std::vector<std::string>& additional_hover_text,
+        const frame_writer& write_frame) const;
 
     /*!
      * \brief Handle rows in subplots.
@@ -242,6 +425,14 @@ private:
     void configure_figure(figure& fig, std::size_t num_subplot_rows,
         std::size_t num_subplot_columns) const;
 
+    /*!
+     * \brief Check the number of rows against the budget.
+     *
+     * \note This function throws std::runtime_error when the number of rows
+     * exceeds the budget and the rows can't be thinned.
+     */
+    void check_row_budget() const;
+
     /*!
      * \brief Generate additional hover text.
      *
@@ -270,6 +461,22 @@ private:
 
     //! Title of the figure.
     std::string title_;
+
+    //! Maximum number of rows plotted in the figure. (0 for no limit.)
+    std::size_t max_rows_{0};
+
+    //! Policy when the number of rows exceeds the budget.
+    row_budget_policy row_budget_policy_{
+        row_budget_policy::throw_error};
+
+    //! Whether to remove attributes constant among frames from the frames.
+    bool remove_constant_frame_attributes_{false};
+
+    //! Whether to replace uniformly spaced coordinates with offsets and steps.
+    bool compress_uniform_coordinates_{false};
+
+    //! Whether to store arrays repeated in the figure only once.
+    bool share_repeated_arrays_{false};
 };
 
 }  // namespace plotly_plotter::figure_builders
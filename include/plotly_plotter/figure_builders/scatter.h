@@ -44,6 +44,9 @@ namespace plotly_plotter::figure_builders {
  */
 class PLOTLY_PLOTTER_EXPORT scatter final : public figure_builder_base {
 public:
+    //! Default width of figures in pixels used in downsampling.
+    static constexpr std::size_t default_downsampling_width = 1920;
+
     /*!
      * \brief Constructor.
      *
@@ -271,6 +274,68 @@ public:
      */
     scatter& title(std::string value);
 
+    /*!
+     * \brief Set the budget of the number of rows in the data plotted in the
+     * figure.
+     *
+     * \param[in] max_rows Maximum number of rows. (0 for no limit.)
+     * \param[in] policy Policy when the number of rows exceeds the budget.
+     * \return This object.
+     *
+     * \note The budget is checked against the number of rows in the data
+     * table, not the number of values written to the figure.
+     */
+    scatter& row_budget(std::size_t max_rows,
+        row_budget_policy policy = row_budget_policy::throw_error);
+
+    /*!
+     * \brief Set whether to remove attributes of traces constant among
+     * frames of animation from the frames.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     *
+     * \note Removing the attributes reduces the size of figures with many
+     * frames. Plotly takes the removed attributes from the traces of the
+     * figure when switching frames.
+     */
+    scatter& remove_constant_frame_attributes(bool value);
+
+    /*!
+     * \brief Set whether to replace uniformly spaced coordinates with
+     * `x0`, `dx`, `y0`, and `dy`.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     */
+    scatter& compress_uniform_coordinates(bool value);
+
+    /*!
+     * \brief Set whether to store arrays repeated in the figure only once.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     *
+     * \note HTML files written by this library restore the arrays, but
+     * other programs reading JSON of figures need to restore them
+     * themselves.
+     */
+    scatter& share_repeated_arrays(bool value);
+
+    /*!
+     * \brief Set the method to downsample points in each trace.
+     *
+     * \param[in] method Method of downsampling.
+     * \param[in] width Width of the figure in pixels.
+     * \return This object.
+     *
+     * \note Points are downsampled for each trace after grouping,
+     * so that each trace has at most twice as many points as the width
+     * (two points per pixel).
+     */
+    scatter& downsampling(downsampling_method method,
+        std::size_t width = default_downsampling_width);
+
 private:
     //! Enumeration of modes of coloring.
     enum class color_mode : std::uint8_t {
@@ -311,12 +376,16 @@ private:
         std::string_view hover_prefix,
         const std::vector<std::string>& additional_hover_text) const override;
 
+    //! \copydoc figure_builder_base::supports_row_downsampling
+    [[nodiscard]] bool supports_row_downsampling() const noexcept override;
+
     /*!
      * \brief Configure a trace.
      *
      * \tparam Trace Type of the trace.
      * \param[out] scatter Scatter trace to configure.
-     * \param[in] parent_mask Mask of the values in the parent layer.
+     * \param[in] parent_mask Mask of the values plotted in the trace.
+     * \param[in] trace_mask Mask of all rows in the trace before thinning.
      * \param[in] subplot_index Index of the subplot.
      * \param[in] group_name Name of the group.
      * \param[in] group_index Index of the group.
@@ -325,8 +394,9 @@ private:
      */
     template <typename Trace>
     void configure_trace(Trace& scatter, const std::vector<bool>& parent_mask,
-        std::size_t subplot_index, std::string_view group_name,
-        std::size_t group_index, std::string_view hover_prefix,
+        const std::vector<bool>& trace_mask, std::size_t subplot_index,
+        std::string_view group_name, std::size_t group_index,
+        std::string_view hover_prefix,
         const std::vector<std::string>& additional_hover_text) const;
 
     //! \copydoc figure_builder_base::additional_hover_data_in_trace
@@ -389,6 +459,12 @@ private:
 
     //! Whether to use WebGL.
     std::optional<bool> use_web_gl_;
+
+    //! Method of downsampling.
+    downsampling_method downsampling_method_{downsampling_method::none};
+
+    //! Maximum number of points in each trace after downsampling.
+    std::size_t max_downsampled_points_{2 * default_downsampling_width};
 };
 
 }  // namespace plotly_plotter::figure_builders
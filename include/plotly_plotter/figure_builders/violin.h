@@ -172,6 +172,26 @@ public:
      */
     violin& points(std::string value);
 
+    /*!
+     * \brief Set whether to precompute densities of violins.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     *
+     * If true, densities are estimated in this library using the same
+     * bandwidth as plotly.js, and violins are written as filled shapes of
+     * scatter traces with precomputed boxes and mean lines, instead of violin
+     * traces with all values of y coordinates.
+     * The size of figures doesn't depend on the number of rows in this mode,
+     * except for points shown according to \ref points.
+     *
+     * \note Violins in different groups are placed side by side when x
+     * coordinates are set, and the x-axis is a linear axis with labels of
+     * categories.
+     * \note Additional data in hovers are not shown in this mode.
+     */
+    violin& precompute_density(bool value);
+
     /*!
      * \brief Set whether to use log scale in y-axis.
      *
@@ -188,6 +208,45 @@ public:
      */
     violin& title(std::string value);
 
+    /*!
+     * \brief Set the budget of the number of rows in the data plotted in the
+     * figure.
+     *
+     * \param[in] max_rows Maximum number of rows. (0 for no limit.)
+     * \param[in] policy Policy when the number of rows exceeds the budget.
+     * \return This object.
+     *
+     * \note The budget is checked against the number of rows in the data
+     * table, not the number of values written to the figure.
+     */
+    violin& row_budget(std::size_t max_rows,
+        row_budget_policy policy = row_budget_policy::throw_error);
+
+    /*!
+     * \brief Set whether to remove attributes of traces constant among
+     * frames of animation from the frames.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     *
+     * \note Removing the attributes reduces the size of figures with many
+     * frames. Plotly takes the removed attributes from the traces of the
+     * figure when switching frames.
+     */
+    violin& remove_constant_frame_attributes(bool value);
+
+    /*!
+     * \brief Set whether to store arrays repeated in the figure only once.
+     *
+     * \param[in] value Value.
+     * \return This object.
+     *
+     * \note HTML files written by this library restore the arrays, but
+     * other programs reading JSON of figures need to restore them
+     * themselves.
+     */
+    violin& share_repeated_arrays(bool value);
+
 private:
     //! Enumeration of modes of coloring.
     enum class color_mode : std::uint8_t {
@@ -216,10 +275,43 @@ private:
         std::string_view hover_prefix,
         const std::vector<std::string>& additional_hover_text) const override;
 
+    /*!
+     * \brief Get the color of a group.
+     *
+     * \param[in] group_name Name of the group.
+     * \param[in] group_index Index of the group.
+     * \return Color.
+     */
+    [[nodiscard]] const std::string& color_of(
+        std::string_view group_name, std::size_t group_index) const;
+
+    /*!
+     * \brief Prepare positions of violins with precomputed densities.
+     */
+    void prepare_violin_positions() const;
+
+    /*!
+     * \brief Add traces of violins with precomputed densities.
+     *
+     * \param[in] figure Figure.
+     * \param[in] mask Mask of rows in the violins.
+     * \param[in] subplot_index Index of the subplot.
+     * \param[in] group_name Name of the group.
+     * \param[in] group_index Index of the group.
+     * \param[in] hover_prefix Prefix of hover text.
+     */
+    void add_precomputed_density(figure_frame_base& figure,
+        const std::vector<bool>& mask, std::size_t subplot_index,
+        std::string_view group_name, std::size_t group_index,
+        std::string_view hover_prefix) const;
+
     //! \copydoc figure_builder_base::additional_hover_data_in_trace
     [[nodiscard]] std::vector<std::string> additional_hover_data_in_trace()
         const override;
 
+    //! \copydoc figure_builder_base::supports_row_downsampling
+    [[nodiscard]] bool supports_row_downsampling() const noexcept override;
+
     //! Color sequence.
     std::vector<std::string> color_sequence_{color_sequence_plotly()};
 
@@ -249,6 +341,21 @@ private:
 
     //! Whether to use log scale in y-axis.
     bool log_y_{false};
+
+    //! Whether to precompute densities of violins.
+    bool precompute_density_{false};
+
+    //! Whether positions of violins are prepared.
+    mutable bool violin_positions_prepared_{false};
+
+    //! Labels of positions of violins with precomputed densities.
+    mutable std::vector<std::string> violin_position_labels_;
+
+    //! Indices of positions of violins for each row. (Used with x.)
+    mutable std::vector<std::size_t> violin_position_indices_;
+
+    //! Number of groups. (Zero if groups are not used.)
+    mutable std::size_t num_groups_{0};
 };
 
 }  // namespace plotly_plotter::figure_builders
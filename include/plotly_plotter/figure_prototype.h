@@ -0,0 +1,71 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of figure_prototype class.
+ */
+#pragma once
+
+#include <utility>
+
+#include "plotly_plotter/figure.h"
+
+namespace plotly_plotter {
+
+/*!
+ * \brief Class of prototypes of figures.
+ *
+ * This class holds a figure configured once (e.g., layouts, templates,
+ * and configurations), and creates copies of the figure.
+ * Copying a figure costs less than configuring a new figure,
+ * so this class is useful to create many figures with the same
+ * configurations.
+ *
+ * \note Functions of this class can be called from multiple threads at once,
+ * because they don't modify the prototype.
+ */
+class figure_prototype {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] prototype Figure used as the prototype.
+     */
+    explicit figure_prototype(figure prototype)
+        : prototype_(std::move(prototype)) {}
+
+    /*!
+     * \brief Create a figure copying the prototype.
+     *
+     * \return Created figure.
+     */
+    [[nodiscard]] figure create() const { return prototype_.clone(); }
+
+    /*!
+     * \brief Get the prototype.
+     *
+     * \return Prototype.
+     */
+    [[nodiscard]] const figure& prototype() const noexcept {
+        return prototype_;
+    }
+
+private:
+    //! Prototype.
+    figure prototype_;
+};
+
+}  // namespace plotly_plotter
@@ -0,0 +1,93 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of executable_check_cache class.
+ */
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace plotly_plotter::io::details {
+
+/*!
+ * \brief Class of caches of results of checks of executables.
+ *
+ * Checks of executables run subprocesses, which take long time
+ * (about 1 second for Playwright).
+ * This class runs a check only once for each path of an executable.
+ *
+ * \note This class is thread-safe.
+ * Checks are serialized so that concurrent calls don't run the same check
+ * twice.
+ */
+class executable_check_cache {
+public:
+    /*!
+     * \brief Constructor.
+     */
+    executable_check_cache() = default;
+
+    executable_check_cache(const executable_check_cache&) = delete;
+    executable_check_cache(executable_check_cache&&) = delete;
+    executable_check_cache& operator=(const executable_check_cache&) = delete;
+    executable_check_cache& operator=(executable_check_cache&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~executable_check_cache() = default;
+
+    /*!
+     * \brief Check an executable using the cache.
+     *
+     * \tparam Checker Type of the function to check the executable.
+     * \param[in] path Path of the executable.
+     * \param[in] checker Function to check the executable.
+     * This is called with the path only when the result is not cached.
+     * \return Result of the check.
+     */
+    template <typename Checker>
+    [[nodiscard]] bool check(const std::string& path, Checker&& checker) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        const auto iter = results_.find(path);
+        if (iter != results_.end()) {
+            return iter->second;
+        }
+        const bool result = checker(path);
+        results_.try_emplace(path, result);
+        return result;
+    }
+
+    /*!
+     * \brief Clear the cached results.
+     */
+    void clear() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        results_.clear();
+    }
+
+private:
+    //! Mutex of checks and member variables.
+    std::mutex mutex_;
+
+    //! Results of checks.
+    std::unordered_map<std::string, bool> results_;
+};
+
+}  // namespace plotly_plotter::io::details
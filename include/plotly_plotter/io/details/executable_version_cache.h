@@ -0,0 +1,91 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of executable_version_cache class.
+ */
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace plotly_plotter::io::details {
+
+/*!
+ * \brief Class of caches of versions of executables.
+ *
+ * Versions of executables are got by running subprocesses,
+ * so this class runs them only once for each path of an executable.
+ *
+ * \note This class is thread-safe.
+ */
+class executable_version_cache {
+public:
+    /*!
+     * \brief Constructor.
+     */
+    executable_version_cache() = default;
+
+    executable_version_cache(const executable_version_cache&) = delete;
+    executable_version_cache(executable_version_cache&&) = delete;
+    executable_version_cache& operator=(
+        const executable_version_cache&) = delete;
+    executable_version_cache& operator=(executable_version_cache&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~executable_version_cache() = default;
+
+    /*!
+     * \brief Get the version of an executable using the cache.
+     *
+     * \tparam Getter Type of the function to get the version.
+     * \param[in] path Path of the executable.
+     * \param[in] getter Function to get the version.
+     * This is called with the path only when the result is not cached.
+     * \return Version.
+     */
+    template <typename Getter>
+    [[nodiscard]] std::string get(const std::string& path, Getter&& getter) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        const auto iter = versions_.find(path);
+        if (iter != versions_.end()) {
+            return iter->second;
+        }
+        std::string version = getter(path);
+        versions_.try_emplace(path, version);
+        return version;
+    }
+
+    /*!
+     * \brief Clear the cached versions.
+     */
+    void clear() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        versions_.clear();
+    }
+
+private:
+    //! Mutex of member variables.
+    std::mutex mutex_;
+
+    //! Versions.
+    std::unordered_map<std::string, std::string> versions_;
+};
+
+}  // namespace plotly_plotter::io::details
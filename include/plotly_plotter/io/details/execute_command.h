@@ -19,6 +19,7 @@
  */
 #pragma once
 
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -34,21 +35,36 @@ namespace plotly_plotter::io::details {
  * \retval true Command executed successfully.
  * \retval false Command failed.
  *
- * \note This function throws exceptions only when a system call fails.
+ * \note This function throws exceptions only when a system call fails or the
+ * command exceeds the timeout set by \ref io::set_subprocess_timeout.
  * \note This function returns false when command execution in the environment
  * is not supported by this library.
  */
 [[nodiscard]] PLOTLY_PLOTTER_EXPORT bool check_command_success(
     const std::vector<std::string>& command, bool capture_logs = true);
 
+/*!
+ * \brief Execute a command and get its output.
+ *
+ * \param[in] command Command.
+ * \return Output of the command (standard output and standard error),
+ * or null if the command failed.
+ *
+ * \note This function throws exceptions only when a system call fails or the
+ * command exceeds the timeout set by \ref io::set_subprocess_timeout.
+ */
+[[nodiscard]] PLOTLY_PLOTTER_EXPORT std::optional<std::string>
+capture_command_output(const std::vector<std::string>& command);
+
 /*!
  * \brief Execute a command.
  *
  * \param[in] command Command.
  * \param[in] capture_logs Whether to capture logs.
  *
- * \note This function throws exceptions when the command fails or a system call
- * fails.
+ * \note This function throws exceptions when the command fails, a system call
+ * fails, or the command exceeds the timeout set by
+ * \ref io::set_subprocess_timeout.
  */
 PLOTLY_PLOTTER_EXPORT void execute_command(
     const std::vector<std::string>& command, bool capture_logs = true);
@@ -0,0 +1,83 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of sha256_hasher class.
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "plotly_plotter/details/plotly_plotter_export.h"
+
+namespace plotly_plotter::io::details {
+
+/*!
+ * \brief Class to calculate SHA-256 hashes.
+ *
+ * \note This hash is used for names of cached files, because results must be
+ * the same in all environments and collisions must not happen in practice.
+ */
+class PLOTLY_PLOTTER_EXPORT sha256_hasher {
+public:
+    /*!
+     * \brief Constructor.
+     */
+    sha256_hasher() noexcept;
+
+    /*!
+     * \brief Add data.
+     *
+     * \param[in] data Data.
+     */
+    void add(std::string_view data) noexcept;
+
+    /*!
+     * \brief Finish the calculation and get the hash in hexadecimal.
+     *
+     * \return Hash in 64 lower-case hexadecimal characters.
+     *
+     * \note No data can be added after this function is called.
+     */
+    [[nodiscard]] std::string finish();
+
+private:
+    /*!
+     * \brief Process a block in the buffer.
+     */
+    void process_block() noexcept;
+
+    //! Number of bytes in a block.
+    static constexpr std::size_t block_size = 64;
+
+    //! Internal state.
+    std::array<std::uint32_t, 8> state_;
+
+    //! Buffer of a block.
+    std::array<std::uint8_t, block_size> block_{};
+
+    //! Number of bytes in the buffer.
+    std::size_t block_used_{0};
+
+    //! Total number of bytes added.
+    std::uint64_t total_size_{0};
+};
+
+}  // namespace plotly_plotter::io::details
@@ -0,0 +1,180 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of export_executor class.
+ */
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "plotly_plotter/details/plotly_plotter_export.h"
+
+namespace plotly_plotter::io {
+
+/*!
+ * \brief Class of executors of jobs to export figures in background.
+ *
+ * This class runs jobs in a fixed number of worker threads.
+ * Jobs waiting for workers are stored in a bounded queue,
+ * and submission of jobs blocks while the queue is full (backpressure).
+ *
+ * \note This class is thread-safe.
+ */
+class PLOTLY_PLOTTER_EXPORT export_executor {
+public:
+    //! Type of functions of jobs.
+    using job_function = std::function<void()>;
+
+    /*!
+     * \brief Get the default instance.
+     *
+     * \return The default instance.
+     *
+     * \note The default instance uses default_num_threads() threads and
+     * a queue with the capacity of default_queue_capacity() jobs.
+     */
+    [[nodiscard]] static export_executor& get_instance();
+
+    /*!
+     * \brief Get the default number of worker threads.
+     *
+     * \return Number of worker threads.
+     */
+    [[nodiscard]] static std::size_t default_num_threads() noexcept;
+
+    /*!
+     * \brief Get the default capacity of the queue of jobs.
+     *
+     * \return Capacity of the queue.
+     */
+    [[nodiscard]] static std::size_t default_queue_capacity() noexcept;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] num_threads Number of worker threads.
+     * \param[in] queue_capacity Maximum number of jobs waiting for workers.
+     */
+    export_executor(std::size_t num_threads, std::size_t queue_capacity);
+
+    export_executor(const export_executor&) = delete;
+    export_executor(export_executor&&) = delete;
+    export_executor& operator=(const export_executor&) = delete;
+    export_executor& operator=(export_executor&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     *
+     * \note This function cancels jobs in the queue and waits for running
+     * jobs.
+     */
+    ~export_executor();
+
+    /*!
+     * \brief Submit a job.
+     *
+     * \param[in] function Function of the job.
+     * \return Future of the result of the job.
+     *
+     * \note This function blocks while the queue is full.
+     * \note Exceptions thrown in the job are rethrown from the future.
+     */
+    [[nodiscard]] std::future<void> submit(job_function function);
+
+    /*!
+     * \brief Submit a job if the queue is not full.
+     *
+     * \param[in] function Function of the job.
+     * \return Future of the result of the job,
+     * or `std::nullopt` if the queue is full.
+     */
+    [[nodiscard]] std::optional<std::future<void>> try_submit(
+        job_function function);
+
+    /*!
+     * \brief Cancel jobs waiting in the queue.
+     *
+     * \return Number of cancelled jobs.
+     *
+     * \note Futures of cancelled jobs throw std::runtime_error.
+     * \note Running jobs are not cancelled.
+     */
+    std::size_t cancel_pending();
+
+    /*!
+     * \brief Get the number of jobs waiting in the queue.
+     *
+     * \return Number of jobs.
+     */
+    [[nodiscard]] std::size_t num_pending_jobs();
+
+private:
+    //! Struct of jobs.
+    struct job {
+        //! Function.
+        job_function function;
+
+        //! Promise of the result.
+        std::promise<void> promise;
+    };
+
+    /*!
+     * \brief Enqueue a job.
+     *
+     * \param[in] function Function of the job.
+     * \param[in] lock Lock of the mutex, which must be locked.
+     * \return Future of the result of the job.
+     */
+    [[nodiscard]] std::future<void> enqueue(
+        job_function function, std::unique_lock<std::mutex>& lock);
+
+    /*!
+     * \brief Run a worker thread.
+     */
+    void run_worker();
+
+    //! Capacity of the queue.
+    std::size_t queue_capacity_;
+
+    //! Mutex of member variables.
+    std::mutex mutex_;
+
+    //! Condition variable to notify new jobs or stop.
+    std::condition_variable job_added_;
+
+    //! Condition variable to notify that a job is removed from the queue.
+    std::condition_variable job_removed_;
+
+    //! Queue of jobs.
+    std::deque<job> queue_;
+
+    //! Whether to stop workers.
+    bool is_stopped_{false};
+
+    //! Worker threads.
+    std::vector<std::thread> workers_;
+};
+
+}  // namespace plotly_plotter::io
@@ -0,0 +1,187 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of classes of output sinks.
+ */
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+#include "plotly_plotter/details/file_handle.h"
+#include "plotly_plotter/details/plotly_plotter_export.h"
+
+namespace plotly_plotter::io {
+
+/*!
+ * \brief Base class of sinks of outputs.
+ */
+class PLOTLY_PLOTTER_EXPORT output_sink {
+public:
+    /*!
+     * \brief Write a string.
+     *
+     * \param[in] data String.
+     */
+    virtual void write(std::string_view data) = 0;
+
+    /*!
+     * \brief Write strings.
+     *
+     * \param[in] parts Strings.
+     * \param[in] num_parts Number of strings.
+     *
+     * \note The default implementation calls write function for each string.
+     */
+    virtual void write_parts(
+        const std::string_view* parts, std::size_t num_parts);
+
+    /*!
+     * \brief Constructor.
+     */
+    output_sink() = default;
+
+    /*!
+     * \brief Destructor.
+     */
+    virtual ~output_sink();
+
+    output_sink(const output_sink&) = delete;
+    output_sink(output_sink&&) = delete;
+    output_sink& operator=(const output_sink&) = delete;
+    output_sink& operator=(output_sink&&) = delete;
+};
+
+/*!
+ * \brief Class of sinks to append outputs to strings.
+ */
+class PLOTLY_PLOTTER_EXPORT string_output_sink final : public output_sink {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] buffer Buffer to append outputs.
+     * (This must outlive this object.)
+     */
+    explicit string_output_sink(std::string& buffer) noexcept;
+
+    //! \copydoc output_sink::write
+    void write(std::string_view data) override;
+
+    //! \copydoc output_sink::write_parts
+    void write_parts(
+        const std::string_view* parts, std::size_t num_parts) override;
+
+private:
+    //! Buffer.
+    std::string* buffer_;
+};
+
+/*!
+ * \brief Class of sinks to write outputs to streams.
+ */
+class PLOTLY_PLOTTER_EXPORT ostream_output_sink final : public output_sink {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] stream Stream. (This must outlive this object.)
+     */
+    explicit ostream_output_sink(std::ostream& stream) noexcept;
+
+    //! \copydoc output_sink::write
+    void write(std::string_view data) override;
+
+private:
+    //! Stream.
+    std::ostream* stream_;
+};
+
+/*!
+ * \brief Class of sinks to call functions with outputs.
+ */
+class PLOTLY_PLOTTER_EXPORT callback_output_sink final : public output_sink {
+public:
+    //! Type of callbacks.
+    using callback_type = std::function<void(std::string_view)>;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] callback Function called with strings of outputs.
+     */
+    explicit callback_output_sink(callback_type callback);
+
+    //! \copydoc output_sink::write
+    void write(std::string_view data) override;
+
+private:
+    //! Callback.
+    callback_type callback_;
+};
+
+/*!
+ * \brief Class of sinks to write outputs to file descriptors.
+ *
+ * \note This class uses `writev` function in POSIX environments
+ * to write multiple strings in a system call.
+ */
+class PLOTLY_PLOTTER_EXPORT fd_output_sink final : public output_sink {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] fd File descriptor. (This object does not close it.)
+     */
+    explicit fd_output_sink(int fd) noexcept;
+
+    //! \copydoc output_sink::write
+    void write(std::string_view data) override;
+
+    //! \copydoc output_sink::write_parts
+    void write_parts(
+        const std::string_view* parts, std::size_t num_parts) override;
+
+private:
+    //! File descriptor.
+    int fd_;
+};
+
+/*!
+ * \brief Class of sinks to write outputs to files.
+ */
+class PLOTLY_PLOTTER_EXPORT file_output_sink final : public output_sink {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] file_path File path.
+     */
+    explicit file_output_sink(const std::string& file_path);
+
+    //! \copydoc output_sink::write
+    void write(std::string_view data) override;
+
+private:
+    //! File.
+    plotly_plotter::details::file_handle file_;
+};
+
+}  // namespace plotly_plotter::io
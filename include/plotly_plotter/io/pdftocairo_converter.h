@@ -24,6 +24,8 @@
 #include <string>
 
 #include "plotly_plotter/details/plotly_plotter_export.h"
+#include "plotly_plotter/io/details/executable_check_cache.h"
+#include "plotly_plotter/io/details/executable_version_cache.h"
 #include "plotly_plotter/io/pdf_to_svg_converter_base.h"
 
 namespace plotly_plotter::io {
@@ -55,10 +57,23 @@ public:
      */
     [[nodiscard]] std::string get_pdftocairo_path();
 
+    /*!
+     * \brief Get the version of pdftocairo.
+     *
+     * \return Output of the command to show the version,
+     * or an empty string if the version is not available.
+     *
+     * \note The version is got only once for each path.
+     */
+    [[nodiscard]] std::string get_version();
+
     /*!
      * \brief Set the path to the pdftocairo command.
      *
      * \param[in] path The path to the pdftocairo command.
+     *
+     * \note This function clears cached results of checks whether the
+     * conversion is supported.
      */
     void set_pdftocairo_path(const std::string& path);
 
@@ -81,6 +96,12 @@ private:
     //! Mutex of member variables.
     std::mutex mutex_;
 
+    //! Cache of results of checks of executables.
+    details::executable_check_cache check_cache_;
+
+    //! Cache of versions of executables.
+    details::executable_version_cache version_cache_;
+
     //! Path to the pdftocairo command.
     std::string pdftocairo_path_;
 };
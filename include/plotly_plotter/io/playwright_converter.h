@@ -24,6 +24,8 @@
 #include <string>
 
 #include "plotly_plotter/details/plotly_plotter_export.h"
+#include "plotly_plotter/io/details/executable_check_cache.h"
+#include "plotly_plotter/io/details/executable_version_cache.h"
 #include "plotly_plotter/io/html_to_pdf_converter_base.h"
 #include "plotly_plotter/io/html_to_png_converter_base.h"
 
@@ -66,10 +68,23 @@ public:
      */
     [[nodiscard]] std::string get_python_path();
 
+    /*!
+     * \brief Get the version of Playwright.
+     *
+     * \return Output of the command to show the version,
+     * or an empty string if the version is not available.
+     *
+     * \note The version is got only once for each path.
+     */
+    [[nodiscard]] std::string get_version();
+
     /*!
      * \brief Set the path of the Python executable.
      *
      * \param[in] path The path of the Python executable.
+     *
+     * \note This function clears cached results of checks whether the
+     * conversion is supported.
      */
     void set_python_path(std::string path);
 
@@ -92,6 +107,12 @@ private:
     //! Mutex of member variables.
     std::mutex mutex_;
 
+    //! Cache of results of checks of executables.
+    details::executable_check_cache check_cache_;
+
+    //! Cache of versions of executables.
+    details::executable_version_cache version_cache_;
+
     //! Path to the Python executable.
     std::string python_path_;
 };
@@ -0,0 +1,274 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of render_cache class.
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include "plotly_plotter/details/plotly_plotter_export.h"
+#include "plotly_plotter/json_document.h"
+
+namespace plotly_plotter::io {
+
+/*!
+ * \brief Class of caches of rendered PDF, PNG, and SVG files.
+ *
+ * This cache stores rendered files in a local directory,
+ * using hashes of inputs of rendering as names of files.
+ * When a file with the same inputs is requested again,
+ * the file is copied from the cache without running converters.
+ *
+ * Files in the directory are removed in the order of the last use
+ * when the total size of files exceeds the maximum size.
+ * The directory is scanned only when the total size estimated from the last
+ * scan and files stored since then exceeds the maximum size,
+ * so files stored by other processes are counted at the next scan.
+ *
+ * \note This cache is disabled by default.
+ * \note This class is thread-safe.
+ */
+class PLOTLY_PLOTTER_EXPORT render_cache {
+public:
+    //! Default maximum size of files in the cache. (256 MiB.)
+    static constexpr std::uintmax_t default_max_size =
+        static_cast<std::uintmax_t>(256) * 1024 * 1024;
+
+    /*!
+     * \brief Get the singleton instance.
+     *
+     * \return The singleton instance.
+     */
+    [[nodiscard]] static render_cache& get_instance();
+
+    /*!
+     * \brief Enable this cache.
+     *
+     * \param[in] directory Directory of cached files.
+     * \param[in] max_size Maximum total size of cached files in bytes.
+     *
+     * \note The directory is created if it does not exist.
+     * \warning Files in the directory with names like cached files can be
+     * removed.
+     */
+    void enable(const std::string& directory,
+        std::uintmax_t max_size = default_max_size);
+
+    /*!
+     * \brief Disable this cache.
+     *
+     * \note Cached files are not removed.
+     */
+    void disable();
+
+    /*!
+     * \brief Check whether this cache is enabled.
+     *
+     * \return Whether this cache is enabled.
+     */
+    [[nodiscard]] bool is_enabled();
+
+    /*!
+     * \brief Set whether to use hard links instead of copies of files.
+     *
+     * \param[in] use_hard_links Whether to use hard links.
+     *
+     * \note When hard links cannot be created, files are copied.
+     * \warning When hard links are used, modifications of output files
+     * also modify cached files.
+     */
+    void set_use_hard_links(bool use_hard_links);
+
+    /*!
+     * \brief Get the number of hits of this cache.
+     *
+     * \return Number of hits.
+     */
+    [[nodiscard]] std::uint64_t num_hits() const noexcept;
+
+    /*!
+     * \brief Get the number of misses of this cache.
+     *
+     * \return Number of misses.
+     */
+    [[nodiscard]] std::uint64_t num_misses() const noexcept;
+
+    /*!
+     * \brief Reset the numbers of hits and misses.
+     */
+    void reset_counters() noexcept;
+
+    /*!
+     * \brief Remove all cached files.
+     */
+    void clear();
+
+    /*!
+     * \brief Create the name of a cached file.
+     *
+     * \param[in] extension Extension of the file (for example, `png`).
+     * \param[in] html_title Title of the HTML file.
+     * \param[in] data Data.
+     * \param[in] width Width.
+     * \param[in] height Height.
+     * \param[in] converter String to identify converters and their
+     * versions.
+     * \return Name of the file.
+     */
+    [[nodiscard]] static std::string create_entry_name(
+        std::string_view extension, std::string_view html_title,
+        const json_document& data, std::size_t width, std::size_t height,
+        std::string_view converter);
+
+    /*!
+     * \brief Create the name of a cached file.
+     *
+     * \param[in] extension Extension of the file (for example, `png`).
+     * \param[in] html_title Title of the HTML file.
+     * \param[in] escaped_data Data serialized and escaped for HTML.
+     * \param[in] width Width.
+     * \param[in] height Height.
+     * \param[in] converter String to identify converters and their
+     * versions.
+     * \return Name of the file.
+     */
+    [[nodiscard]] static std::string create_entry_name(
+        std::string_view extension, std::string_view html_title,
+        std::string_view escaped_data, std::size_t width, std::size_t height,
+        std::string_view converter);
+
+    /*!
+     * \brief Render a file using this cache.
+     *
+     * \param[in] file_path Path of the output file.
+     * \param[in] entry_name_creator Function to create the name of the
+     * cached file. (Called only when this cache is enabled.)
+     * \param[in] renderer Function to render the output file.
+     */
+    void render(const char* file_path,
+        const std::function<std::string()>& entry_name_creator,
+        const std::function<void()>& renderer);
+
+    render_cache(const render_cache&) = delete;
+    render_cache(render_cache&&) = delete;
+    render_cache& operator=(const render_cache&) = delete;
+    render_cache& operator=(render_cache&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~render_cache();
+
+private:
+    /*!
+     * \brief Constructor.
+     */
+    render_cache();
+
+    /*!
+     * \brief Copy a cached file to the output file if exists.
+     *
+     * \param[in] directory Directory of cached files.
+     * \param[in] entry_name Name of the cached file.
+     * \param[in] use_hard_links Whether to use hard links.
+     * \param[in] file_path Path of the output file.
+     * \retval true The cached file was found and copied.
+     * \retval false The cached file was not found.
+     */
+    [[nodiscard]] static bool restore(const std::filesystem::path& directory,
+        const std::string& entry_name, bool use_hard_links,
+        const char* file_path);
+
+    /*!
+     * \brief Store an output file to this cache.
+     *
+     * \param[in] directory Directory of cached files.
+     * \param[in] entry_name Name of the cached file.
+     * \param[in] max_size Maximum total size of cached files.
+     * \param[in] file_path Path of the output file.
+     */
+    void store(const std::filesystem::path& directory,
+        const std::string& entry_name, std::uintmax_t max_size,
+        const char* file_path);
+
+    /*!
+     * \brief Remove cached files exceeding the maximum size.
+     *
+     * \param[in] directory Directory of cached files.
+     * \param[in] max_size Maximum total size of cached files.
+     */
+    void evict(const std::filesystem::path& directory, std::uintmax_t max_size);
+
+    /*!
+     * \brief Remove cached files exceeding the maximum size with the lock of
+     * files.
+     *
+     * \param[in] directory Directory of cached files.
+     * \param[in] max_size Maximum total size of cached files.
+     *
+     * \note This function updates the total size of files in the directory.
+     */
+    void evict_locked(
+        const std::filesystem::path& directory, std::uintmax_t max_size);
+
+    //! Mutex of settings.
+    std::mutex mutex_;
+
+    //! Mutex of modifications of files in the directory.
+    std::mutex files_mutex_;
+
+    //! Directory in which the total size of cached files was calculated.
+    std::filesystem::path size_directory_;
+
+    //! Total size of cached files, estimated from the last scan and stored
+    //! files.
+    std::uintmax_t total_size_{0};
+
+    //! Whether this cache is enabled.
+    bool is_enabled_{false};
+
+    //! Directory of cached files.
+    std::filesystem::path directory_;
+
+    //! Maximum total size of cached files.
+    std::uintmax_t max_size_{default_max_size};
+
+    //! Whether to use hard links.
+    bool use_hard_links_{false};
+
+    //! Number of hits.
+    std::atomic<std::uint64_t> num_hits_{0};
+
+    //! Number of misses.
+    std::atomic<std::uint64_t> num_misses_{0};
+
+    //! Random token used in names of temporary files.
+    std::uint64_t temporary_file_token_;
+
+    //! Number of temporary files created.
+    std::atomic<std::uint64_t> num_temporary_files_{0};
+};
+
+}  // namespace plotly_plotter::io
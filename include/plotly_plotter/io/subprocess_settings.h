@@ -0,0 +1,84 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Declaration of functions to configure subprocesses.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include "plotly_plotter/details/plotly_plotter_export.h"
+
+namespace plotly_plotter::io {
+
+/*!
+ * \brief Enumeration of methods to launch subprocesses.
+ *
+ * \note These methods are used only on Unix platforms.
+ */
+enum class process_launcher : std::uint8_t {
+    //! Use `posix_spawn` function. (Default.)
+    posix_spawn,
+
+    //! Use `fork` and `exec` functions.
+    fork
+};
+
+/*!
+ * \brief Get the method to launch subprocesses.
+ *
+ * \return Method to launch subprocesses.
+ */
+[[nodiscard]] PLOTLY_PLOTTER_EXPORT process_launcher
+get_process_launcher() noexcept;
+
+/*!
+ * \brief Set the method to launch subprocesses.
+ *
+ * \param[in] value Method to launch subprocesses.
+ *
+ * \note `posix_spawn` avoids copying page tables of this process,
+ * so it is much faster than `fork` when this process uses a large memory.
+ */
+PLOTLY_PLOTTER_EXPORT void set_process_launcher(
+    process_launcher value) noexcept;
+
+/*!
+ * \brief Get the timeout of subprocesses.
+ *
+ * \return Timeout of subprocesses.
+ */
+[[nodiscard]] PLOTLY_PLOTTER_EXPORT std::chrono::milliseconds
+get_subprocess_timeout() noexcept;
+
+/*!
+ * \brief Set the timeout of subprocesses.
+ *
+ * \param[in] value Timeout of subprocesses.
+ *
+ * \note Subprocesses running longer than this timeout are terminated and
+ * functions executing them throw exceptions.
+ * \note Default value is 10 seconds on Unix platforms and 60 seconds on
+ * Windows.
+ * \note On Windows, timeouts longer than about 49 days are shortened to
+ * the longest timeout supported by `WaitForSingleObject` function.
+ */
+PLOTLY_PLOTTER_EXPORT void set_subprocess_timeout(
+    std::chrono::milliseconds value);
+
+}  // namespace plotly_plotter::io
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Declaration of functions to warm up converters.
+ */
+#pragma once
+
+#include <future>
+
+#include "plotly_plotter/details/plotly_plotter_export.h"
+
+namespace plotly_plotter::io {
+
+/*!
+ * \brief Warm up converters.
+ *
+ * This function initializes converters and checks whether conversions are
+ * supported in the environment. Results of the checks are cached in
+ * converters, so later outputs don't need to check them again.
+ *
+ * \note Calling this function is optional. Converters are initialized and
+ * checked on their first use without calling this function.
+ */
+PLOTLY_PLOTTER_EXPORT void warm_up_converters();
+
+/*!
+ * \brief Warm up converters in background.
+ *
+ * \return Future to wait for the completion of warm-up.
+ *
+ * \note This function is useful when called at the start of programs,
+ * because checks of converters take some time (about 1 second for
+ * Playwright) and they can be done while preparing data.
+ * \note Destructor of the returned object waits for the completion of warm-up.
+ *
+ * \sa warm_up_converters
+ */
+[[nodiscard]] PLOTLY_PLOTTER_EXPORT std::future<void>
+warm_up_converters_async();
+
+}  // namespace plotly_plotter::io
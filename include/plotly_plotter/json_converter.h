@@ -25,6 +25,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <ctime>
+#include <iterator>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -35,6 +36,7 @@
 
 #include <yyjson.h>
 
+#include "plotly_plotter/details/number_array.h"
 #include "plotly_plotter/details/plotly_plotter_export.h"
 #include "plotly_plotter/json_converter_decl.h"
 #include "plotly_plotter/json_value.h"
@@ -197,6 +199,43 @@ class json_converter<char[Size]> : public json_converter<std::string_view> {};
 
 namespace details {
 
+/*!
+ * \brief Check whether a type is a contiguous array of numbers.
+ *
+ * \tparam T Type.
+ */
+template <typename T>
+struct is_contiguous_number_array : std::false_type {};
+
+/*!
+ * \brief Check whether a type is a contiguous array of numbers.
+ *
+ * \tparam T Type of values.
+ * \tparam Allocator Type of the allocator.
+ */
+template <typename T, typename Allocator>
+struct is_contiguous_number_array<std::vector<T, Allocator>>
+    : std::bool_constant<is_json_number_v<T>> {};
+
+/*!
+ * \brief Check whether a type is a contiguous array of numbers.
+ *
+ * \tparam T Type of values.
+ * \tparam Size Size of the array.
+ */
+template <typename T, std::size_t Size>
+struct is_contiguous_number_array<std::array<T, Size>>
+    : std::bool_constant<is_json_number_v<T>> {};
+
+/*!
+ * \brief Check whether a type is a contiguous array of numbers.
+ *
+ * \tparam T Type.
+ */
+template <typename T>
+constexpr bool is_contiguous_number_array_v =
+    is_contiguous_number_array<T>::value;
+
 /*!
  * \brief Implementation of json_converter class for array types.
  *
@@ -213,10 +252,14 @@ public:
      */
     static void to_json(const T& from, json_value& to) {
         details::check_assignment(to);
-        yyjson_mut_set_arr(to.internal_value());
-        yyjson_mut_arr_clear(to.internal_value());
-        for (const auto& value : from) {
-            to.push_back(value);
+        if constexpr (is_contiguous_number_array_v<T>) {
+            assign_number_array(std::data(from), std::size(from), to);
+        } else {
+            yyjson_mut_set_arr(to.internal_value());
+            yyjson_mut_arr_clear(to.internal_value());
+            for (const auto& value : from) {
+                to.push_back(value);
+            }
         }
     }
 };
@@ -21,30 +21,113 @@
 
 // IWYU pragma: no_include <cwchar>
 
+#include <cstddef>
 #include <cstdio>
 #include <cstdlib>
+#include <memory>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <utility>
 
 #include <yyjson.h>
 
+#include "plotly_plotter/details/json_allocator.h"
+#include "plotly_plotter/details/json_statistics.h"
+#include "plotly_plotter/details/parsed_json.h"
 #include "plotly_plotter/json_value.h"
+#include "plotly_plotter/metrics/metrics_registry.h"
+#include "plotly_plotter/tracing/tracer.h"
 
 namespace plotly_plotter {
 
+/*!
+ * \brief Struct of statistics of JSON documents.
+ */
+struct json_statistics {
+    //! Number of values. (Keys in objects are not counted.)
+    std::size_t num_nodes{0};
+
+    //! Number of bytes in strings including keys in objects.
+    std::size_t string_bytes{0};
+
+    /*!
+     * \brief Estimated number of bytes in the serialized JSON without
+     * pretty printing.
+     *
+     * This is the exact size except that characters escaped in strings are
+     * counted as one byte.
+     */
+    std::size_t estimated_serialized_size{0};
+
+    /*!
+     * \brief Number of bytes allocated by yyjson for the document.
+     *
+     * For parsed data not converted to mutable values yet, this is the size
+     * of the parsed values, because strings refer to the parsed file.
+     */
+    std::size_t allocated_bytes{0};
+};
+
+namespace details {
+
+/*!
+ * \brief Record metrics of a serialization of JSON.
+ *
+ * \param[in] root Root of the serialized values.
+ * \param[in] num_bytes Number of bytes of the serialized JSON.
+ */
+inline void record_json_serialization(
+    yyjson_mut_val* root, std::size_t num_bytes) {
+    auto& registry = metrics::metrics_registry::get_instance();
+    if (!registry.is_enabled()) {
+        return;
+    }
+    registry.add(
+        metrics::counter_type::json_nodes_serialized, count_json_nodes(root));
+    registry.add(metrics::counter_type::json_bytes_serialized, num_bytes);
+}
+
+/*!
+ * \brief Record metrics of a serialization of a parsed JSON document.
+ *
+ * \param[in] document Parsed document.
+ * \param[in] num_bytes Number of bytes of the serialized JSON.
+ */
+inline void record_json_serialization(
+    yyjson_doc* document, std::size_t num_bytes) {
+    auto& registry = metrics::metrics_registry::get_instance();
+    if (!registry.is_enabled()) {
+        return;
+    }
+    registry.add(metrics::counter_type::json_nodes_serialized,
+        yyjson_doc_get_val_count(document));
+    registry.add(metrics::counter_type::json_bytes_serialized, num_bytes);
+}
+
+}  // namespace details
+
 /*!
  * \brief Class of JSON documents.
  *
  * @warning Destroying this object will invalidate all json_value objects
  * created from the json_document object.
+ *
+ * \note Documents created by \ref parse function keep the parsed data
+ * immutable until values are accessed using the non-const \ref root function
+ * or \ref make_mutable function, so the parsed data can be serialized or
+ * copied without conversion to mutable values.
+ * Const functions never convert the parsed data, so a const document can be
+ * read from multiple threads.
  */
 class json_document {
 public:
     /*!
      * \brief Constructor.
      */
-    json_document() : document_(yyjson_mut_doc_new(nullptr)) {
+    json_document()
+        : allocator_(std::make_unique<details::json_allocator>()),
+          document_(yyjson_mut_doc_new(allocator_->get())) {
         if (document_ == nullptr) {
             throw std::runtime_error("Failed to create a JSON document.");
         }
@@ -65,8 +148,10 @@ public:
      * \param[in,out] other Object to move from.
      */
     json_document(json_document&& other) noexcept
-        : document_(std::exchange(other.document_, nullptr)),
-          root_(std::exchange(other.root_, nullptr)) {}
+        : allocator_(std::move(other.allocator_)),
+          document_(std::exchange(other.document_, nullptr)),
+          root_(std::exchange(other.root_, nullptr)),
+          parsed_(std::move(other.parsed_)) {}
 
     /*!
      * \brief Move assignment operator.
@@ -77,8 +162,10 @@ public:
     json_document& operator=(json_document&& other) noexcept {
         if (this != &other) {
             clear();
+            allocator_ = std::move(other.allocator_);
             document_ = std::exchange(other.document_, nullptr);
             root_ = std::exchange(other.root_, nullptr);
+            parsed_ = std::move(other.parsed_);
         }
         return *this;
     }
@@ -88,15 +175,144 @@ public:
      */
     ~json_document() { clear(); }
 
+    /*!
+     * \brief Parse a JSON file.
+     *
+     * \param[in] file_path File path.
+     * \return Document.
+     *
+     * \note The file is mapped to memory and parsed in place when possible.
+     * Parsed data is converted to mutable values when the non-const
+     * \ref root function is called for the first time.
+     */
+    [[nodiscard]] static json_document parse(const std::string& file_path) {
+        json_document document(nullptr, nullptr);
+        document.parsed_ = details::parsed_json::parse_file(file_path);
+        return document;
+    }
+
+    /*!
+     * \brief Check whether this document has been converted to mutable
+     * values.
+     *
+     * \return Whether this document has been converted to mutable values.
+     */
+    [[nodiscard]] bool is_mutable() const noexcept { return !parsed_; }
+
+    /*!
+     * \brief Convert parsed data to mutable values if not converted yet.
+     */
+    void make_mutable() {
+        if (!parsed_) {
+            return;
+        }
+        PLOTLY_PLOTTER_TRACE_SPAN("json_document::make_mutable", "json");
+        auto allocator = std::make_unique<details::json_allocator>();
+        yyjson_mut_doc* document =
+            yyjson_doc_mut_copy(parsed_->document(), allocator->get());
+        if (document == nullptr) {
+            throw std::runtime_error("Failed to convert a JSON document.");
+        }
+        allocator_ = std::move(allocator);
+        document_ = document;
+        root_ = yyjson_mut_doc_get_root(document_);
+        parsed_.reset();
+    }
+
+    /*!
+     * \brief Create a deep copy of this document.
+     *
+     * \return Copied document.
+     */
+    [[nodiscard]] json_document clone() const {
+        if (parsed_) {
+            // Parsed data is immutable, so it can be shared.
+            json_document document(nullptr, nullptr);
+            document.parsed_ = parsed_;
+            return document;
+        }
+        auto allocator = std::make_unique<details::json_allocator>();
+        yyjson_mut_doc* copied_document =
+            yyjson_mut_doc_mut_copy(document_, allocator->get());
+        if (copied_document == nullptr) {
+            throw std::runtime_error("Failed to copy a JSON document.");
+        }
+        return json_document(std::move(allocator), copied_document);
+    }
+
     /*!
      * \brief Get the root value.
      *
      * \return Root value.
      */
-    [[nodiscard]] json_value root() const noexcept {
+    [[nodiscard]] json_value root() {
+        make_mutable();
         return json_value(root_, document_);
     }
 
+    /*!
+     * \brief Get the root value.
+     *
+     * \return Root value.
+     *
+     * \note This function throws std::runtime_error if this document has not
+     * been converted to mutable values. Use the non-const version of this
+     * function or \ref make_mutable function to convert the document.
+     * \warning This function was `noexcept` before parsed documents were
+     * introduced. Code using this function for documents of figures created
+     * by figure::from_document function must convert the documents first.
+     */
+    [[nodiscard]] json_value root() const {
+        if (parsed_) {
+            throw std::runtime_error(
+                "Values of a parsed JSON document cannot be accessed via const "
+                "references before conversion to mutable values.");
+        }
+        return json_value(root_, document_);
+    }
+
+    /*!
+     * \brief Check whether the root value is an object with a key.
+     *
+     * \param[in] key Key.
+     * \retval true The root value has the key.
+     * \retval false The root value does not have the key.
+     *
+     * \note This function does not convert parsed data to mutable values.
+     */
+    [[nodiscard]] bool has_root_key(std::string_view key) const {
+        if (parsed_) {
+            return yyjson_obj_getn(yyjson_doc_get_root(parsed_->document()),
+                       key.data(), key.size()) != nullptr;
+        }
+        return yyjson_mut_obj_getn(root_, key.data(), key.size()) != nullptr;
+    }
+
+    /*!
+     * \brief Compute statistics of this document.
+     *
+     * \return Statistics.
+     *
+     * \note This function traverses all values in this document.
+     * Parsed data not converted to mutable values yet is converted to a
+     * temporary copy.
+     */
+    [[nodiscard]] json_statistics compute_statistics() const {
+        json_statistics statistics;
+        if (parsed_) {
+            json_document converted = clone();
+            converted.make_mutable();
+            details::accumulate_json_statistics(converted.root_, statistics);
+            statistics.allocated_bytes =
+                yyjson_doc_get_val_count(parsed_->document()) *
+                sizeof(yyjson_val);
+        } else if (root_ != nullptr) {
+            details::accumulate_json_statistics(root_, statistics);
+            statistics.allocated_bytes = allocator_->allocated_bytes();
+        }
+        return statistics;
+    }
+
     /*!
      * \brief Serialize this document to a JSON string.
      *
@@ -105,21 +321,30 @@ public:
      */
     [[nodiscard]] std::string serialize_to_string(
         bool pretty_output = false) const {
+        PLOTLY_PLOTTER_TRACE_SPAN("json_document::serialize_to_string", "json");
         const yyjson_write_flag flags = pretty_output
             ? static_cast<yyjson_write_flag>(YYJSON_WRITE_PRETTY_TWO_SPACES)
             : static_cast<yyjson_write_flag>(0);
         yyjson_write_err error{};
-        char* str =
-            yyjson_mut_write_opts(document_, flags, nullptr, nullptr, &error);
+        std::size_t length = 0;
+        char* str = parsed_
+            ? yyjson_write_opts(
+                  parsed_->document(), flags, nullptr, &length, &error)
+            : yyjson_mut_write_opts(document_, flags, nullptr, &length, &error);
         if (str == nullptr) {
             throw std::runtime_error(
                 std::string("Failed to serialize JSON document.") +
                 (error.msg != nullptr ? std::string(" Error: ") + error.msg
                                       : ""));
         }
-        std::string result(str);
+        std::string result(str, length);
         // NOLINTNEXTLINE(*-no-malloc): Required by an external library.
         std::free(str);
+        if (parsed_) {
+            details::record_json_serialization(parsed_->document(), length);
+        } else {
+            details::record_json_serialization(root_, length);
+        }
         return result;
     }
 
@@ -130,7 +355,10 @@ public:
      */
     void serialize_to(std::FILE* file) const {
         yyjson_write_err error{};
-        if (!yyjson_mut_write_fp(file, document_, 0, nullptr, &error)) {
+        const bool is_written = parsed_
+            ? yyjson_write_fp(file, parsed_->document(), 0, nullptr, &error)
+            : yyjson_mut_write_fp(file, document_, 0, nullptr, &error);
+        if (!is_written) {
             throw std::runtime_error(
                 std::string("Failed to serialize JSON document.") +
                 (error.msg != nullptr ? std::string(" Error: ") + error.msg
@@ -139,6 +367,19 @@ public:
     }
 
 private:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] allocator Allocator used in the document.
+     * \param[in] document Document. (This object takes the ownership.)
+     */
+    json_document(std::unique_ptr<details::json_allocator> allocator,
+        yyjson_mut_doc* document) noexcept
+        : allocator_(std::move(allocator)),
+          document_(document),
+          root_(document != nullptr ? yyjson_mut_doc_get_root(document)
+                                    : nullptr) {}
+
     /*!
      * \brief Clear the document.
      */
@@ -148,13 +389,22 @@ private:
             document_ = nullptr;
         }
         root_ = nullptr;
+        parsed_.reset();
+        // The allocator is used until the document is freed.
+        allocator_.reset();
     }
 
-    //! Document.
+    //! Allocator of the document. (Null for parsed data.)
+    std::unique_ptr<details::json_allocator> allocator_;
+
+    //! Document. (Null until parsed data is converted to mutable values.)
     yyjson_mut_doc* document_;
 
     //! Root value.
     yyjson_mut_val* root_{};
+
+    //! Parsed data not converted to mutable values yet.
+    std::shared_ptr<const details::parsed_json> parsed_{};
 };
 
 }  // namespace plotly_plotter
@@ -21,6 +21,7 @@
 
 #include <string_view>
 
+#include "plotly_plotter/array_view.h"
 #include "plotly_plotter/json_converter.h"  // IWYU pragma: export
 #include "plotly_plotter/json_value.h"
 #include "plotly_plotter/layouts/title_base.h"
@@ -179,6 +180,34 @@ public:
      */
     void show_tick_labels(bool value) { data_["showticklabels"] = value; }
 
+    /*!
+     * \brief Set the values at which ticks are shown.
+     *
+     * \tparam Container Type of the container of values.
+     * \param[in] values Values.
+     *
+     * \note This function sets `tickmode` to `"array"`.
+     * \note The container must support `std::begin` and `std::end` functions.
+     */
+    template <typename Container>
+    void tick_values(const Container& values) {
+        data_["tickmode"] = "array";
+        data_["tickvals"] = as_array(values);
+    }
+
+    /*!
+     * \brief Set the text of ticks shown at values set by tick_values().
+     *
+     * \tparam Container Type of the container of text.
+     * \param[in] values Text.
+     *
+     * \note The container must support `std::begin` and `std::end` functions.
+     */
+    template <typename Container>
+    void tick_text(const Container& values) {
+        data_["ticktext"] = as_array(values);
+    }
+
     /*!
      * \brief Set the axis according to which this axis is scaled.
      *
@@ -0,0 +1,263 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of matrix_view class.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <yyjson.h>
+
+#include "plotly_plotter/details/number_array.h"
+#include "plotly_plotter/json_converter.h"
+#include "plotly_plotter/json_converter_decl.h"
+#include "plotly_plotter/json_value.h"
+
+namespace plotly_plotter {
+
+/*!
+ * \brief Enumeration of storage orders of matrices.
+ */
+enum class storage_order : std::uint8_t {
+    //! Row-major order (C order).
+    row_major,
+
+    //! Column-major order (Fortran order).
+    column_major
+};
+
+/*!
+ * \brief Class of views of matrices in buffers.
+ *
+ * \tparam T Type of values.
+ *
+ * \note This class doesn't manage the memory of the buffer.
+ * So, the buffer must be valid while this object is used.
+ * \note Matrices are converted to JSON arrays of rows.
+ */
+template <typename T>
+class matrix_view {
+public:
+    //! Type of values.
+    using value_type = T;
+
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] data Pointer to the buffer.
+     * \param[in] rows Number of rows.
+     * \param[in] cols Number of columns.
+     * \param[in] order Storage order.
+     * \param[in] outer_stride Number of values between the beginnings of
+     * consecutive rows (row-major order) or columns (column-major order).
+     * Zero means that the matrix is packed without gaps.
+     */
+    matrix_view(const T* data, std::size_t rows, std::size_t cols,
+        storage_order order = storage_order::row_major,
+        std::size_t outer_stride = 0) noexcept
+        : data_(data),
+          rows_(rows),
+          cols_(cols),
+          order_(order),
+          outer_stride_(outer_stride) {
+        if (outer_stride_ == 0) {
+            outer_stride_ =
+                (order_ == storage_order::row_major) ? cols_ : rows_;
+        }
+    }
+
+    /*!
+     * \brief Get the pointer to the buffer.
+     *
+     * \return Pointer to the buffer.
+     */
+    [[nodiscard]] const T* data() const noexcept { return data_; }
+
+    /*!
+     * \brief Get the number of rows.
+     *
+     * \return Number of rows.
+     */
+    [[nodiscard]] std::size_t rows() const noexcept { return rows_; }
+
+    /*!
+     * \brief Get the number of columns.
+     *
+     * \return Number of columns.
+     */
+    [[nodiscard]] std::size_t cols() const noexcept { return cols_; }
+
+    /*!
+     * \brief Get the storage order.
+     *
+     * \return Storage order.
+     */
+    [[nodiscard]] storage_order order() const noexcept { return order_; }
+
+    /*!
+     * \brief Get the outer stride.
+     *
+     * \return Number of values between the beginnings of consecutive rows
+     * (row-major order) or columns (column-major order).
+     */
+    [[nodiscard]] std::size_t outer_stride() const noexcept {
+        return outer_stride_;
+    }
+
+private:
+    //! Pointer to the buffer.
+    const T* data_;
+
+    //! Number of rows.
+    std::size_t rows_;
+
+    //! Number of columns.
+    std::size_t cols_;
+
+    //! Storage order.
+    storage_order order_;
+
+    //! Outer stride.
+    std::size_t outer_stride_;
+};
+
+/*!
+ * \brief Create a view of a matrix in a buffer.
+ *
+ * \tparam T Type of values.
+ * \param[in] data Pointer to the buffer.
+ * \param[in] rows Number of rows.
+ * \param[in] cols Number of columns.
+ * \param[in] order Storage order.
+ * \param[in] outer_stride Number of values between the beginnings of
+ * consecutive rows (row-major order) or columns (column-major order).
+ * Zero means that the matrix is packed without gaps.
+ * \return View.
+ */
+template <typename T>
+[[nodiscard]] matrix_view<T> as_matrix(const T* data, std::size_t rows,
+    std::size_t cols, storage_order order = storage_order::row_major,
+    std::size_t outer_stride = 0) {
+    return matrix_view<T>(data, rows, cols, order, outer_stride);
+}
+
+namespace details {
+
+/*!
+ * \brief Number of rows gathered at once from matrices in column-major order.
+ */
+constexpr std::size_t matrix_gather_block_rows = 64;
+
+/*!
+ * \brief Call a function for each row of a matrix with a contiguous buffer of
+ * the row.
+ *
+ * \tparam T Type of values.
+ * \tparam Function Type of the function.
+ * \param[in] matrix Matrix.
+ * \param[in] function Function called with the index of the row and the
+ * pointer to the values in the row.
+ *
+ * \note Rows of matrices in column-major order are gathered into a buffer in
+ * blocks of rows, so that the memory is read in contiguous parts of columns.
+ */
+template <typename T, typename Function>
+void for_each_matrix_row(const matrix_view<T>& matrix, Function&& function) {
+    const std::size_t rows = matrix.rows();
+    const std::size_t cols = matrix.cols();
+    if (matrix.order() == storage_order::row_major || cols <= 1 ||
+        (rows <= 1 && matrix.outer_stride() == 1)) {
+        // Rows are contiguous.
+        const std::size_t row_stride =
+            (matrix.order() == storage_order::row_major)
+            ? matrix.outer_stride()
+            : 1;
+        for (std::size_t i = 0; i < rows; ++i) {
+            function(i, matrix.data() + i * row_stride);
+        }
+        return;
+    }
+
+    const std::size_t block_rows = std::min(rows, matrix_gather_block_rows);
+    // std::vector is not used to support bool.
+    // NOLINTNEXTLINE(*-avoid-c-arrays)
+    const auto buffer = std::make_unique<T[]>(block_rows * cols);
+    for (std::size_t row_begin = 0; row_begin < rows;
+        row_begin += block_rows) {
+        const std::size_t num_rows = std::min(block_rows, rows - row_begin);
+        for (std::size_t j = 0; j < cols; ++j) {
+            const T* column =
+                matrix.data() + j * matrix.outer_stride() + row_begin;
+            for (std::size_t k = 0; k < num_rows; ++k) {
+                buffer[k * cols + j] = column[k];
+            }
+        }
+        for (std::size_t k = 0; k < num_rows; ++k) {
+            function(row_begin + k, buffer.get() + k * cols);
+        }
+    }
+}
+
+/*!
+ * \brief Implementation of json_converter class for matrices.
+ *
+ * \tparam T Type of values.
+ */
+template <typename T>
+class matrix_json_converter {
+public:
+    /*!
+     * \brief Convert a matrix to a JSON array of rows.
+     *
+     * \param[in] from Matrix to convert from.
+     * \param[out] to JSON value to convert to.
+     */
+    static void to_json(const matrix_view<T>& from, json_value& to) {
+        details::check_assignment(to);
+        yyjson_mut_set_arr(to.internal_value());
+        yyjson_mut_arr_clear(to.internal_value());
+        for_each_matrix_row(from, [&to, &from](std::size_t /*row*/,
+                                      const T* values) {
+            if constexpr (is_json_number_v<T>) {
+                append_number_array(values, from.cols(), to);
+            } else {
+                auto row_json = to.emplace_back();
+                yyjson_mut_set_arr(row_json.internal_value());
+                for (std::size_t j = 0; j < from.cols(); ++j) {
+                    row_json.push_back(values[j]);
+                }
+            }
+        });
+    }
+};
+
+}  // namespace details
+
+/*!
+ * \brief Specialization of json_converter class for matrix_view.
+ *
+ * \tparam T Type of values.
+ */
+template <typename T>
+class json_converter<matrix_view<T>>
+    : public details::matrix_json_converter<T> {};
+
+}  // namespace plotly_plotter
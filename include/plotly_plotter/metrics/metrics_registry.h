@@ -0,0 +1,328 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of metrics_registry class.
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <string_view>
+
+#include "plotly_plotter/details/plotly_plotter_export.h"
+
+namespace plotly_plotter::metrics {
+
+/*!
+ * \brief Enumeration of counters.
+ */
+enum class counter_type : std::size_t {
+    //! Number of created figures.
+    figures_created,
+
+    //! Number of created traces.
+    traces_created,
+
+    //! Number of serialized JSON values.
+    json_nodes_serialized,
+
+    //! Number of bytes of serialized JSON.
+    json_bytes_serialized,
+
+    //! Number of bytes written to files and file descriptors.
+    bytes_written,
+
+    //! Number of spawned subprocesses.
+    subprocesses_spawned,
+
+    //! Number of failed conversions. (Including timeouts.)
+    conversion_failures,
+
+    //! Number of subprocesses terminated due to timeouts.
+    conversion_timeouts
+};
+
+//! Number of types of counters.
+inline constexpr std::size_t num_counter_types = 8;
+
+/*!
+ * \brief Get the name of a counter.
+ *
+ * \param[in] type Type of the counter.
+ * \return Name. (Same as the name of the enumerator.)
+ */
+[[nodiscard]] PLOTLY_PLOTTER_EXPORT std::string_view counter_name(
+    counter_type type) noexcept;
+
+/*!
+ * \brief Enumeration of converters.
+ */
+enum class converter_type : std::size_t {
+    //! playwright_converter.
+    playwright,
+
+    //! chrome_converter.
+    chrome,
+
+    //! pdftocairo_converter.
+    pdftocairo
+};
+
+//! Number of types of converters.
+inline constexpr std::size_t num_converter_types = 3;
+
+/*!
+ * \brief Get the name of a converter.
+ *
+ * \param[in] type Type of the converter.
+ * \return Name of the converter class. (e.g., `chrome_converter`.)
+ */
+[[nodiscard]] PLOTLY_PLOTTER_EXPORT std::string_view converter_name(
+    converter_type type) noexcept;
+
+//! Number of buckets in histograms of latencies.
+inline constexpr std::size_t num_latency_buckets = 16;
+
+/*!
+ * \brief Get the upper bound of a bucket in histograms of latencies.
+ *
+ * \param[in] index Index of the bucket.
+ * \return Upper bound in seconds. (Infinity for the last bucket.)
+ */
+[[nodiscard]] PLOTLY_PLOTTER_EXPORT double latency_bucket_upper_bound(
+    std::size_t index) noexcept;
+
+/*!
+ * \brief Struct of histograms of latencies.
+ */
+struct latency_histogram {
+    //! Number of samples in each bucket. (Not cumulative.)
+    std::array<std::uint64_t, num_latency_buckets> bucket_counts{};
+
+    //! Total number of samples.
+    std::uint64_t count{};
+
+    //! Sum of latencies in seconds.
+    double sum_seconds{};
+};
+
+/*!
+ * \brief Struct of snapshots of metrics.
+ */
+struct metrics_snapshot {
+    //! Values of counters in the order of counter_type.
+    std::array<std::uint64_t, num_counter_types> counters{};
+
+    //! Histograms of latencies of conversions in the order of converter_type.
+    std::array<latency_histogram, num_converter_types> conversion_latencies{};
+
+    /*!
+     * \brief Get the value of a counter.
+     *
+     * \param[in] type Type of the counter.
+     * \return Value.
+     */
+    [[nodiscard]] std::uint64_t counter(counter_type type) const noexcept {
+        return counters[static_cast<std::size_t>(type)];
+    }
+
+    /*!
+     * \brief Get the histogram of latencies of a converter.
+     *
+     * \param[in] type Type of the converter.
+     * \return Histogram.
+     */
+    [[nodiscard]] const latency_histogram& conversion_latency(
+        converter_type type) const noexcept {
+        return conversion_latencies[static_cast<std::size_t>(type)];
+    }
+};
+
+/*!
+ * \brief Class of the process-wide registry of metrics.
+ *
+ * Metrics are updated using atomic operations without locks,
+ * so this class can be used from any thread.
+ *
+ * \note Metrics are collected only after enable function is called.
+ * \note Values in a snapshot are read one by one, so a snapshot taken
+ * during updates can mix values before and after the updates.
+ */
+class PLOTLY_PLOTTER_EXPORT metrics_registry {
+public:
+    /*!
+     * \brief Get the singleton instance.
+     *
+     * \return The singleton instance.
+     */
+    [[nodiscard]] static metrics_registry& get_instance();
+
+    /*!
+     * \brief Enable collection of metrics.
+     */
+    void enable() noexcept;
+
+    /*!
+     * \brief Disable collection of metrics.
+     *
+     * \note Collected values are kept.
+     */
+    void disable() noexcept;
+
+    /*!
+     * \brief Check whether collection of metrics is enabled.
+     *
+     * \return Whether collection of metrics is enabled.
+     */
+    [[nodiscard]] bool is_enabled() const noexcept {
+        return is_enabled_.load(std::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief Add a value to a counter.
+     *
+     * \param[in] type Type of the counter.
+     * \param[in] value Value to add.
+     */
+    void add(counter_type type, std::uint64_t value = 1) noexcept {
+        if (!is_enabled()) {
+            return;
+        }
+        counters_[static_cast<std::size_t>(type)].fetch_add(
+            value, std::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief Record a latency of a conversion.
+     *
+     * \param[in] type Type of the converter.
+     * \param[in] latency Latency.
+     */
+    void record_conversion_latency(
+        converter_type type, std::chrono::nanoseconds latency) noexcept;
+
+    /*!
+     * \brief Take a snapshot of metrics.
+     *
+     * \return Snapshot.
+     */
+    [[nodiscard]] metrics_snapshot snapshot() const noexcept;
+
+    /*!
+     * \brief Reset all metrics to zero.
+     */
+    void reset() noexcept;
+
+    metrics_registry(const metrics_registry&) = delete;
+    metrics_registry(metrics_registry&&) = delete;
+    metrics_registry& operator=(const metrics_registry&) = delete;
+    metrics_registry& operator=(metrics_registry&&) = delete;
+
+private:
+    /*!
+     * \brief Constructor.
+     */
+    metrics_registry() = default;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~metrics_registry() = default;
+
+    /*!
+     * \brief Struct of histograms updated atomically.
+     */
+    struct atomic_latency_histogram {
+        //! Number of samples in each bucket.
+        std::array<std::atomic<std::uint64_t>, num_latency_buckets>
+            bucket_counts{};
+
+        //! Total number of samples.
+        std::atomic<std::uint64_t> count{0};
+
+        //! Sum of latencies in nanoseconds.
+        std::atomic<std::uint64_t> sum_nanoseconds{0};
+    };
+
+    //! Whether collection of metrics is enabled.
+    std::atomic<bool> is_enabled_{false};
+
+    //! Counters.
+    std::array<std::atomic<std::uint64_t>, num_counter_types> counters_{};
+
+    //! Histograms of latencies of conversions.
+    std::array<atomic_latency_histogram, num_converter_types>
+        conversion_latencies_{};
+};
+
+/*!
+ * \brief Class to measure a conversion in a scope.
+ *
+ * The latency of the conversion is recorded at the destruction of an object,
+ * and a failure is counted if the scope is exited by an exception.
+ */
+class scoped_conversion_measurement {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] type Type of the converter.
+     */
+    explicit scoped_conversion_measurement(converter_type type) noexcept
+        : type_(type),
+          num_uncaught_exceptions_(std::uncaught_exceptions()),
+          start_(std::chrono::steady_clock::now()) {}
+
+    scoped_conversion_measurement(
+        const scoped_conversion_measurement&) = delete;
+    scoped_conversion_measurement(scoped_conversion_measurement&&) = delete;
+    scoped_conversion_measurement& operator=(
+        const scoped_conversion_measurement&) = delete;
+    scoped_conversion_measurement& operator=(
+        scoped_conversion_measurement&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~scoped_conversion_measurement() noexcept {
+        auto& registry = metrics_registry::get_instance();
+        if (!registry.is_enabled()) {
+            return;
+        }
+        registry.record_conversion_latency(
+            type_, std::chrono::steady_clock::now() - start_);
+        if (std::uncaught_exceptions() > num_uncaught_exceptions_) {
+            registry.add(counter_type::conversion_failures);
+        }
+    }
+
+private:
+    //! Type of the converter.
+    converter_type type_;
+
+    //! Number of uncaught exceptions at the construction.
+    int num_uncaught_exceptions_;
+
+    //! Time when the conversion started.
+    std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace plotly_plotter::metrics
@@ -23,6 +23,7 @@
 
 #include <string_view>
 
+#include "plotly_plotter/array_view.h"
 #include "plotly_plotter/json_converter.h"  // IWYU pragma: export
 #include "plotly_plotter/json_value.h"
 #include "plotly_plotter/traces/xy_trace_base.h"
@@ -110,6 +111,97 @@ public:
         }
     }
 
+    /*!
+     * \brief Set the precomputed first quartiles of boxes.
+     *
+     * \tparam Container Type of the container of values.
+     * \param[in] values Values. (One value for each box.)
+     *
+     * \note The container must support `std::begin` and `std::end` functions.
+     */
+    template <typename Container>
+    void q1(const Container& values) {
+        this->data()["q1"] = as_array(values);
+    }
+
+    /*!
+     * \brief Set the precomputed medians of boxes.
+     *
+     * \tparam Container Type of the container of values.
+     * \param[in] values Values. (One value for each box.)
+     *
+     * \note The container must support `std::begin` and `std::end` functions.
+     */
+    template <typename Container>
+    void median(const Container& values) {
+        this->data()["median"] = as_array(values);
+    }
+
+    /*!
+     * \brief Set the precomputed third quartiles of boxes.
+     *
+     * \tparam Container Type of the container of values.
+     * \param[in] values Values. (One value for each box.)
+     *
+     * \note The container must support `std::begin` and `std::end` functions.
+     */
+    template <typename Container>
+    void q3(const Container& values) {
+        this->data()["q3"] = as_array(values);
+    }
+
+    /*!
+     * \brief Set the precomputed lower fences of boxes.
+     *
+     * \tparam Container Type of the container of values.
+     * \param[in] values Values. (One value for each box.)
+     *
+     * \note The container must support `std::begin` and `std::end` functions.
+     */
+    template <typename Container>
+    void lower_fence(const Container& values) {
+        this->data()["lowerfence"] = as_array(values);
+    }
+
+    /*!
+     * \brief Set the precomputed upper fences of boxes.
+     *
+     * \tparam Container Type of the container of values.
+     * \param[in] values Values. (One value for each box.)
+     *
+     * \note The container must support `std::begin` and `std::end` functions.
+     */
+    template <typename Container>
+    void upper_fence(const Container& values) {
+        this->data()["upperfence"] = as_array(values);
+    }
+
+    /*!
+     * \brief Set the precomputed means of boxes.
+     *
+     * \tparam Container Type of the container of values.
+     * \param[in] values Values. (One value for each box.)
+     *
+     * \note The container must support `std::begin` and `std::end` functions.
+     */
+    template <typename Container>
+    void mean(const Container& values) {
+        this->data()["mean"] = as_array(values);
+    }
+
+    /*!
+     * \brief Set the precomputed standard deviations of boxes.
+     *
+     * \tparam Container Type of the container of values.
+     * \param[in] values Values. (One value for each box.)
+     *
+     * \note The container must support `std::begin` and `std::end` functions.
+     */
+    template <typename Container>
+    void sd(const Container& values) {
+        this->data()["sd"] = as_array(values);
+    }
+
     /*!
      * \brief Set the color.
      *
@@ -122,6 +214,13 @@ public:
         this->data()["line"]["color"] = value;
     }
 
+    /*!
+     * \brief Set the width of boxes in the unit of positions.
+     *
+     * \param[in] value Value. (0 to determine automatically.)
+     */
+    void width(double value) { this->data()["width"] = value; }
+
     /*!
      * \brief Set the group for offset.
      *
@@ -278,6 +278,27 @@ public:
         return scatter_marker(this->data()["marker"]);
     }
 
+    /*!
+     * \brief Set how to fill areas.
+     *
+     * \param[in] value Value.
+     *
+     * Selection:
+     *
+     * - `"none"`
+     * - `"tozeroy"`
+     * - `"tozerox"`
+     * - `"tonexty"`
+     * - `"tonextx"`
+     * - `"toself"`: fill the closed shape of the trace
+     * (or each segment separated by gaps)
+     * - `"tonext"`
+     */
+    void fill(std::string_view value) {  // NOLINT(*-member-function-const)
+        // This function modifies the internal state.
+        this->data()["fill"] = value;
+    }
+
     /*!
      * \brief Set the color.
      *
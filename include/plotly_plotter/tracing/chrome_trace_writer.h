@@ -0,0 +1,81 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of chrome_trace_writer class.
+ */
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "plotly_plotter/details/plotly_plotter_export.h"
+#include "plotly_plotter/tracing/tracer.h"
+
+namespace plotly_plotter::tracing {
+
+/*!
+ * \brief Class of tracers to write spans in the trace event format of Chrome.
+ *
+ * Written files can be viewed in Perfetto UI or `chrome://tracing`.
+ *
+ * \note Spans are stored in memory until flush function is called.
+ */
+class PLOTLY_PLOTTER_EXPORT chrome_trace_writer final : public tracer {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] file_path Path of the file to write spans.
+     */
+    explicit chrome_trace_writer(std::string file_path);
+
+    chrome_trace_writer(const chrome_trace_writer&) = delete;
+    chrome_trace_writer(chrome_trace_writer&&) = delete;
+    chrome_trace_writer& operator=(const chrome_trace_writer&) = delete;
+    chrome_trace_writer& operator=(chrome_trace_writer&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     *
+     * \note This function writes spans to the file.
+     */
+    ~chrome_trace_writer() override;
+
+    //! \copydoc tracer::record
+    void record(const span_record& record) override;
+
+    /*!
+     * \brief Write all spans recorded until now to the file.
+     */
+    void flush();
+
+private:
+    //! Path of the file.
+    std::string file_path_;
+
+    //! Mutex of records.
+    std::mutex mutex_;
+
+    //! Records.
+    std::vector<span_record> records_;
+
+    //! Time used as the origin of timestamps.
+    clock_type::time_point origin_;
+};
+
+}  // namespace plotly_plotter::tracing
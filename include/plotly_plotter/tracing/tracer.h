@@ -0,0 +1,190 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of tracer class and macros of spans.
+ */
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+#include "plotly_plotter/details/config.h"
+#include "plotly_plotter/details/plotly_plotter_export.h"
+
+namespace plotly_plotter::tracing {
+
+//! Type of clocks used in tracing.
+using clock_type = std::chrono::steady_clock;
+
+/*!
+ * \brief Struct of records of spans.
+ */
+struct span_record {
+    //! Name of the span. (A string literal.)
+    const char* name;
+
+    //! Category of the span. (A string literal.)
+    const char* category;
+
+    //! Time when the span started.
+    clock_type::time_point start;
+
+    //! Time when the span finished.
+    clock_type::time_point finish;
+
+    //! Index of the thread assigned in this library.
+    std::uint32_t thread_index;
+};
+
+/*!
+ * \brief Base class of tracers receiving spans.
+ *
+ * \note Implementations must be thread-safe,
+ * because spans are recorded in any thread.
+ */
+class PLOTLY_PLOTTER_EXPORT tracer {
+public:
+    /*!
+     * \brief Record a span.
+     *
+     * \param[in] record Record of the span.
+     */
+    virtual void record(const span_record& record) = 0;
+
+    /*!
+     * \brief Constructor.
+     */
+    tracer() = default;
+
+    /*!
+     * \brief Destructor.
+     */
+    virtual ~tracer();
+
+    tracer(const tracer&) = delete;
+    tracer(tracer&&) = delete;
+    tracer& operator=(const tracer&) = delete;
+    tracer& operator=(tracer&&) = delete;
+};
+
+/*!
+ * \brief Set the process-wide tracer.
+ *
+ * \param[in] new_tracer Tracer. (Null to disable tracing.)
+ *
+ * \note Spans are recorded only when this library is built with
+ * `PLOTLY_PLOTTER_ENABLE_TRACING` CMake option.
+ */
+PLOTLY_PLOTTER_EXPORT void set_tracer(std::shared_ptr<tracer> new_tracer);
+
+/*!
+ * \brief Get the process-wide tracer.
+ *
+ * \return Tracer. (Null if not set.)
+ */
+[[nodiscard]] PLOTLY_PLOTTER_EXPORT std::shared_ptr<tracer> get_tracer();
+
+/*!
+ * \brief Get the index of the current thread.
+ *
+ * \return Index of the current thread.
+ */
+[[nodiscard]] PLOTLY_PLOTTER_EXPORT std::uint32_t current_thread_index();
+
+/*!
+ * \brief Class of scoped spans.
+ *
+ * A span starts at the construction of an object
+ * and finishes at the destruction of the object.
+ */
+class scoped_span {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] name Name of the span. (A string literal.)
+     * \param[in] category Category of the span. (A string literal.)
+     */
+    scoped_span(const char* name, const char* category)
+        : tracer_(get_tracer()), name_(name), category_(category) {
+        if (tracer_) {
+            start_ = clock_type::now();
+        }
+    }
+
+    scoped_span(const scoped_span&) = delete;
+    scoped_span(scoped_span&&) = delete;
+    scoped_span& operator=(const scoped_span&) = delete;
+    scoped_span& operator=(scoped_span&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~scoped_span() noexcept {
+        if (!tracer_) {
+            return;
+        }
+        try {
+            tracer_->record(span_record{name_, category_, start_,
+                clock_type::now(), current_thread_index()});
+        } catch (...) {
+            // Failures of tracing must not affect the traced process.
+        }
+    }
+
+private:
+    //! Tracer.
+    std::shared_ptr<tracer> tracer_;
+
+    //! Name of the span.
+    const char* name_;
+
+    //! Category of the span.
+    const char* category_;
+
+    //! Time when the span started.
+    clock_type::time_point start_{};
+};
+
+}  // namespace plotly_plotter::tracing
+
+//! \cond
+#define PLOTLY_PLOTTER_TRACE_CONCAT_IMPL(A, B) A##B
+#define PLOTLY_PLOTTER_TRACE_CONCAT(A, B) PLOTLY_PLOTTER_TRACE_CONCAT_IMPL(A, B)
+//! \endcond
+
+#if PLOTLY_PLOTTER_ENABLE_TRACING
+
+/*!
+ * \brief Macro to trace the current scope as a span.
+ *
+ * \param[in] NAME Name of the span. (A string literal.)
+ * \param[in] CATEGORY Category of the span. (A string literal.)
+ *
+ * \note This macro is expanded to nothing when tracing is disabled in the
+ * build.
+ */
+#define PLOTLY_PLOTTER_TRACE_SPAN(NAME, CATEGORY)                             \
+    const ::plotly_plotter::tracing::scoped_span PLOTLY_PLOTTER_TRACE_CONCAT( \
+        plotly_plotter_trace_span_, __LINE__)(NAME, CATEGORY)
+
+#else
+
+#define PLOTLY_PLOTTER_TRACE_SPAN(NAME, CATEGORY) static_cast<void>(0)
+
+#endif
@@ -0,0 +1,245 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of typed_array_view class.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "plotly_plotter/details/encode_base64.h"
+#include "plotly_plotter/json_converter.h"
+#include "plotly_plotter/json_converter_decl.h"
+#include "plotly_plotter/json_value.h"
+#include "plotly_plotter/matrix_view.h"
+
+namespace plotly_plotter {
+
+/*!
+ * \brief Class of views of arrays converted to typed arrays in plotly.js.
+ *
+ * \tparam T Type of values.
+ *
+ * Typed arrays are written as objects with `dtype`, `bdata` (binary data in
+ * Base64), and `shape` (only for matrices), which plotly.js decodes to
+ * JavaScript typed arrays. Typed arrays are much smaller than JSON arrays of
+ * numbers and don't require a JSON value for each number.
+ *
+ * \note This class doesn't manage the memory of the buffer.
+ * So, the buffer must be valid while this object is used.
+ * \note 64-bit integers are not supported in plotly.js.
+ * \note Non-finite values are written as they are.
+ */
+template <typename T>
+class typed_array_view {
+public:
+    //! Type of values.
+    using value_type = T;
+
+    /*!
+     * \brief Constructor of a one-dimensional array.
+     *
+     * \param[in] data Pointer to the buffer.
+     * \param[in] size Number of values.
+     */
+    typed_array_view(const T* data, std::size_t size) noexcept
+        : matrix_(data, 1, size), is_matrix_(false) {}
+
+    /*!
+     * \brief Constructor of a matrix.
+     *
+     * \param[in] matrix Matrix.
+     * \param[in] is_matrix Whether to output the values as a matrix.
+     * If false, the values are output as a one-dimensional array in the order
+     * of rows, which is useful for vectors with strides.
+     */
+    explicit typed_array_view(
+        const matrix_view<T>& matrix, bool is_matrix = true) noexcept
+        : matrix_(matrix), is_matrix_(is_matrix) {}
+
+    /*!
+     * \brief Get the values as a matrix.
+     *
+     * \return Matrix. (A matrix with a row for one-dimensional arrays.)
+     */
+    [[nodiscard]] const matrix_view<T>& matrix() const noexcept {
+        return matrix_;
+    }
+
+    /*!
+     * \brief Check whether this object is a matrix.
+     *
+     * \return Whether this object is a matrix.
+     */
+    [[nodiscard]] bool is_matrix() const noexcept { return is_matrix_; }
+
+private:
+    //! Values.
+    matrix_view<T> matrix_;
+
+    //! Whether this object is a matrix.
+    bool is_matrix_;
+};
+
+/*!
+ * \brief Create a view of an array converted to a typed array.
+ *
+ * \tparam T Type of values.
+ * \param[in] data Pointer to the buffer.
+ * \param[in] size Number of values.
+ * \return View.
+ */
+template <typename T>
+[[nodiscard]] typed_array_view<T> as_typed_array(
+    const T* data, std::size_t size) {
+    return typed_array_view<T>(data, size);
+}
+
+/*!
+ * \brief Create a view of a vector converted to a typed array.
+ *
+ * \tparam T Type of values.
+ * \tparam Allocator Type of the allocator.
+ * \param[in] values Vector.
+ * \return View.
+ */
+template <typename T, typename Allocator>
+[[nodiscard]] typed_array_view<T> as_typed_array(
+    const std::vector<T, Allocator>& values) {
+    return typed_array_view<T>(values.data(), values.size());
+}
+
+/*!
+ * \brief Create a view of a matrix converted to a typed array.
+ *
+ * \tparam T Type of values.
+ * \param[in] matrix Matrix.
+ * \return View.
+ */
+template <typename T>
+[[nodiscard]] typed_array_view<T> as_typed_array(
+    const matrix_view<T>& matrix) {
+    return typed_array_view<T>(matrix);
+}
+
+namespace details {
+
+/*!
+ * \brief Get the type name of typed arrays in plotly.js.
+ *
+ * \tparam T Type of values.
+ * \return Type name.
+ */
+template <typename T>
+[[nodiscard]] constexpr std::string_view typed_array_dtype() noexcept {
+    static_assert((std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+                      sizeof(T) <= 4) ||
+            std::is_same_v<T, double>,
+        "Type not supported in typed arrays of plotly.js.");
+    if constexpr (std::is_same_v<T, float>) {
+        return "f4";
+    } else if constexpr (std::is_same_v<T, double>) {
+        return "f8";
+    } else if constexpr (std::is_signed_v<T>) {
+        if constexpr (sizeof(T) == 1) {
+            return "i1";
+        } else if constexpr (sizeof(T) == 2) {
+            return "i2";
+        } else {
+            return "i4";
+        }
+    } else {
+        if constexpr (sizeof(T) == 1) {
+            return "u1";
+        } else if constexpr (sizeof(T) == 2) {
+            return "u2";
+        } else {
+            return "u4";
+        }
+    }
+}
+
+/*!
+ * \brief Append values to bytes in little endian.
+ *
+ * \tparam T Type of values.
+ * \param[in] values Pointer to the values.
+ * \param[in] size Number of values.
+ * \param[out] bytes Bytes.
+ */
+template <typename T>
+void append_little_endian(
+    const T* values, std::size_t size, std::string& bytes) {
+    using bits_type = std::conditional_t<sizeof(T) == 1, std::uint8_t,
+        std::conditional_t<sizeof(T) == 2, std::uint16_t,
+            std::conditional_t<sizeof(T) == 4, std::uint32_t,
+                std::uint64_t>>>;
+    static_assert(sizeof(bits_type) == sizeof(T));
+    constexpr unsigned int bits_per_byte = 8;
+    for (std::size_t i = 0; i < size; ++i) {
+        bits_type bits{};
+        std::memcpy(&bits, values + i, sizeof(T));
+        for (std::size_t byte = 0; byte < sizeof(T); ++byte) {
+            bytes.push_back(static_cast<char>(
+                static_cast<std::uint8_t>(bits >> (byte * bits_per_byte))));
+        }
+    }
+}
+
+}  // namespace details
+
+/*!
+ * \brief Specialization of json_converter class for typed_array_view.
+ *
+ * \tparam T Type of values.
+ */
+template <typename T>
+class json_converter<typed_array_view<T>> {
+public:
+    /*!
+     * \brief Convert an object to a JSON value.
+     *
+     * \param[in] from Object to convert from.
+     * \param[out] to JSON value to convert to.
+     */
+    static void to_json(const typed_array_view<T>& from, json_value& to) {
+        details::check_assignment(to);
+        const matrix_view<T>& matrix = from.matrix();
+
+        std::string bytes;
+        bytes.reserve(matrix.rows() * matrix.cols() * sizeof(T));
+        details::for_each_matrix_row(
+            matrix, [&bytes, &matrix](std::size_t /*row*/, const T* values) {
+                details::append_little_endian(values, matrix.cols(), bytes);
+            });
+
+        to["dtype"] = details::typed_array_dtype<T>();
+        to["bdata"] = details::encode_base64(bytes);
+        if (from.is_matrix()) {
+            to["shape"] = std::to_string(matrix.rows()) + ", " +
+                std::to_string(matrix.cols());
+        }
+    }
+};
+
+}  // namespace plotly_plotter
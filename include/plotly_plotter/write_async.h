@@ -0,0 +1,133 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions to write figures asynchronously.
+ */
+#pragma once
+
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "plotly_plotter/figure.h"
+#include "plotly_plotter/io/export_executor.h"
+#include "plotly_plotter/write_pdf.h"
+#include "plotly_plotter/write_png.h"
+#include "plotly_plotter/write_svg.h"
+
+namespace plotly_plotter {
+
+namespace details {
+
+/*!
+ * \brief Submit a job to write a figure.
+ *
+ * \tparam Writer Type of the function to write the figure.
+ * \param[in] executor Executor.
+ * \param[in] file_path File path.
+ * \param[in] fig Figure.
+ * \param[in] writer Function to write the figure.
+ * \return Future of the result.
+ */
+template <typename Writer>
+[[nodiscard]] std::future<void> submit_write_job(
+    io::export_executor& executor, std::string file_path, figure fig,
+    Writer writer) {
+    // std::function requires copyable functions, so the figure is shared.
+    auto shared_fig = std::make_shared<const figure>(std::move(fig));
+    return executor.submit(
+        [file_path = std::move(file_path), shared_fig = std::move(shared_fig),
+            writer = std::move(writer)] { writer(file_path, *shared_fig); });
+}
+
+}  // namespace details
+
+/*!
+ * \brief Write a figure to a PNG file asynchronously.
+ *
+ * \param[in] file_path File path.
+ * \param[in] fig Figure.
+ * \param[in] width Width of the PNG file.
+ * \param[in] height Height of the PNG file.
+ * \param[in] executor Executor.
+ * \return Future of the result.
+ *
+ * \note This function blocks while the queue of the executor is full.
+ * \note Errors are reported as exceptions from the returned future.
+ */
+[[nodiscard]] inline std::future<void> write_png_async(std::string file_path,
+    figure fig, std::size_t width = default_png_width,
+    std::size_t height = default_png_height,
+    io::export_executor& executor = io::export_executor::get_instance()) {
+    return details::submit_write_job(executor, std::move(file_path),
+        std::move(fig),
+        [width, height](const std::string& path, const figure& target) {
+            write_png(path, target, width, height);
+        });
+}
+
+/*!
+ * \brief Write a figure to a PDF file asynchronously.
+ *
+ * \param[in] file_path File path.
+ * \param[in] fig Figure.
+ * \param[in] width Width of the PDF file.
+ * \param[in] height Height of the PDF file.
+ * \param[in] executor Executor.
+ * \return Future of the result.
+ *
+ * \note This function blocks while the queue of the executor is full.
+ * \note Errors are reported as exceptions from the returned future.
+ */
+[[nodiscard]] inline std::future<void> write_pdf_async(std::string file_path,
+    figure fig, std::size_t width = default_pdf_width,
+    std::size_t height = default_pdf_height,
+    io::export_executor& executor = io::export_executor::get_instance()) {
+    return details::submit_write_job(executor, std::move(file_path),
+        std::move(fig),
+        [width, height](const std::string& path, const figure& target) {
+            write_pdf(path, target, width, height);
+        });
+}
+
+/*!
+ * \brief Write a figure to a SVG file asynchronously.
+ *
+ * \param[in] file_path File path.
+ * \param[in] fig Figure.
+ * \param[in] width Width of the SVG file.
+ * \param[in] height Height of the SVG file.
+ * \param[in] executor Executor.
+ * \return Future of the result.
+ *
+ * \note This function blocks while the queue of the executor is full.
+ * \note Errors are reported as exceptions from the returned future.
+ */
+[[nodiscard]] inline std::future<void> write_svg_async(std::string file_path,
+    figure fig, std::size_t width = default_svg_width,
+    std::size_t height = default_svg_height,
+    io::export_executor& executor = io::export_executor::get_instance()) {
+    return details::submit_write_job(executor, std::move(file_path),
+        std::move(fig),
+        [width, height](const std::string& path, const figure& target) {
+            write_svg(path, target, width, height);
+        });
+}
+
+}  // namespace plotly_plotter
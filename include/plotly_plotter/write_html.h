@@ -23,6 +23,7 @@
 
 #include "plotly_plotter/details/write_html_impl.h"
 #include "plotly_plotter/figure.h"
+#include "plotly_plotter/io/output_sink.h"
 
 namespace plotly_plotter {
 
@@ -40,4 +41,53 @@ inline void write_html(const std::string& file_path, const figure& fig) {
         0, 0);
 }
 
+/*!
+ * \brief Write a figure in HTML to a sink.
+ *
+ * \param[in] sink Sink.
+ * \param[in] fig Figure.
+ *
+ * \note Sinks in \ref plotly_plotter::io namespace can be used to write
+ * HTML to memory buffers, streams, file descriptors, and callbacks.
+ */
+inline void write_html_to(io::output_sink& sink, const figure& fig) {
+    details::write_html_impl(sink, fig.html_title().c_str(), fig.document(),
+        details::html_template_type::html,
+        // Width and height are not used for HTML output, so arbitrary values
+        // can be used.
+        0, 0);
+}
+
+/*!
+ * \brief Write a frozen figure to an HTML file.
+ *
+ * \param[in] file_path File path.
+ * \param[in] fig Frozen figure.
+ */
+inline void write_html(const std::string& file_path, const frozen_figure& fig) {
+    details::write_html_impl(file_path.c_str(), fig.html_title().c_str(),
+        details::html_figure_data{
+            fig.escaped_data(), fig.has_frames(), fig.has_shared_arrays()},
+        details::html_template_type::html,
+        // Width and height are not used for HTML output, so arbitrary values
+        // can be used.
+        0, 0);
+}
+
+/*!
+ * \brief Write a frozen figure in HTML to a sink.
+ *
+ * \param[in] sink Sink.
+ * \param[in] fig Frozen figure.
+ */
+inline void write_html_to(io::output_sink& sink, const frozen_figure& fig) {
+    details::write_html_impl(sink, fig.html_title().c_str(),
+        details::html_figure_data{
+            fig.escaped_data(), fig.has_frames(), fig.has_shared_arrays()},
+        details::html_template_type::html,
+        // Width and height are not used for HTML output, so arbitrary values
+        // can be used.
+        0, 0);
+}
+
 }  // namespace plotly_plotter
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of write_html_page function.
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "plotly_plotter/details/plotly_plotter_export.h"
+#include "plotly_plotter/figure.h"
+#include "plotly_plotter/json_document.h"
+
+namespace plotly_plotter {
+
+//! Default height of figures in HTML pages in pixels.
+constexpr std::size_t default_html_page_figure_height = 600;
+
+namespace details {
+
+/*!
+ * \brief Write figures to an HTML page.
+ *
+ * \param[in] file_path File path.
+ * \param[in] html_title Title of the HTML file.
+ * \param[in] documents Data of figures.
+ * \param[in] num_documents Number of figures.
+ * \param[in] figure_height Height of figures in pixels.
+ */
+PLOTLY_PLOTTER_EXPORT void write_html_page_impl(const char* file_path,
+    const char* html_title, const json_document* const* documents,
+    std::size_t num_documents, std::size_t figure_height);
+
+}  // namespace details
+
+/*!
+ * \brief Write figures to an HTML page.
+ *
+ * \param[in] file_path File path.
+ * \param[in] figures Figures.
+ * \param[in] html_title Title of the HTML file.
+ * \param[in] figure_height Height of figures in pixels.
+ *
+ * \note Libraries are loaded only once in the page,
+ * and identical templates of figures are written only once.
+ * \note Figures are rendered when they are scrolled into view.
+ */
+inline void write_html_page(const std::string& file_path,
+    const std::vector<figure>& figures,
+    const std::string& html_title = "Untitled Plots",
+    std::size_t figure_height = default_html_page_figure_height) {
+    std::vector<const json_document*> documents;
+    documents.reserve(figures.size());
+    for (const auto& fig : figures) {
+        documents.push_back(&fig.document());
+    }
+    details::write_html_page_impl(file_path.c_str(), html_title.c_str(),
+        documents.data(), documents.size(), figure_height);
+}
+
+}  // namespace plotly_plotter
@@ -23,6 +23,7 @@
 #include <string>
 
 #include "plotly_plotter/details/plotly_plotter_export.h"
+#include "plotly_plotter/details/write_html_impl.h"
 #include "plotly_plotter/figure.h"
 #include "plotly_plotter/json_document.h"
 
@@ -49,6 +50,19 @@ PLOTLY_PLOTTER_EXPORT void write_svg_impl(const char* file_path,
     const char* html_title, const json_document& data, std::size_t width,
     std::size_t height);
 
+/*!
+ * \brief Write a figure to a SVG file.
+ *
+ * \param[in] file_path File path.
+ * \param[in] html_title Title of the HTML file.
+ * \param[in] data Data prepared for HTML.
+ * \param[in] width Width of the SVG file.
+ * \param[in] height Height of the SVG file.
+ */
+PLOTLY_PLOTTER_EXPORT void write_svg_impl(const char* file_path,
+    const char* html_title, const html_figure_data& data, std::size_t width,
+    std::size_t height);
+
 }  // namespace details
 
 /*!
@@ -80,4 +94,24 @@ inline void write_svg(const std::string& file_path, const figure& fig,
         fig.document(), width, height);
 }
 
+/*!
+ * \brief Write a frozen figure to a SVG file.
+ *
+ * \param[in] file_path File path.
+ * \param[in] fig Frozen figure.
+ * \param[in] width Width of the SVG file.
+ * \param[in] height Height of the SVG file.
+ *
+ * \note Support of SVG output can be checked using \ref
+ * plotly_plotter::is_svg_supported function.
+ */
+inline void write_svg(const std::string& file_path, const frozen_figure& fig,
+    std::size_t width = default_svg_width,
+    std::size_t height = default_svg_height) {
+    details::write_svg_impl(file_path.c_str(), fig.html_title().c_str(),
+        details::html_figure_data{
+            fig.escaped_data(), fig.has_frames(), fig.has_shared_arrays()},
+        width, height);
+}
+
 }  // namespace plotly_plotter
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""Convert results of benchmarks in Catch2 XML format to JSON."""
+
+import json
+import pathlib
+import typing
+import xml.etree.ElementTree as ET
+
+import click
+
+
+def _parse_estimate(element: typing.Optional[ET.Element]) -> dict[str, float]:
+    """Parse an estimate of a statistic.
+
+    Args:
+        element (typing.Optional[ET.Element]): XML element of the estimate.
+
+    Returns:
+        dict[str, float]: Value and bounds of the estimate in nanoseconds.
+    """
+    if element is None:
+        return {}
+    return {
+        "value_ns": float(element.attrib["value"]),
+        "lower_bound_ns": float(element.attrib["lowerBound"]),
+        "upper_bound_ns": float(element.attrib["upperBound"]),
+    }
+
+
+def convert_bench_results(xml_path: pathlib.Path) -> list[dict[str, typing.Any]]:
+    """Convert results of benchmarks.
+
+    Args:
+        xml_path (pathlib.Path): Path of the XML file written by Catch2.
+
+    Returns:
+        list[dict[str, typing.Any]]: Results of benchmarks.
+    """
+    root = ET.parse(str(xml_path)).getroot()
+    results: list[dict[str, typing.Any]] = []
+    for test_case in root.iter("TestCase"):
+        for benchmark in test_case.iter("BenchmarkResults"):
+            results.append(
+                {
+                    "test_case": test_case.attrib["name"],
+                    "name": benchmark.attrib["name"],
+                    "samples": int(benchmark.attrib["samples"]),
+                    "iterations": int(benchmark.attrib["iterations"]),
+                    "mean": _parse_estimate(benchmark.find("mean")),
+                    "standard_deviation": _parse_estimate(
+                        benchmark.find("standardDeviation")
+                    ),
+                }
+            )
+    return results
+
+
+@click.command()
+@click.argument("xml_path", type=click.Path(exists=True, path_type=pathlib.Path))
+@click.argument("json_path", type=click.Path(path_type=pathlib.Path))
+def main(xml_path: pathlib.Path, json_path: pathlib.Path) -> None:
+    """Convert results of benchmarks in XML_PATH to JSON_PATH."""
+    results = convert_bench_results(xml_path)
+    with open(str(json_path), mode="w", encoding="utf-8") as file:
+        json.dump({"benchmarks": results}, file, indent=2)
+
+
+if __name__ == "__main__":
+    main()  # pylint: disable=no-value-parameter
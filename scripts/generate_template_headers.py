@@ -2,15 +2,70 @@
 """Script to generate C++ header files for templates."""
 
 import pathlib
+import re
 import subprocess
+import typing
 
 THIS_DIR = pathlib.Path(__file__).parent
 ROOT_DIR = THIS_DIR.parent
 TEMPLATE_HEADER_DIR = ROOT_DIR / "include" / "plotly_plotter" / "details" / "templates"
+INCLUDE_PATTERN = re.compile(r'^( *)\{% include "([^"]+)" %\}\n', re.MULTILINE)
+CONDITION_PATTERN = re.compile(
+    r"^ *\{% if (\w+) %\}\n(.*?)^ *\{% endif %\}\n", re.MULTILINE | re.DOTALL
+)
+
+
+def _select_blocks(contents: str, conditions: typing.AbstractSet[str]) -> str:
+    """Select conditional blocks in a template.
+
+    Templates are rendered in C++ with only placeholders of variables,
+    so conditional blocks are selected here generating a variant of the template
+    for each set of conditions.
+
+    Args:
+        contents (str): Contents of the template.
+        conditions (typing.AbstractSet[str]): Names of conditions which are true.
+
+    Returns:
+        str: Contents with blocks of true conditions and without other blocks.
+    """
+    return CONDITION_PATTERN.sub(
+        lambda match: match.group(2) if match.group(1) in conditions else "",
+        contents,
+    )
+
+
+def _expand_includes(contents: str, directory: pathlib.Path) -> str:
+    """Expand include directives in a template.
+
+    Templates are rendered in C++ with only placeholders of variables,
+    so included files are expanded here with the indentation of the directives.
+
+    Args:
+        contents (str): Contents of the template.
+        directory (pathlib.Path): Directory of the template.
+
+    Returns:
+        str: Contents with included files expanded.
+    """
+
+    def _replace(match: re.Match) -> str:
+        indent = match.group(1)
+        with open(str(directory / match.group(2)), "r", encoding="utf-8") as file:
+            included = file.read()
+        return "".join(
+            indent + line if line.strip() else line
+            for line in included.splitlines(keepends=True)
+        )
+
+    return INCLUDE_PATTERN.sub(_replace, contents)
 
 
 def _generate_template_header(
-    template_name: str, source_path: str, template_description: str
+    template_name: str,
+    source_path: str,
+    template_description: str,
+    conditions: typing.AbstractSet[str] = frozenset(),
 ) -> None:
     """Generate a C++ header file for a template.
 
@@ -18,10 +73,14 @@ def _generate_template_header(
         template_name (str): Name of the template.
         source_path (str): Path to the source file.
         template_description (str): Description of the template.
+        conditions (typing.AbstractSet[str]): Names of conditions which are true
+            in conditional blocks.
     """
     html_path = THIS_DIR / source_path
     with open(str(html_path), "r", encoding="utf-8") as file:
-        html_contents = file.read()
+        html_contents = _expand_includes(
+            _select_blocks(file.read(), conditions), html_path.parent
+        )
 
     relative_html_path = html_path.relative_to(ROOT_DIR)
     header_path = TEMPLATE_HEADER_DIR / f"{template_name}.h"
@@ -74,21 +133,61 @@ def generate_template_header() -> None:
         source_path="templates/plotly_plot.html.jinja",
         template_description="HTML template for plots in Plotly.",
     )
+    _generate_template_header(
+        template_name="plotly_plot_with_shared_arrays",
+        source_path="templates/plotly_plot.html.jinja",
+        template_description="HTML template for plots in Plotly with shared arrays.",
+        conditions={"shared_arrays"},
+    )
     _generate_template_header(
         template_name="plotly_plot_with_frames",
         source_path="templates/plotly_plot_with_frames.html.jinja",
         template_description="HTML template for plots in Plotly with frames.",
     )
+    _generate_template_header(
+        template_name="plotly_plot_with_frames_with_shared_arrays",
+        source_path="templates/plotly_plot_with_frames.html.jinja",
+        template_description="HTML template for plots in Plotly with frames with shared arrays.",
+        conditions={"shared_arrays"},
+    )
     _generate_template_header(
         template_name="plotly_plot_pdf",
         source_path="templates/plotly_plot_pdf.html.jinja",
         template_description="HTML template for plots in Plotly for PDF generation.",
     )
+    _generate_template_header(
+        template_name="plotly_plot_pdf_with_shared_arrays",
+        source_path="templates/plotly_plot_pdf.html.jinja",
+        template_description="HTML template for plots in Plotly for PDF generation with shared arrays.",
+        conditions={"shared_arrays"},
+    )
     _generate_template_header(
         template_name="plotly_plot_png",
         source_path="templates/plotly_plot_png.html.jinja",
         template_description="HTML template for plots in Plotly for PNG generation.",
     )
+    _generate_template_header(
+        template_name="plotly_plot_png_with_shared_arrays",
+        source_path="templates/plotly_plot_png.html.jinja",
+        template_description="HTML template for plots in Plotly for PNG generation with shared arrays.",
+        conditions={"shared_arrays"},
+    )
+    _generate_template_header(
+        template_name="plotly_page",
+        source_path="templates/plotly_page.html.jinja",
+        template_description="HTML template for pages with multiple plots in Plotly.",
+    )
+    _generate_template_header(
+        template_name="plotly_page_with_shared_arrays",
+        source_path="templates/plotly_page.html.jinja",
+        template_description="HTML template for pages with multiple plots in Plotly with shared arrays.",
+        conditions={"shared_arrays"},
+    )
+    _generate_template_header(
+        template_name="plotly_page_figure",
+        source_path="templates/plotly_page_figure.html.jinja",
+        template_description="HTML template for each plot in pages with multiple plots.",
+    )
     _generate_template_header(
         template_name="generate_pdf_with_playwright",
         source_path="generate_pdf_with_playwright.py",
@@ -12,6 +12,7 @@ SOURCE_PATHS = [
     THIS_DIR.parent / "tests" / "integ" / "traces",
     THIS_DIR.parent / "tests" / "integ" / "figure_builders",
     THIS_DIR.parent / "tests" / "integ" / "outputs",
+    THIS_DIR.parent / "tests" / "bench",
 ]
 
 UNITY_SRC_SUFFIX = "unity_source.cpp"
@@ -0,0 +1,279 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of compress_uniform_coordinates function.
+ */
+#include "plotly_plotter/details/compress_uniform_coordinates.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <yyjson.h>
+
+#include "plotly_plotter/tracing/tracer.h"
+
+namespace plotly_plotter::details {
+
+namespace {
+
+//! Tolerance of differences from the sequence relative to the step.
+constexpr double step_relative_tolerance = 1e-9;
+
+//! Tolerance of differences from the sequence relative to the coordinates.
+constexpr double rounding_relative_tolerance =
+    8.0 * std::numeric_limits<double>::epsilon();
+
+/*!
+ * \brief Struct of keys of a coordinate in traces.
+ */
+struct coordinate_keys {
+    //! Key of the array of coordinates.
+    const char* array_key;
+
+    //! Key of the first coordinate.
+    const char* start_key;
+
+    //! Key of the step.
+    const char* step_key;
+
+    //! Whether the coordinate is along columns of z in heatmaps.
+    bool is_along_columns;
+};
+
+//! Keys of coordinates.
+constexpr std::array<coordinate_keys, 2> coordinates{{
+    {"x", "x0", "dx", true},
+    {"y", "y0", "dy", false},
+}};
+
+/*!
+ * \brief Check whether a trace has a type.
+ *
+ * \param[in] trace Trace.
+ * \param[in] type Type.
+ * \return Whether the trace has the type.
+ */
+[[nodiscard]] bool has_type(yyjson_mut_val* trace, const char* type) {
+    return yyjson_mut_equals_str(yyjson_mut_obj_get(trace, "type"), type);
+}
+
+/*!
+ * \brief Check whether coordinates of a trace can be compressed.
+ *
+ * \param[in] trace Trace.
+ * \return Whether coordinates of the trace can be compressed.
+ */
+[[nodiscard]] bool is_supported_trace(yyjson_mut_val* trace) {
+    return has_type(trace, "scatter") || has_type(trace, "scattergl") ||
+        has_type(trace, "bar") || has_type(trace, "heatmap");
+}
+
+/*!
+ * \brief Get the number of cells of a heatmap along a coordinate.
+ *
+ * \param[in] trace Trace.
+ * \param[in] is_along_columns Whether the coordinate is along columns of z.
+ * \return Number of cells, or null if z is not set.
+ */
+[[nodiscard]] std::optional<std::size_t> count_heatmap_cells(
+    yyjson_mut_val* trace, bool is_along_columns) {
+    yyjson_mut_val* z = yyjson_mut_obj_get(trace, "z");
+    if (!yyjson_mut_is_arr(z)) {
+        return std::nullopt;
+    }
+    if (!is_along_columns) {
+        return yyjson_mut_arr_size(z);
+    }
+    yyjson_mut_val* first_row = yyjson_mut_arr_get_first(z);
+    if (!yyjson_mut_is_arr(first_row)) {
+        return std::nullopt;
+    }
+    return yyjson_mut_arr_size(first_row);
+}
+
+/*!
+ * \brief Calculate the spacing of coordinates in a trace.
+ *
+ * \param[in] trace Trace.
+ * \param[in] base_trace Trace in the figure corresponding to the trace.
+ * (The same as trace for traces not in animation frames.)
+ * \param[in] keys Keys of the coordinate.
+ * \param[in] min_size Minimum number of elements of coordinates to compress.
+ * \param[in,out] buffer Buffer of coordinates.
+ * \return Spacing, or null if the coordinates can't be compressed.
+ */
+[[nodiscard]] std::optional<uniform_spacing> calculate_spacing(
+    yyjson_mut_val* trace, yyjson_mut_val* base_trace,
+    const coordinate_keys& keys, std::size_t min_size,
+    std::vector<double>& buffer) {
+    yyjson_mut_val* array = yyjson_mut_obj_get(trace, keys.array_key);
+    if (!yyjson_mut_is_arr(array)) {
+        return std::nullopt;
+    }
+    const std::size_t size = yyjson_mut_arr_size(array);
+    if (size < min_size) {
+        return std::nullopt;
+    }
+
+    buffer.clear();
+    buffer.reserve(size);
+    yyjson_mut_arr_iter iter;
+    yyjson_mut_arr_iter_init(array, &iter);
+    while (yyjson_mut_val* element = yyjson_mut_arr_iter_next(&iter)) {
+        if (!yyjson_mut_is_num(element)) {
+            return std::nullopt;
+        }
+        buffer.push_back(yyjson_mut_get_num(element));
+    }
+
+    auto spacing = detect_uniform_spacing(buffer.data(), buffer.size());
+    if (!spacing || !has_type(base_trace, "heatmap")) {
+        return spacing;
+    }
+
+    // Heatmaps accept coordinates of both centers and edges of cells, but
+    // x0 and y0 are always the centers.
+    auto num_cells = count_heatmap_cells(trace, keys.is_along_columns);
+    if (!num_cells) {
+        num_cells = count_heatmap_cells(base_trace, keys.is_along_columns);
+    }
+    if (!num_cells) {
+        return std::nullopt;
+    }
+    if (size == *num_cells + 1) {
+        constexpr double half = 0.5;
+        spacing->start += half * spacing->step;
+    } else if (size != *num_cells) {
+        return std::nullopt;
+    }
+    return spacing;
+}
+
+}  // namespace
+
+std::optional<uniform_spacing> detect_uniform_spacing(
+    const double* values, std::size_t size) noexcept {
+    if (size < 2) {
+        return std::nullopt;
+    }
+    const double start = values[0];
+    const double last = values[size - 1];
+    const double step = (last - start) / static_cast<double>(size - 1);
+    if (!std::isfinite(step) || step == 0.0) {
+        return std::nullopt;
+    }
+    const double tolerance = step_relative_tolerance * std::abs(step) +
+        rounding_relative_tolerance * std::max(std::abs(start), std::abs(last));
+
+    // This loop has no branch to be vectorized.
+    bool is_uniform = true;
+    for (std::size_t i = 0; i < size; ++i) {
+        const double expected = start + step * static_cast<double>(i);
+        is_uniform &= std::abs(values[i] - expected) <= tolerance;
+    }
+    if (!is_uniform) {
+        return std::nullopt;
+    }
+    return uniform_spacing{start, step};
+}
+
+std::size_t compress_uniform_coordinates(
+    json_document& document, std::size_t min_size) {
+    PLOTLY_PLOTTER_TRACE_SPAN("compress_uniform_coordinates", "json");
+    yyjson_mut_val* root = document.root().internal_value();
+    yyjson_mut_doc* internal_document = document.root().internal_document();
+    yyjson_mut_val* traces = yyjson_mut_obj_get(root, "data");
+    if (!yyjson_mut_is_arr(traces)) {
+        return 0;
+    }
+    const std::size_t num_traces = yyjson_mut_arr_size(traces);
+
+    // Traces in frames are paired with traces in the figure by indices.
+    std::vector<yyjson_mut_val*> frame_traces;
+    yyjson_mut_val* frames = yyjson_mut_obj_get(root, "frames");
+    if (yyjson_mut_is_arr(frames)) {
+        yyjson_mut_arr_iter iter;
+        yyjson_mut_arr_iter_init(frames, &iter);
+        while (yyjson_mut_val* frame = yyjson_mut_arr_iter_next(&iter)) {
+            yyjson_mut_val* frame_data = yyjson_mut_obj_get(frame, "data");
+            if (!yyjson_mut_is_arr(frame_data) ||
+                yyjson_mut_arr_size(frame_data) != num_traces) {
+                return 0;
+            }
+            frame_traces.push_back(frame_data);
+        }
+    }
+
+    std::size_t num_removed_arrays = 0;
+    std::vector<double> buffer;
+    std::vector<std::pair<yyjson_mut_val*, uniform_spacing>> targets;
+    for (std::size_t trace_index = 0; trace_index < num_traces;
+        ++trace_index) {
+        yyjson_mut_val* base_trace = yyjson_mut_arr_get(traces, trace_index);
+        if (!is_supported_trace(base_trace)) {
+            continue;
+        }
+        for (const auto& keys : coordinates) {
+            const auto base_spacing = calculate_spacing(
+                base_trace, base_trace, keys, min_size, buffer);
+            if (!base_spacing) {
+                continue;
+            }
+            targets.clear();
+            targets.emplace_back(base_trace, *base_spacing);
+            bool is_compressible = true;
+            for (yyjson_mut_val* frame_data : frame_traces) {
+                yyjson_mut_val* trace =
+                    yyjson_mut_arr_get(frame_data, trace_index);
+                if (yyjson_mut_obj_get(trace, keys.array_key) == nullptr) {
+                    // Coordinates in the figure are used.
+                    continue;
+                }
+                const auto spacing = calculate_spacing(
+                    trace, base_trace, keys, min_size, buffer);
+                if (!spacing) {
+                    is_compressible = false;
+                    break;
+                }
+                targets.emplace_back(trace, *spacing);
+            }
+            if (!is_compressible) {
+                continue;
+            }
+
+            for (const auto& [trace, spacing] : targets) {
+                yyjson_mut_obj_remove_key(trace, keys.array_key);
+                yyjson_mut_obj_put(trace,
+                    yyjson_mut_str(internal_document, keys.start_key),
+                    yyjson_mut_real(internal_document, spacing.start));
+                yyjson_mut_obj_put(trace,
+                    yyjson_mut_str(internal_document, keys.step_key),
+                    yyjson_mut_real(internal_document, spacing.step));
+                ++num_removed_arrays;
+            }
+        }
+    }
+    return num_removed_arrays;
+}
+
+}  // namespace plotly_plotter::details
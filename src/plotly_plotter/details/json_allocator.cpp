@@ -0,0 +1,57 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of json_allocator class.
+ */
+#include "plotly_plotter/details/json_allocator.h"
+
+#include <cstdlib>
+
+namespace plotly_plotter::details {
+
+json_allocator::json_allocator() noexcept
+    : allocator_{&json_allocator::allocate, &json_allocator::reallocate,
+          &json_allocator::deallocate, this} {}
+
+void* json_allocator::allocate(void* context, std::size_t size) noexcept {
+    // NOLINTNEXTLINE(*-no-malloc): Required by an external library.
+    void* pointer = std::malloc(size);
+    if (pointer != nullptr) {
+        static_cast<json_allocator*>(context)->allocated_bytes_ += size;
+    }
+    return pointer;
+}
+
+void* json_allocator::reallocate(void* context, void* pointer,
+    std::size_t old_size, std::size_t size) noexcept {
+    // NOLINTNEXTLINE(*-no-malloc): Required by an external library.
+    void* new_pointer = std::realloc(pointer, size);
+    if (new_pointer != nullptr) {
+        auto& allocated_bytes =
+            static_cast<json_allocator*>(context)->allocated_bytes_;
+        allocated_bytes = allocated_bytes - old_size + size;
+    }
+    return new_pointer;
+}
+
+void json_allocator::deallocate(void* context, void* pointer) noexcept {
+    (void)context;
+    // NOLINTNEXTLINE(*-no-malloc): Required by an external library.
+    std::free(pointer);
+}
+
+}  // namespace plotly_plotter::details
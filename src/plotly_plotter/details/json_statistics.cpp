@@ -0,0 +1,111 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of functions to compute statistics of JSON values.
+ */
+#include "plotly_plotter/details/json_statistics.h"
+
+#include <array>
+#include <cstddef>
+
+#include "plotly_plotter/json_document.h"
+
+namespace plotly_plotter::details {
+
+namespace {
+
+//! Size of buffers to write numbers required by yyjson.
+constexpr std::size_t number_buffer_size = 40;
+
+/*!
+ * \brief Get the length of a number written by yyjson.
+ *
+ * \param[in] value Number.
+ * \return Length.
+ */
+[[nodiscard]] std::size_t written_number_length(yyjson_mut_val* value) {
+    std::array<char, number_buffer_size> buffer{};
+    const char* end = yyjson_mut_write_number(value, buffer.data());
+    if (end == nullptr) {
+        // Serialization of numbers like NaN fails.
+        return 0;
+    }
+    return static_cast<std::size_t>(end - buffer.data());
+}
+
+}  // namespace
+
+void accumulate_json_statistics(
+    yyjson_mut_val* value, json_statistics& statistics) {
+    ++statistics.num_nodes;
+    if (yyjson_mut_is_arr(value)) {
+        const std::size_t size = yyjson_mut_arr_size(value);
+        // Brackets and commas.
+        statistics.estimated_serialized_size += 2 + (size > 0 ? size - 1 : 0);
+        yyjson_mut_arr_iter iter;
+        yyjson_mut_arr_iter_init(value, &iter);
+        while (yyjson_mut_val* element = yyjson_mut_arr_iter_next(&iter)) {
+            accumulate_json_statistics(element, statistics);
+        }
+    } else if (yyjson_mut_is_obj(value)) {
+        const std::size_t size = yyjson_mut_obj_size(value);
+        // Braces, commas, and colons.
+        statistics.estimated_serialized_size +=
+            2 + (size > 0 ? size - 1 : 0) + size;
+        yyjson_mut_obj_iter iter;
+        yyjson_mut_obj_iter_init(value, &iter);
+        while (yyjson_mut_val* key = yyjson_mut_obj_iter_next(&iter)) {
+            const std::size_t key_length = yyjson_mut_get_len(key);
+            statistics.string_bytes += key_length;
+            statistics.estimated_serialized_size += key_length + 2;
+            accumulate_json_statistics(
+                yyjson_mut_obj_iter_get_val(key), statistics);
+        }
+    } else if (yyjson_mut_is_str(value)) {
+        const std::size_t length = yyjson_mut_get_len(value);
+        statistics.string_bytes += length;
+        statistics.estimated_serialized_size += length + 2;
+    } else if (yyjson_mut_is_raw(value)) {
+        statistics.estimated_serialized_size += yyjson_mut_get_len(value);
+    } else if (yyjson_mut_is_num(value)) {
+        statistics.estimated_serialized_size += written_number_length(value);
+    } else if (yyjson_mut_is_false(value)) {
+        statistics.estimated_serialized_size += 5;  // "false"
+    } else {
+        statistics.estimated_serialized_size += 4;  // "true" or "null"
+    }
+}
+
+std::uint64_t count_json_nodes(yyjson_mut_val* value) {
+    std::uint64_t count = 1;
+    if (yyjson_mut_is_arr(value)) {
+        yyjson_mut_arr_iter iter;
+        yyjson_mut_arr_iter_init(value, &iter);
+        while (yyjson_mut_val* element = yyjson_mut_arr_iter_next(&iter)) {
+            count += count_json_nodes(element);
+        }
+    } else if (yyjson_mut_is_obj(value)) {
+        yyjson_mut_obj_iter iter;
+        yyjson_mut_obj_iter_init(value, &iter);
+        while (yyjson_mut_val* key = yyjson_mut_obj_iter_next(&iter)) {
+            count += count_json_nodes(yyjson_mut_obj_iter_get_val(key));
+        }
+    }
+    return count;
+}
+
+}  // namespace plotly_plotter::details
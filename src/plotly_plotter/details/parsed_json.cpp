@@ -0,0 +1,137 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of parsed_json class.
+ */
+#include "plotly_plotter/details/parsed_json.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+#include <fmt/format.h>
+
+#include "plotly_plotter/details/file_handle.h"
+#include "plotly_plotter/tracing/tracer.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace plotly_plotter::details {
+
+std::shared_ptr<const parsed_json> parsed_json::parse_file(
+    const std::string& file_path) {
+    PLOTLY_PLOTTER_TRACE_SPAN("parsed_json::parse_file", "json");
+    // Constructor is private, so std::make_shared can't be used.
+    std::shared_ptr<parsed_json> result(new parsed_json());
+    result->load(file_path);
+
+    yyjson_read_err error{};
+    result->document_ = yyjson_read_opts(result->buffer_, result->file_size_,
+        YYJSON_READ_INSITU, nullptr, &error);
+    if (result->document_ == nullptr) {
+        throw std::runtime_error(
+            fmt::format("Failed to parse JSON file {} at {}: {}", file_path,
+                error.pos, error.msg != nullptr ? error.msg : "unknown error"));
+    }
+    return result;
+}
+
+parsed_json::~parsed_json() {
+    if (document_ != nullptr) {
+        yyjson_doc_free(document_);
+    }
+    if (buffer_ == nullptr) {
+        return;
+    }
+#ifndef _WIN32
+    if (is_memory_mapped_) {
+        (void)munmap(buffer_, buffer_size_);
+        return;
+    }
+#endif
+    // NOLINTNEXTLINE(*-no-malloc): Paired with malloc in load function.
+    std::free(buffer_);
+}
+
+void parsed_json::load(const std::string& file_path) {
+#ifndef _WIN32
+    // NOLINTNEXTLINE(*-vararg)
+    const int descriptor = ::open(file_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (descriptor == -1) {
+        throw std::runtime_error("Failed to open file: " + file_path);
+    }
+    struct stat file_status {};
+    if (::fstat(descriptor, &file_status) != 0) {
+        (void)::close(descriptor);
+        throw std::runtime_error(
+            "Failed to get the size of file: " + file_path);
+    }
+    file_size_ = static_cast<std::size_t>(file_status.st_size);
+
+    // In-situ parsing requires YYJSON_PADDING_SIZE bytes after the data.
+    // Bytes after the end of a file in the last page of the mapping are
+    // readable and filled with zeros, so the file is mapped only when the
+    // last page has enough space.
+    const auto page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    const std::size_t remaining_in_last_page =
+        (page_size - file_size_ % page_size) % page_size;
+    if (file_size_ > 0 && remaining_in_last_page >= YYJSON_PADDING_SIZE) {
+        // Private mapping is used, because in-situ parsing writes unescaped
+        // strings to the buffer. Only pages with changes are copied.
+        void* mapped = ::mmap(nullptr, file_size_, PROT_READ | PROT_WRITE,
+            MAP_PRIVATE, descriptor, 0);
+        if (mapped != MAP_FAILED) {
+            (void)::close(descriptor);
+            buffer_ = static_cast<char*>(mapped);
+            buffer_size_ = file_size_;
+            is_memory_mapped_ = true;
+            return;
+        }
+    }
+    (void)::close(descriptor);
+#endif
+
+    // Fallback to read the whole file into a buffer.
+    file_handle file(file_path, "rb");
+    if (std::fseek(file.get(), 0, SEEK_END) != 0) {
+        throw std::runtime_error("Failed to seek file: " + file_path);
+    }
+    const long size = std::ftell(file.get());
+    if (size < 0 || std::fseek(file.get(), 0, SEEK_SET) != 0) {
+        throw std::runtime_error(
+            "Failed to get the size of file: " + file_path);
+    }
+    file_size_ = static_cast<std::size_t>(size);
+    buffer_size_ = file_size_ + YYJSON_PADDING_SIZE;
+    // NOLINTNEXTLINE(*-no-malloc): yyjson requires a padded buffer.
+    buffer_ = static_cast<char*>(std::malloc(buffer_size_));
+    if (buffer_ == nullptr) {
+        throw std::runtime_error("Failed to allocate memory.");
+    }
+    std::memset(buffer_ + file_size_, 0, YYJSON_PADDING_SIZE);
+    if (std::fread(buffer_, 1, file_size_, file.get()) != file_size_) {
+        throw std::runtime_error("Failed to read file: " + file_path);
+    }
+}
+
+}  // namespace plotly_plotter::details
@@ -0,0 +1,230 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of share_repeated_arrays function.
+ */
+#include "plotly_plotter/details/share_repeated_arrays.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <yyjson.h>
+
+#include "plotly_plotter/tracing/tracer.h"
+
+namespace plotly_plotter::details {
+
+namespace {
+
+/*!
+ * \brief Combine a hash value to another hash value.
+ *
+ * \param[in,out] seed Hash value to update.
+ * \param[in] value Hash value to combine.
+ */
+void combine_hash(std::size_t& seed, std::size_t value) noexcept {
+    constexpr std::size_t magic = 0x9E3779B9;
+    constexpr unsigned int left_shift = 6;
+    constexpr unsigned int right_shift = 2;
+    seed ^= value + magic + (seed << left_shift) + (seed >> right_shift);
+}
+
+/*!
+ * \brief Calculate the hash value of an array of scalar values.
+ *
+ * \param[in] array Array.
+ * \return Hash value, or null if the array contains containers.
+ */
+[[nodiscard]] std::optional<std::size_t> hash_scalar_array(
+    yyjson_mut_val* array) {
+    std::size_t hash = yyjson_mut_arr_size(array);
+    yyjson_mut_arr_iter iter;
+    yyjson_mut_arr_iter_init(array, &iter);
+    while (yyjson_mut_val* element = yyjson_mut_arr_iter_next(&iter)) {
+        if (yyjson_mut_is_ctn(element)) {
+            return std::nullopt;
+        }
+        combine_hash(
+            hash, static_cast<std::size_t>(yyjson_mut_get_type(element)));
+        if (yyjson_mut_is_str(element)) {
+            combine_hash(hash,
+                std::hash<std::string_view>()(std::string_view(
+                    yyjson_mut_get_str(element), yyjson_mut_get_len(element))));
+        } else if (yyjson_mut_is_uint(element)) {
+            combine_hash(hash,
+                std::hash<std::uint64_t>()(yyjson_mut_get_uint(element)));
+        } else if (yyjson_mut_is_sint(element)) {
+            combine_hash(hash,
+                std::hash<std::int64_t>()(yyjson_mut_get_sint(element)));
+        } else if (yyjson_mut_is_real(element)) {
+            const double value = yyjson_mut_get_real(element);
+            std::uint64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(bits));
+            combine_hash(hash, std::hash<std::uint64_t>()(bits));
+        } else if (yyjson_mut_is_true(element)) {
+            combine_hash(hash, 1U);
+        }
+    }
+    return hash;
+}
+
+/*!
+ * \brief Struct of arrays with the same contents.
+ */
+struct array_group {
+    //! Arrays.
+    std::vector<yyjson_mut_val*> arrays;
+};
+
+/*!
+ * \brief Class to find arrays with the same contents.
+ */
+class repeated_array_finder {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] min_size Minimum number of elements of arrays to share.
+     */
+    explicit repeated_array_finder(std::size_t min_size) noexcept
+        : min_size_(min_size) {}
+
+    /*!
+     * \brief Find arrays in a tree of values.
+     *
+     * \param[in] value Root of the tree.
+     */
+    void find(yyjson_mut_val* value) {
+        if (yyjson_mut_is_arr(value)) {
+            if (yyjson_mut_arr_size(value) >= min_size_) {
+                const auto hash = hash_scalar_array(value);
+                if (hash) {
+                    add(*hash, value);
+                    return;
+                }
+            }
+            yyjson_mut_arr_iter iter;
+            yyjson_mut_arr_iter_init(value, &iter);
+            while (yyjson_mut_val* element = yyjson_mut_arr_iter_next(&iter)) {
+                find(element);
+            }
+        } else if (yyjson_mut_is_obj(value)) {
+            yyjson_mut_obj_iter iter;
+            yyjson_mut_obj_iter_init(value, &iter);
+            while (yyjson_mut_val* key = yyjson_mut_obj_iter_next(&iter)) {
+                find(yyjson_mut_obj_iter_get_val(key));
+            }
+        }
+    }
+
+    /*!
+     * \brief Get the groups of arrays in the order of the first occurrences.
+     *
+     * \return Groups.
+     */
+    [[nodiscard]] const std::vector<array_group>& groups() const noexcept {
+        return groups_;
+    }
+
+private:
+    /*!
+     * \brief Add an array.
+     *
+     * \param[in] hash Hash value of the array.
+     * \param[in] array Array.
+     */
+    void add(std::size_t hash, yyjson_mut_val* array) {
+        auto& group_indices = hash_to_groups_[hash];
+        for (const std::size_t group_index : group_indices) {
+            auto& group = groups_[group_index];
+            if (yyjson_mut_equals(group.arrays.front(), array)) {
+                group.arrays.push_back(array);
+                return;
+            }
+        }
+        group_indices.push_back(groups_.size());
+        groups_.push_back(array_group{{array}});
+    }
+
+    //! Minimum number of elements of arrays to share.
+    std::size_t min_size_;
+
+    //! Groups of arrays.
+    std::vector<array_group> groups_;
+
+    //! Map of hash values to indices of groups.
+    std::unordered_map<std::size_t, std::vector<std::size_t>> hash_to_groups_;
+};
+
+}  // namespace
+
+std::size_t share_repeated_arrays(
+    json_document& document, std::size_t min_size) {
+    PLOTLY_PLOTTER_TRACE_SPAN("share_repeated_arrays", "json");
+    const json_value root = document.root();
+    yyjson_mut_val* root_value = root.internal_value();
+    yyjson_mut_doc* internal_document = root.internal_document();
+    if (!yyjson_mut_is_obj(root_value)) {
+        return 0;
+    }
+
+    repeated_array_finder finder(min_size);
+    yyjson_mut_val* table = nullptr;
+    yyjson_mut_obj_iter iter;
+    yyjson_mut_obj_iter_init(root_value, &iter);
+    while (yyjson_mut_val* key = yyjson_mut_obj_iter_next(&iter)) {
+        if (yyjson_mut_equals_str(key, shared_arrays_key)) {
+            // Arrays already shared are kept as is.
+            table = yyjson_mut_obj_iter_get_val(key);
+            continue;
+        }
+        finder.find(yyjson_mut_obj_iter_get_val(key));
+    }
+
+    std::size_t num_replaced_arrays = 0;
+    for (const auto& group : finder.groups()) {
+        if (group.arrays.size() < 2) {
+            continue;
+        }
+        if (table == nullptr) {
+            table = yyjson_mut_arr(internal_document);
+            yyjson_mut_obj_add(root_value,
+                yyjson_mut_str(internal_document, shared_arrays_key), table);
+        }
+        const std::size_t index = yyjson_mut_arr_size(table);
+        yyjson_mut_arr_append(table,
+            yyjson_mut_val_mut_copy(internal_document, group.arrays.front()));
+        for (yyjson_mut_val* array : group.arrays) {
+            // Arrays are replaced in place, because parents of arrays are
+            // unknown here.
+            yyjson_mut_set_obj(array);
+            yyjson_mut_obj_add(array,
+                yyjson_mut_str(internal_document, shared_array_reference_key),
+                yyjson_mut_uint(internal_document, index));
+            ++num_replaced_arrays;
+        }
+    }
+    return num_replaced_arrays;
+}
+
+}  // namespace plotly_plotter::details
@@ -19,98 +19,214 @@
  */
 #include "plotly_plotter/details/write_html_impl.h"
 
+#include <array>
 #include <cstddef>
+#include <initializer_list>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include <fmt/format.h>
 
 #include "plotly_plotter/details/escape_for_html.h"
-#include "plotly_plotter/details/file_handle.h"
+#include "plotly_plotter/details/compiled_template.h"
 #include "plotly_plotter/details/templates/plotly_plot.h"
 #include "plotly_plotter/details/templates/plotly_plot_pdf.h"
+#include "plotly_plotter/details/templates/plotly_plot_pdf_with_shared_arrays.h"
 #include "plotly_plotter/details/templates/plotly_plot_png.h"
+#include "plotly_plotter/details/templates/plotly_plot_png_with_shared_arrays.h"
 #include "plotly_plotter/details/templates/plotly_plot_with_frames.h"
+#include "plotly_plotter/details/templates/plotly_plot_with_frames_with_shared_arrays.h"
+#include "plotly_plotter/details/templates/plotly_plot_with_shared_arrays.h"
+#include "plotly_plotter/io/output_sink.h"
 #include "plotly_plotter/json_document.h"
+#include "plotly_plotter/tracing/tracer.h"
 
 namespace plotly_plotter::details {
 
 /*!
- * \brief Check whether an input string starts with a prefix.
+ * \brief Get the template.
  *
- * \param[in] string Input string.
- * \param[in] prefix Prefix.
- * \retval true Input string starts with the prefix.
- * \retval false Input string does not start with the prefix.
+ * \param[in] template_type Template type.
+ * \param[in] has_frames Whether the figure has frames of animation.
+ * \param[in] has_shared_arrays Whether the figure has arrays shared in the
+ * figure.
+ * \return Template.
  *
- * \note This function works like `std::string::starts_with` in C++20.
+ * \note Templates with the script to restore shared arrays are used only for
+ * figures with shared arrays, so that other figures are written without the
+ * script.
  */
-inline bool starts_with(std::string_view string, std::string_view prefix) {
-    return string.substr(0, prefix.size()) == prefix;
-}
+[[nodiscard]] const compiled_template& get_template(
+    html_template_type template_type, bool has_frames,
+    bool has_shared_arrays) {
+    static const std::initializer_list<std::string_view> placeholder_names{
+        "title", "escaped_data", "width", "height"};
+    static const compiled_template plot(
+        details::templates::plotly_plot, placeholder_names);
+    static const compiled_template plot_with_shared_arrays(
+        details::templates::plotly_plot_with_shared_arrays,
+        placeholder_names);
+    static const compiled_template plot_with_frames(
+        details::templates::plotly_plot_with_frames, placeholder_names);
+    static const compiled_template plot_with_frames_with_shared_arrays(
+        details::templates::plotly_plot_with_frames_with_shared_arrays,
+        placeholder_names);
+    static const compiled_template plot_pdf(
+        details::templates::plotly_plot_pdf, placeholder_names);
+    static const compiled_template plot_pdf_with_shared_arrays(
+        details::templates::plotly_plot_pdf_with_shared_arrays,
+        placeholder_names);
+    static const compiled_template plot_png(
+        details::templates::plotly_plot_png, placeholder_names);
+    static const compiled_template plot_png_with_shared_arrays(
+        details::templates::plotly_plot_png_with_shared_arrays,
+        placeholder_names);
 
-[[nodiscard]] std::string_view get_template(
-    html_template_type template_type, const json_document& data) {
     switch (template_type) {
     case html_template_type::html:
-        if (data.root().has("frames")) {
-            return details::templates::plotly_plot_with_frames;
+        if (has_frames) {
+            return has_shared_arrays ? plot_with_frames_with_shared_arrays
+                                     : plot_with_frames;
         }
-        return details::templates::plotly_plot;
+        return has_shared_arrays ? plot_with_shared_arrays : plot;
     case html_template_type::pdf:
-        return details::templates::plotly_plot_pdf;
+        return has_shared_arrays ? plot_pdf_with_shared_arrays : plot_pdf;
     case html_template_type::png:
-        return details::templates::plotly_plot_png;
+        return has_shared_arrays ? plot_png_with_shared_arrays : plot_png;
     default:
         throw std::runtime_error("Invalid template type.");
     }
 }
 
+std::string serialize_for_html(const json_document& data) {
+    const std::string serialized_data = data.serialize_to_string();
+    PLOTLY_PLOTTER_TRACE_SPAN("escape_for_html", "html");
+    return details::escape_for_html(serialized_data);
+}
+
 void write_html_impl(const char* file_path, const char* html_title,
     const json_document& data, html_template_type template_type,
     std::size_t width, std::size_t height) {
-    details::file_handle file(file_path, "w");
+    io::file_output_sink sink(file_path);
+    write_html_impl(sink, html_title, data, template_type, width, height);
+}
 
-    std::string_view remaining_template = get_template(template_type, data);
+void write_html_impl(io::output_sink& sink, const char* html_title,
+    const json_document& data, html_template_type template_type,
+    std::size_t width, std::size_t height) {
+    const std::string escaped_data = serialize_for_html(data);
+    write_html_impl(sink, html_title,
+        html_figure_data{escaped_data, data.has_root_key("frames"),
+            data.has_root_key("shared_arrays")},
+        template_type, width, height);
+}
 
-    while (!remaining_template.empty()) {
-        const std::size_t next_placeholder = remaining_template.find("{{");
-        if (next_placeholder == std::string_view::npos) {
-            file.write(remaining_template);
-            break;
-        }
-        file.write(remaining_template.substr(0, next_placeholder));
-        remaining_template = remaining_template.substr(next_placeholder);
-
-        constexpr std::string_view title_placeholder = "{{ title }}";
-        constexpr std::string_view escaped_data_placeholder =
-            "{{ escaped_data }}";
-        constexpr std::string_view width_placeholder = "{{ width }}";
-        constexpr std::string_view height_placeholder = "{{ height }}";
-        if (details::starts_with(remaining_template, title_placeholder)) {
-            file.write(details::escape_for_html(html_title));
-            remaining_template =
-                remaining_template.substr(title_placeholder.size());
-        } else if (details::starts_with(
-                       remaining_template, escaped_data_placeholder)) {
-            file.write(details::escape_for_html(data.serialize_to_string()));
-            remaining_template =
-                remaining_template.substr(escaped_data_placeholder.size());
-        } else if (details::starts_with(
-                       remaining_template, width_placeholder)) {
-            file.write(fmt::to_string(width));
-            remaining_template =
-                remaining_template.substr(width_placeholder.size());
-        } else if (details::starts_with(
-                       remaining_template, height_placeholder)) {
-            file.write(fmt::to_string(height));
-            remaining_template =
-                remaining_template.substr(height_placeholder.size());
-        } else {
-            throw std::runtime_error("Invalid placeholder in the template.");
-        }
+void write_html_impl(const char* file_path, const char* html_title,
+    const html_figure_data& data, html_template_type template_type,
+    std::size_t width, std::size_t height) {
+    io::file_output_sink sink(file_path);
+    write_html_impl(sink, html_title, data, template_type, width, height);
+}
+
+void write_html_impl(io::output_sink& sink, const char* html_title,
+    const html_figure_data& data, html_template_type template_type,
+    std::size_t width, std::size_t height) {
+    PLOTLY_PLOTTER_TRACE_SPAN("write_html", "html");
+    const compiled_template& html_template = get_template(
+        template_type, data.has_frames, data.has_shared_arrays);
+
+    // Values in the order of placeholder_names in get_template function.
+    const std::string escaped_title = details::escape_for_html(html_title);
+    const std::string width_str = fmt::to_string(width);
+    const std::string height_str = fmt::to_string(height);
+    const std::array<std::string_view, 4> values{
+        escaped_title, data.escaped_data, width_str, height_str};
+
+    std::vector<std::string_view> parts;
+    html_template.append_to(parts, values.data());
+    PLOTLY_PLOTTER_TRACE_SPAN("output_sink::write_parts", "io");
+    sink.write_parts(parts.data(), parts.size());
+}
+
+namespace {
+
+/*!
+ * \brief Get parts of the template for HTML with frames.
+ *
+ * \param[in] escaped_title Title escaped for HTML.
+ * \param[in] has_shared_arrays Whether the figure has arrays shared in the
+ * figure.
+ * \param[out] parts Parts of the template.
+ * \return Number of parts before the data of the figure.
+ */
+std::size_t get_parts_of_template_with_frames(std::string_view escaped_title,
+    bool has_shared_arrays, std::vector<std::string_view>& parts) {
+    constexpr bool has_frames = true;
+    const compiled_template& html_template = get_template(
+        html_template_type::html, has_frames, has_shared_arrays);
+
+    // Indices in the order of placeholder_names in get_template function.
+    constexpr std::size_t title_index = 0;
+    constexpr std::size_t escaped_data_index = 1;
+    std::size_t num_parts_before_data = 0;
+    html_template.append_to(
+        parts, [&](std::vector<std::string_view>& target, std::size_t index) {
+            if (index == title_index) {
+                target.emplace_back(escaped_title);
+            } else if (index == escaped_data_index) {
+                num_parts_before_data = target.size();
+            }
+            // Width and height are not used for HTML output.
+        });
+    return num_parts_before_data;
+}
+
+}  // namespace
+
+html_frame_stream_writer::html_frame_stream_writer(
+    io::output_sink& sink, const char* html_title)
+    : sink_(sink), escaped_title_(details::escape_for_html(html_title)) {
+    // Templates differ only after the data of the figure, so the template
+    // without shared arrays is used here.
+    constexpr bool has_shared_arrays = false;
+    std::vector<std::string_view> parts;
+    const std::size_t num_parts_before_data =
+        get_parts_of_template_with_frames(
+            escaped_title_, has_shared_arrays, parts);
+
+    sink_.write_parts(parts.data(), num_parts_before_data);
+    sink_.write(details::escape_for_html(R"({"frames":[)"));
+}
+
+void html_frame_stream_writer::write_frame(const json_document& frame) {
+    PLOTLY_PLOTTER_TRACE_SPAN("html_frame_stream_writer::write_frame", "html");
+    if (has_written_frame_) {
+        sink_.write(",");
     }
+    sink_.write(serialize_for_html(frame));
+    has_written_frame_ = true;
+}
+
+void html_frame_stream_writer::finish(const json_document& data) {
+    PLOTLY_PLOTTER_TRACE_SPAN("html_frame_stream_writer::finish", "html");
+    // The first character is the beginning of the object, which was already
+    // written before frames.
+    const std::string escaped_data = serialize_for_html(data);
+    if (escaped_data.size() <= 2) {
+        sink_.write("]}");
+    } else {
+        sink_.write("],");
+        sink_.write(std::string_view(escaped_data).substr(1));
+    }
+
+    std::vector<std::string_view> parts;
+    const std::size_t num_parts_before_data =
+        get_parts_of_template_with_frames(
+            escaped_title_, data.has_root_key("shared_arrays"), parts);
+    sink_.write_parts(parts.data() + num_parts_before_data,
+        parts.size() - num_parts_before_data);
 }
 
 }  // namespace plotly_plotter::details
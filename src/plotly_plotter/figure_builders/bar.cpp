@@ -19,6 +19,7 @@
  */
 #include "plotly_plotter/figure_builders/bar.h"
 
+#include <cstddef>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -30,6 +31,7 @@
 #include "plotly_plotter/figure.h"
 #include "plotly_plotter/figure_builders/details/calculate_axis_range.h"
 #include "plotly_plotter/figure_builders/details/figure_builder_helper.h"
+#include "plotly_plotter/figure_builders/details/group_aggregation.h"
 #include "plotly_plotter/layout.h"
 #include "plotly_plotter/traces/bar.h"
 
@@ -47,6 +49,20 @@ bar& bar::y(std::string value) {
     return *this;
 }
 
+bar& bar::function(aggregation_function value) {
+    function_ = value;
+    return *this;
+}
+
+bar& bar::quantile_probability(double value) {
+    if (!(value >= 0.0 && value <= 1.0)) {
+        throw std::invalid_argument(
+            "Probability of quantiles must be in [0, 1].");
+    }
+    quantile_probability_ = value;
+    return *this;
+}
+
 bar& bar::group(std::string value) {
     set_group(std::move(value));
     return *this;
@@ -113,10 +129,30 @@ bar& bar::title(std::string value) {
     return *this;
 }
 
+bar& bar::row_budget(std::size_t max_rows, row_budget_policy policy) {
+    set_row_budget(max_rows, policy);
+    return *this;
+}
+
+bar& bar::remove_constant_frame_attributes(bool value) {
+    set_remove_constant_frame_attributes(value);
+    return *this;
+}
+
+bar& bar::compress_uniform_coordinates(bool value) {
+    set_compress_uniform_coordinates(value);
+    return *this;
+}
+
+bar& bar::share_repeated_arrays(bool value) {
+    set_share_repeated_arrays(value);
+    return *this;
+}
+
 void bar::configure_axes(figure& fig, std::size_t num_subplot_rows,
     std::size_t num_subplot_columns, bool require_manual_axis_ranges) const {
     details::configure_axes_common(
-        fig, num_subplot_rows, num_subplot_columns, x_, y_);
+        fig, num_subplot_rows, num_subplot_columns, x_, value_name());
 
     // Set log scale.
     if (log_x_) {
@@ -147,8 +183,14 @@ void bar::configure_axes(figure& fig, std::size_t num_subplot_rows,
             }
         }
 
-        const auto [min_value, max_value] =
-            details::calculate_axis_range(data(), y_, extended_factor, log_y_);
+        // Aggregated values are used instead of y values when values are
+        // aggregated.
+        const auto [min_value, max_value] = function_
+            ? details::calculate_axis_range(
+                  data_column<double>(aggregate_values_in_all_traces()),
+                  extended_factor, log_y_)
+            : details::calculate_axis_range(
+                  data(), y_, extended_factor, log_y_);
         for (std::size_t i = 0; i < num_subplot_rows * num_subplot_columns;
             ++i) {
             const std::size_t index = i + 1;
@@ -157,28 +199,40 @@ void bar::configure_axes(figure& fig, std::size_t num_subplot_rows,
     }
 }
 
-std::string bar::default_title() const { return y_; }
+std::string bar::default_title() const { return value_name(); }
 
 void bar::add_trace(figure_frame_base& figure,
     const std::vector<bool>& parent_mask, std::size_t subplot_index,
     std::string_view group_name, std::size_t group_index,
     std::string_view hover_prefix,
     const std::vector<std::string>& additional_hover_text) const {
+    const std::vector<bool> mask = apply_row_budget(parent_mask);
     auto bar = figure.add_bar();
 
-    if (!x_.empty()) {
-        bar.x(filter_data_column(*data().at(x_), parent_mask));
-    }
+    if (function_) {
+        add_aggregated_values(bar, mask);
+    } else {
+        if (!x_.empty()) {
+            bar.x(filter_data_column(*data().at(x_), mask));
+        } else if (mask != parent_mask) {
+            // Bars are placed at the positions in the trace as without
+            // thinning.
+            bar.x(details::masked_row_positions(parent_mask, mask));
+        }
 
-    if (y_.empty()) {
-        throw std::runtime_error("y coordinates must be set.");
+        if (y_.empty()) {
+            throw std::runtime_error("y coordinates must be set.");
+        }
+        bar.y(filter_data_column(*data().at(y_), mask));
     }
-    bar.y(filter_data_column(*data().at(y_), parent_mask));
 
-    const bool has_additional_hover_text = !additional_hover_text.empty() &&
+    // Additional hover text is for each row, so it can't be used with
+    // aggregated values.
+    const bool has_additional_hover_text = !function_ &&
+        !additional_hover_text.empty() &&
         !additional_hover_text.front().empty();
     if (has_additional_hover_text) {
-        details::add_hover_text(bar, parent_mask, additional_hover_text);
+        details::add_hover_text(bar, mask, additional_hover_text);
     }
 
     switch (color_mode_) {
@@ -207,7 +261,7 @@ void bar::add_trace(figure_frame_base& figure,
     if (!x_.empty()) {
         hover_template += fmt::format("{}=%{{x}}<br>", x_);
     }
-    hover_template += fmt::format("{}=%{{y}}", y_);
+    hover_template += fmt::format("{}=%{{y}}", value_name());
     if (has_additional_hover_text) {
         hover_template += "%{text}";
     }
@@ -230,4 +284,96 @@ std::vector<std::string> bar::additional_hover_data_in_trace() const {
     return {};
 }
 
+bool bar::supports_row_downsampling() const noexcept {
+    // Aggregated values like counts and sums change with the number of rows.
+    return !function_;
+}
+
+void bar::add_aggregated_values(
+    traces::bar& bar, const std::vector<bool>& mask) const {
+    if (x_.empty()) {
+        throw std::runtime_error(
+            "x coordinates must be set to aggregate values.");
+    }
+    if (*function_ != aggregation_function::count && y_.empty()) {
+        throw std::runtime_error(
+            "y coordinates must be set for functions other than count.");
+    }
+
+    // Groups are generated from all rows so that x coordinates are in the
+    // same order in all traces.
+    const auto [x_groups, x_group_indices] = data().at(x_)->generate_group();
+    std::vector<std::size_t> keys;
+    for (std::size_t i = 0; i < mask.size(); ++i) {
+        if (mask[i]) {
+            keys.push_back(x_group_indices[i]);
+        }
+    }
+    std::vector<double> values;
+    if (!y_.empty()) {
+        values = data().at(y_)->as_masked_double_vector(mask);
+    }
+    const auto result = details::aggregate_groups(
+        keys, x_groups.size(), values, *function_, quantile_probability_);
+
+    const auto& x_column = *data().at(x_);
+    if (x_column.is_numeric()) {
+        // Numeric x coordinates are kept as numbers.
+        const auto x_values = x_column.as_masked_double_vector(mask);
+        std::vector<double> x_of_keys(x_groups.size());
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            x_of_keys[keys[i]] = x_values[i];
+        }
+        std::vector<double> x;
+        x.reserve(result.keys.size());
+        for (const std::size_t key : result.keys) {
+            x.push_back(x_of_keys[key]);
+        }
+        bar.x(x);
+    } else {
+        std::vector<std::string> x;
+        x.reserve(result.keys.size());
+        for (const std::size_t key : result.keys) {
+            x.push_back(x_groups[key]);
+        }
+        bar.x(x);
+    }
+    bar.y(result.values);
+}
+
+std::vector<double> bar::aggregate_values_in_all_traces() const {
+    // Values are aggregated for each pair of a trace and a group of x
+    // coordinates as in add_aggregated_values function.
+    const auto [keys, num_keys] = details::combine_group_indices(
+        trace_indices_of_rows(), data().at(x_)->generate_group().second);
+    std::vector<double> values;
+    if (!y_.empty()) {
+        values = data().at(y_)->as_double_vector();
+    }
+    return details::aggregate_groups(
+        keys, num_keys, values, *function_, quantile_probability_)
+        .values;
+}
+
+std::string bar::value_name() const {
+    if (!function_) {
+        return y_;
+    }
+    switch (*function_) {
+    case aggregation_function::count:
+        return "count";
+    case aggregation_function::sum:
+        return fmt::format("sum of {}", y_);
+    case aggregation_function::average:
+        return fmt::format("average of {}", y_);
+    case aggregation_function::minimum:
+        return fmt::format("min of {}", y_);
+    case aggregation_function::maximum:
+        return fmt::format("max of {}", y_);
+    case aggregation_function::quantile:
+        return fmt::format("quantile {} of {}", quantile_probability_, y_);
+    }
+    return y_;
+}
+
 }  // namespace plotly_plotter::figure_builders
@@ -120,6 +120,29 @@ bar_based_histogram& bar_based_histogram::title(std::string value) {
     return *this;
 }
 
+bar_based_histogram& bar_based_histogram::row_budget(
+    std::size_t max_rows, row_budget_policy policy) {
+    set_row_budget(max_rows, policy);
+    return *this;
+}
+
+bar_based_histogram& bar_based_histogram::remove_constant_frame_attributes(
+    bool value) {
+    set_remove_constant_frame_attributes(value);
+    return *this;
+}
+
+bar_based_histogram& bar_based_histogram::compress_uniform_coordinates(
+    bool value) {
+    set_compress_uniform_coordinates(value);
+    return *this;
+}
+
+bar_based_histogram& bar_based_histogram::share_repeated_arrays(bool value) {
+    set_share_repeated_arrays(value);
+    return *this;
+}
+
 void bar_based_histogram::configure_axes(figure& fig,
     std::size_t num_subplot_rows, std::size_t num_subplot_columns,
     bool require_manual_axis_ranges) const {
@@ -19,19 +19,26 @@
  */
 #include "plotly_plotter/figure_builders/box.h"
 
+#include <cmath>
+#include <cstddef>
+#include <limits>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
 #include "plotly_plotter/data_column.h"
 #include "plotly_plotter/figure.h"
+#include "plotly_plotter/figure_builders/details/box_statistics.h"
 #include "plotly_plotter/figure_builders/details/calculate_axis_range.h"
 #include "plotly_plotter/figure_builders/details/figure_builder_helper.h"
 #include "plotly_plotter/layout.h"
 #include "plotly_plotter/traces/box.h"
+#include "plotly_plotter/tracing/tracer.h"
 
 namespace plotly_plotter::figure_builders {
 
@@ -115,6 +122,11 @@ box& box::box_points(std::string value) {
     return *this;
 }
 
+box& box::precompute_statistics(bool value) {
+    precompute_statistics_ = value;
+    return *this;
+}
+
 box& box::log_y(bool value) {
     log_y_ = value;
     return *this;
@@ -125,6 +137,21 @@ box& box::title(std::string value) {
     return *this;
 }
 
+box& box::row_budget(std::size_t max_rows, row_budget_policy policy) {
+    set_row_budget(max_rows, policy);
+    return *this;
+}
+
+box& box::remove_constant_frame_attributes(bool value) {
+    set_remove_constant_frame_attributes(value);
+    return *this;
+}
+
+box& box::share_repeated_arrays(bool value) {
+    set_share_repeated_arrays(value);
+    return *this;
+}
+
 void box::configure_axes(figure& fig, std::size_t num_subplot_rows,
     std::size_t num_subplot_columns, bool require_manual_axis_ranges) const {
     details::configure_axes_common(
@@ -166,21 +193,26 @@ void box::add_trace(figure_frame_base& figure,
     std::string_view group_name, std::size_t group_index,
     std::string_view hover_prefix,
     const std::vector<std::string>& additional_hover_text) const {
+    const std::vector<bool> mask = apply_row_budget(parent_mask);
     auto box = figure.add_box();
 
-    if (!x_.empty()) {
-        box.x(filter_data_column(*data().at(x_), parent_mask));
-    }
-
     if (y_.empty()) {
         throw std::runtime_error("y coordinates must be set.");
     }
-    box.y(filter_data_column(*data().at(y_), parent_mask));
+    if (precompute_statistics_) {
+        add_precomputed_statistics(box, mask);
+    } else {
+        if (!x_.empty()) {
+            box.x(filter_data_column(*data().at(x_), mask));
+        }
+        box.y(filter_data_column(*data().at(y_), mask));
+    }
 
-    const bool has_additional_hover_text = !additional_hover_text.empty() &&
+    const bool has_additional_hover_text = !precompute_statistics_ &&
+        !additional_hover_text.empty() &&
         !additional_hover_text.front().empty();
     if (has_additional_hover_text) {
-        details::add_hover_text(box, parent_mask, additional_hover_text);
+        details::add_hover_text(box, mask, additional_hover_text);
     }
 
     switch (color_mode_) {
@@ -229,8 +261,109 @@ void box::add_trace(figure_frame_base& figure,
     }
 }
 
+void box::add_precomputed_statistics(
+    traces::box& box, const std::vector<bool>& mask) const {
+    PLOTLY_PLOTTER_TRACE_SPAN("box::add_precomputed_statistics", "builder");
+    const auto& y_column = *data().at(y_);
+    if (!y_column.is_numeric()) {
+        throw std::runtime_error(
+            "y coordinates must be numeric to precompute statistics.");
+    }
+    const std::vector<double> y_values =
+        y_column.as_masked_double_vector(mask);
+
+    // Values of y coordinates for each box.
+    std::vector<std::vector<double>> values_in_boxes;
+    // Mask of the first row in each box, whose x coordinate is written.
+    std::vector<bool> first_rows_of_boxes;
+    if (x_.empty()) {
+        values_in_boxes.emplace_back();
+        for (const double value : y_values) {
+            if (!std::isnan(value)) {
+                values_in_boxes.front().push_back(value);
+            }
+        }
+    } else {
+        const auto [x_groups, x_group_indices] =
+            data().at(x_)->generate_group();
+        constexpr std::size_t no_box = std::numeric_limits<std::size_t>::max();
+        std::vector<std::size_t> group_to_box(x_groups.size(), no_box);
+        first_rows_of_boxes.resize(mask.size(), false);
+        std::size_t masked_index = 0;
+        for (std::size_t i = 0; i < mask.size(); ++i) {
+            if (!mask[i]) {
+                continue;
+            }
+            const double value = y_values[masked_index];
+            ++masked_index;
+            std::size_t& box_index = group_to_box[x_group_indices[i]];
+            if (box_index == no_box) {
+                box_index = values_in_boxes.size();
+                values_in_boxes.emplace_back();
+                first_rows_of_boxes[i] = true;
+            }
+            if (!std::isnan(value)) {
+                values_in_boxes[box_index].push_back(value);
+            }
+        }
+    }
+
+    const bool show_all_points = box_points_ == "all";
+    const bool show_outliers =
+        box_points_ == "outliers" || box_points_ == "suspectedoutliers";
+    std::vector<double> q1;
+    std::vector<double> median;
+    std::vector<double> q3;
+    std::vector<double> lower_fence;
+    std::vector<double> upper_fence;
+    std::vector<double> mean;
+    std::vector<double> sd;
+    std::vector<std::vector<double>> points;
+    for (auto& values : values_in_boxes) {
+        const auto statistics = details::calculate_box_statistics(values);
+        q1.push_back(statistics.q1);
+        median.push_back(statistics.median);
+        q3.push_back(statistics.q3);
+        lower_fence.push_back(statistics.lower_fence);
+        upper_fence.push_back(statistics.upper_fence);
+        mean.push_back(statistics.mean);
+        sd.push_back(statistics.sd);
+        if (show_all_points) {
+            points.push_back(std::move(values));
+        } else if (show_outliers) {
+            auto& outliers = points.emplace_back();
+            for (const double value : values) {
+                if (value < statistics.lower_fence ||
+                    value > statistics.upper_fence) {
+                    outliers.push_back(value);
+                }
+            }
+        }
+    }
+
+    if (!x_.empty()) {
+        // Boxes are ordered by their first rows, so x coordinates of the first
+        // rows keep the types of the values in the column.
+        box.x(filter_data_column(*data().at(x_), first_rows_of_boxes));
+    }
+    box.q1(q1);
+    box.median(median);
+    box.q3(q3);
+    box.lower_fence(lower_fence);
+    box.upper_fence(upper_fence);
+    box.mean(mean);
+    box.sd(sd);
+    if (show_all_points || show_outliers) {
+        // plotly.js uses arrays of points in each box
+        // when statistics are precomputed.
+        box.y(points);
+    }
+}
+
 std::vector<std::string> box::additional_hover_data_in_trace() const {
     return {};
 }
 
+bool box::supports_row_downsampling() const noexcept { return true; }
+
 }  // namespace plotly_plotter::figure_builders
@@ -0,0 +1,280 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of density_heatmap class.
+ */
+#include "plotly_plotter/figure_builders/density_heatmap.h"
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "plotly_plotter/data_column.h"
+#include "plotly_plotter/data_table.h"
+#include "plotly_plotter/figure.h"
+#include "plotly_plotter/figure_builders/details/figure_builder_helper.h"
+#include "plotly_plotter/figure_builders/details/histogram_2d.h"
+#include "plotly_plotter/layout.h"
+#include "plotly_plotter/traces/heatmap.h"
+
+namespace plotly_plotter::figure_builders {
+
+density_heatmap::density_heatmap(const data_table& data)
+    : figure_builder_base(data) {}
+
+density_heatmap& density_heatmap::x(std::string value) {
+    x_ = std::move(value);
+    return *this;
+}
+
+density_heatmap& density_heatmap::y(std::string value) {
+    y_ = std::move(value);
+    return *this;
+}
+
+density_heatmap& density_heatmap::z(std::string value) {
+    z_ = std::move(value);
+    return *this;
+}
+
+density_heatmap& density_heatmap::function(aggregation_function value) {
+    if (value == aggregation_function::quantile) {
+        throw std::invalid_argument(
+            "Quantiles are not supported in density heatmaps.");
+    }
+    function_ = value;
+    return *this;
+}
+
+density_heatmap& density_heatmap::group(std::string value) {
+    set_group(std::move(value));
+    return *this;
+}
+
+density_heatmap& density_heatmap::subplot_row(std::string value) {
+    set_subplot_row(std::move(value));
+    return *this;
+}
+
+density_heatmap& density_heatmap::subplot_column(std::string value) {
+    set_subplot_column(std::move(value));
+    return *this;
+}
+
+density_heatmap& density_heatmap::animation_frame(std::string value) {
+    set_animation_frame(std::move(value));
+    return *this;
+}
+
+density_heatmap& density_heatmap::log_x(bool value) {
+    log_x_ = value;
+    return *this;
+}
+
+density_heatmap& density_heatmap::log_y(bool value) {
+    log_y_ = value;
+    return *this;
+}
+
+density_heatmap& density_heatmap::bin_width_method(
+    utils::histogram_bin_width_method value) {
+    bin_width_method_ = value;
+    fixed_bin_width_x_.reset();
+    fixed_bin_width_y_.reset();
+    return *this;
+}
+
+density_heatmap& density_heatmap::fixed_bin_width_x(double value) {
+    fixed_bin_width_x_ = value;
+    return *this;
+}
+
+density_heatmap& density_heatmap::fixed_bin_width_y(double value) {
+    fixed_bin_width_y_ = value;
+    return *this;
+}
+
+density_heatmap& density_heatmap::title(std::string value) {
+    set_title(std::move(value));
+    return *this;
+}
+
+density_heatmap& density_heatmap::row_budget(
+    std::size_t max_rows, row_budget_policy policy) {
+    set_row_budget(max_rows, policy);
+    return *this;
+}
+
+density_heatmap& density_heatmap::remove_constant_frame_attributes(bool value) {
+    set_remove_constant_frame_attributes(value);
+    return *this;
+}
+
+density_heatmap& density_heatmap::compress_uniform_coordinates(bool value) {
+    set_compress_uniform_coordinates(value);
+    return *this;
+}
+
+density_heatmap& density_heatmap::share_repeated_arrays(bool value) {
+    set_share_repeated_arrays(value);
+    return *this;
+}
+
+void density_heatmap::configure_axes(figure& fig, std::size_t num_subplot_rows,
+    std::size_t num_subplot_columns, bool require_manual_axis_ranges) const {
+    (void)require_manual_axis_ranges;
+
+    details::configure_axes_common(
+        fig, num_subplot_rows, num_subplot_columns, x_, y_);
+
+    // Ranges of axes are fixed to the bins shared by all traces.
+    calculate_bins();
+    const auto range_of = [](const details::histogram_axis& axis) {
+        return std::make_pair(axis.min,
+            axis.min + static_cast<double>(axis.num_bins) * axis.bin_width);
+    };
+    const auto [min_x, max_x] = range_of(*x_axis_);
+    const auto [min_y, max_y] = range_of(*y_axis_);
+    for (std::size_t i = 0; i < num_subplot_rows * num_subplot_columns; ++i) {
+        const std::size_t index = i + 1;
+        if (log_x_) {
+            fig.layout().xaxis(index).type("log");
+        }
+        if (log_y_) {
+            fig.layout().yaxis(index).type("log");
+        }
+        fig.layout().xaxis(index).range(min_x, max_x);
+        fig.layout().yaxis(index).range(min_y, max_y);
+    }
+
+    fig.layout().color_axis().show_scale(true);
+    fig.layout().color_axis().color_bar().title().text(value_name());
+    if (min_value_ && max_value_) {
+        // Colors are fixed among traces and animation frames.
+        fig.layout().color_axis().c_min(*min_value_);
+        fig.layout().color_axis().c_max(*max_value_);
+    }
+}
+
+std::string density_heatmap::default_title() const {
+    return fmt::format("{} vs {}", y_, x_);
+}
+
+void density_heatmap::add_trace(figure_frame_base& figure,
+    const std::vector<bool>& parent_mask, std::size_t subplot_index,
+    std::string_view group_name, std::size_t group_index,
+    std::string_view hover_prefix,
+    const std::vector<std::string>& additional_hover_text) const {
+    // Heatmap does not support additional hover text.
+    (void)group_index;
+    (void)additional_hover_text;
+
+    calculate_bins();
+
+    const auto x_values = data().at(x_)->as_masked_double_vector(parent_mask);
+    const auto y_values = data().at(y_)->as_masked_double_vector(parent_mask);
+    std::vector<double> z_values;
+    if (function_ != aggregation_function::count) {
+        z_values = data().at(z_)->as_masked_double_vector(parent_mask);
+    }
+    const auto values = details::compute_histogram_2d(
+        *x_axis_, *y_axis_, x_values, y_values, z_values, function_);
+    for (const auto& row : values) {
+        for (const double value : row) {
+            if (std::isnan(value)) {
+                continue;
+            }
+            if (!min_value_ || value < *min_value_) {
+                min_value_ = value;
+            }
+            if (!max_value_ || value > *max_value_) {
+                max_value_ = value;
+            }
+        }
+    }
+
+    auto heatmap = figure.add_heatmap();
+    // Edges of bins are given, so that bins are placed correctly in log scale.
+    heatmap.x(x_axis_->edges());
+    heatmap.y(y_axis_->edges());
+    heatmap.z(values);
+    heatmap.color_axis("coloraxis");
+
+    if (!group_name.empty()) {
+        heatmap.name(group_name);
+        heatmap.legend_group(group_name);
+        heatmap.show_legend(subplot_index <= 1);
+    }
+
+    heatmap.hover_template(fmt::format("{}{}=%{{x}}<br>{}=%{{y}}<br>{}=%{{z}}",
+        hover_prefix, x_, y_, value_name()));
+
+    if (subplot_index > 1) {
+        heatmap.xaxis(fmt::format("x{}", subplot_index));
+        heatmap.yaxis(fmt::format("y{}", subplot_index));
+    }
+}
+
+std::vector<std::string> density_heatmap::additional_hover_data_in_trace()
+    const {
+    return {};
+}
+
+void density_heatmap::calculate_bins() const {
+    if (x_axis_ && y_axis_) {
+        // Already done.
+        return;
+    }
+    if (x_.empty() || y_.empty()) {
+        throw std::runtime_error(
+            "x and y coordinates must be set for density heatmap.");
+    }
+    if (function_ != aggregation_function::count && z_.empty()) {
+        throw std::runtime_error(
+            "z values must be set for functions other than count.");
+    }
+    x_axis_ = details::create_histogram_axis(
+        *data().at(x_), log_x_, fixed_bin_width_x_, bin_width_method_);
+    y_axis_ = details::create_histogram_axis(
+        *data().at(y_), log_y_, fixed_bin_width_y_, bin_width_method_);
+}
+
+std::string density_heatmap::value_name() const {
+    switch (function_) {
+    case aggregation_function::count:
+        return "count";
+    case aggregation_function::sum:
+        return fmt::format("sum of {}", z_);
+    case aggregation_function::average:
+        return fmt::format("average of {}", z_);
+    case aggregation_function::minimum:
+        return fmt::format("min of {}", z_);
+    case aggregation_function::maximum:
+        return fmt::format("max of {}", z_);
+    case aggregation_function::quantile:
+        break;
+    }
+    return "count";
+}
+
+}  // namespace plotly_plotter::figure_builders
@@ -0,0 +1,81 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of calculate_box_statistics function.
+ */
+#include "plotly_plotter/figure_builders/details/box_statistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include "plotly_plotter/figure_builders/details/quantile.h"
+#include "plotly_plotter/tracing/tracer.h"
+
+namespace plotly_plotter::figure_builders::details {
+
+box_statistics calculate_box_statistics(std::vector<double>& values) {
+    PLOTLY_PLOTTER_TRACE_SPAN("calculate_box_statistics", "builder");
+    if (values.empty()) {
+        constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+        return box_statistics{nan, nan, nan, nan, nan, nan, nan};
+    }
+
+    box_statistics result{};
+    std::size_t num_ordered_values = 0;
+    constexpr double q1_probability = 0.25;
+    constexpr double median_probability = 0.5;
+    constexpr double q3_probability = 0.75;
+    result.q1 = select_quantile(
+        values.begin(), values.end(), q1_probability, num_ordered_values);
+    result.median = select_quantile(
+        values.begin(), values.end(), median_probability, num_ordered_values);
+    result.q3 = select_quantile(
+        values.begin(), values.end(), q3_probability, num_ordered_values);
+
+    constexpr double fence_factor = 1.5;
+    const double iqr = result.q3 - result.q1;
+    const double lower_limit = result.q1 - fence_factor * iqr;
+    const double upper_limit = result.q3 + fence_factor * iqr;
+    result.lower_fence = result.q1;
+    result.upper_fence = result.q3;
+    double sum = 0.0;
+    for (const double value : values) {
+        if (value >= lower_limit) {
+            result.lower_fence = std::min(result.lower_fence, value);
+        }
+        if (value <= upper_limit) {
+            result.upper_fence = std::max(result.upper_fence, value);
+        }
+        sum += value;
+    }
+
+    const auto size = static_cast<double>(values.size());
+    result.mean = sum / size;
+    double squared_sum = 0.0;
+    for (const double value : values) {
+        const double diff = value - result.mean;
+        squared_sum += diff * diff;
+    }
+    // plotly.js uses the population standard deviation.
+    result.sd = std::sqrt(squared_sum / size);
+    return result;
+}
+
+}  // namespace plotly_plotter::figure_builders::details
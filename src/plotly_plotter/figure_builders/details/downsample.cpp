@@ -0,0 +1,305 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of downsample function.
+ */
+#include "plotly_plotter/figure_builders/details/downsample.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "plotly_plotter/tracing/tracer.h"
+
+namespace plotly_plotter::figure_builders::details {
+
+namespace {
+
+/*!
+ * \brief Class of coordinates of points selected by a mask.
+ */
+class masked_points {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] x Column of x coordinates.
+     * \param[in] y Column of y coordinates.
+     * \param[in] parent_mask Mask of the values in the parent layer.
+     */
+    masked_points(const data_column_base* x, const data_column_base& y,
+        const std::vector<bool>& parent_mask)
+        : y_(y.as_masked_double_vector(parent_mask)) {
+        if (x != nullptr && x->is_numeric()) {
+            x_ = x->as_masked_double_vector(parent_mask);
+        }
+        row_indices_.reserve(y_.size());
+        for (std::size_t i = 0; i < parent_mask.size(); ++i) {
+            if (parent_mask[i]) {
+                row_indices_.push_back(i);
+            }
+        }
+    }
+
+    /*!
+     * \brief Get the number of points.
+     *
+     * \return Number of points.
+     */
+    [[nodiscard]] std::size_t size() const noexcept { return y_.size(); }
+
+    /*!
+     * \brief Get the x coordinate of a point.
+     *
+     * \param[in] index Index of the point.
+     * \return x coordinate.
+     */
+    [[nodiscard]] double x(std::size_t index) const noexcept {
+        return x_.empty() ? static_cast<double>(index) : x_[index];
+    }
+
+    /*!
+     * \brief Get the y coordinate of a point.
+     *
+     * \param[in] index Index of the point.
+     * \return y coordinate.
+     */
+    [[nodiscard]] double y(std::size_t index) const noexcept {
+        return y_[index];
+    }
+
+    /*!
+     * \brief Get the index of the row of a point.
+     *
+     * \param[in] index Index of the point.
+     * \return Index of the row.
+     */
+    [[nodiscard]] std::size_t row_index(std::size_t index) const noexcept {
+        return row_indices_[index];
+    }
+
+private:
+    //! x coordinates. (Empty when the order of rows is used.)
+    std::vector<double> x_;
+
+    //! y coordinates.
+    std::vector<double> y_;
+
+    //! Indices of rows.
+    std::vector<std::size_t> row_indices_;
+};
+
+/*!
+ * \brief Select points at a regular interval.
+ *
+ * \param[in] parent_mask Mask of the values in the parent layer.
+ * \param[in] num_points Number of points in the parent mask.
+ * \param[in] max_points Maximum number of points.
+ * \return Mask.
+ */
+[[nodiscard]] std::vector<bool> select_every_nth(
+    const std::vector<bool>& parent_mask, std::size_t num_points,
+    std::size_t max_points) {
+    const std::size_t stride = (num_points + max_points - 1) / max_points;
+    std::vector<bool> mask(parent_mask.size(), false);
+    std::size_t point_index = 0;
+    for (std::size_t i = 0; i < parent_mask.size(); ++i) {
+        if (parent_mask[i]) {
+            if (point_index % stride == 0) {
+                mask[i] = true;
+            }
+            ++point_index;
+        }
+    }
+    return mask;
+}
+
+/*!
+ * \brief Select points with the minimum and maximum y values in each bucket
+ * of x.
+ *
+ * \param[in] points Points.
+ * \param[in] num_rows Number of rows.
+ * \param[in] max_points Maximum number of points.
+ * \return Mask.
+ */
+[[nodiscard]] std::vector<bool> select_min_max(
+    const masked_points& points, std::size_t num_rows, std::size_t max_points) {
+    const std::size_t num_points = points.size();
+    const std::size_t num_buckets = std::max<std::size_t>(max_points / 2, 1);
+
+    double x_min = std::numeric_limits<double>::infinity();
+    double x_max = -std::numeric_limits<double>::infinity();
+    for (std::size_t i = 0; i < num_points; ++i) {
+        const double x = points.x(i);
+        if (std::isfinite(x)) {
+            x_min = std::min(x_min, x);
+            x_max = std::max(x_max, x);
+        }
+    }
+    // Buckets are split by the order of points when x values can't be used.
+    const bool use_x = x_min < x_max;
+    const double x_scale =
+        use_x ? static_cast<double>(num_buckets) / (x_max - x_min) : 0.0;
+
+    constexpr auto no_point = std::numeric_limits<std::size_t>::max();
+    std::vector<std::size_t> min_indices(num_buckets, no_point);
+    std::vector<std::size_t> max_indices(num_buckets, no_point);
+    for (std::size_t i = 0; i < num_points; ++i) {
+        const double y = points.y(i);
+        if (std::isnan(y)) {
+            continue;
+        }
+        std::size_t bucket = 0;
+        if (use_x) {
+            const double x = points.x(i);
+            if (!std::isfinite(x)) {
+                continue;
+            }
+            bucket = std::min(
+                static_cast<std::size_t>((x - x_min) * x_scale),
+                num_buckets - 1);
+        } else {
+            bucket = i * num_buckets / num_points;
+        }
+        if (min_indices[bucket] == no_point ||
+            y < points.y(min_indices[bucket])) {
+            min_indices[bucket] = i;
+        }
+        if (max_indices[bucket] == no_point ||
+            y > points.y(max_indices[bucket])) {
+            max_indices[bucket] = i;
+        }
+    }
+
+    std::vector<bool> mask(num_rows, false);
+    for (std::size_t bucket = 0; bucket < num_buckets; ++bucket) {
+        if (min_indices[bucket] != no_point) {
+            mask[points.row_index(min_indices[bucket])] = true;
+            mask[points.row_index(max_indices[bucket])] = true;
+        }
+    }
+    return mask;
+}
+
+/*!
+ * \brief Select points using Largest-Triangle-Three-Buckets (LTTB) algorithm.
+ *
+ * \param[in] points Points.
+ * \param[in] num_rows Number of rows.
+ * \param[in] max_points Maximum number of points.
+ * \return Mask.
+ */
+[[nodiscard]] std::vector<bool> select_lttb(
+    const masked_points& points, std::size_t num_rows, std::size_t max_points) {
+    const std::size_t num_points = points.size();
+    std::vector<bool> mask(num_rows, false);
+    mask[points.row_index(0)] = true;
+    mask[points.row_index(num_points - 1)] = true;
+    if (max_points < 3) {
+        return mask;
+    }
+
+    // The first and the last points are always selected,
+    // and one point is selected from each bucket between them.
+    const std::size_t num_buckets = max_points - 2;
+    const double bucket_size = static_cast<double>(num_points - 2) /
+        static_cast<double>(num_buckets);
+    const auto bucket_begin = [bucket_size](std::size_t bucket) {
+        return static_cast<std::size_t>(
+                   static_cast<double>(bucket) * bucket_size) +
+            1;
+    };
+
+    std::size_t selected = 0;
+    for (std::size_t bucket = 0; bucket < num_buckets; ++bucket) {
+        const std::size_t begin = bucket_begin(bucket);
+        const std::size_t end = bucket_begin(bucket + 1);
+
+        // Average of the next bucket (or the last point).
+        const std::size_t next_begin = end;
+        const std::size_t next_end =
+            std::min(bucket_begin(bucket + 2), num_points);
+        double next_x = 0.0;
+        double next_y = 0.0;
+        std::size_t num_next = 0;
+        for (std::size_t i = next_begin; i < next_end; ++i) {
+            if (std::isfinite(points.y(i))) {
+                next_x += points.x(i);
+                next_y += points.y(i);
+                ++num_next;
+            }
+        }
+        if (num_next > 0) {
+            next_x /= static_cast<double>(num_next);
+            next_y /= static_cast<double>(num_next);
+        } else {
+            next_x = points.x(num_points - 1);
+            next_y = points.y(num_points - 1);
+        }
+
+        // Point forming the largest triangle with the selected point and the
+        // average of the next bucket.
+        const double selected_x = points.x(selected);
+        const double selected_y = points.y(selected);
+        std::size_t best = begin;
+        double max_area = -1.0;
+        for (std::size_t i = begin; i < end; ++i) {
+            const double area =
+                std::abs((selected_x - next_x) * (points.y(i) - selected_y) -
+                    (selected_x - points.x(i)) * (next_y - selected_y));
+            if (area > max_area) {
+                max_area = area;
+                best = i;
+            }
+        }
+        mask[points.row_index(best)] = true;
+        selected = best;
+    }
+    return mask;
+}
+
+}  // namespace
+
+std::vector<bool> downsample(downsampling_method method,
+    const data_column_base* x, const data_column_base& y,
+    const std::vector<bool>& parent_mask, std::size_t max_points) {
+    if (max_points == 0) {
+        throw std::invalid_argument(
+            "Maximum number of points must be positive.");
+    }
+    const auto num_points = static_cast<std::size_t>(
+        std::count(parent_mask.begin(), parent_mask.end(), true));
+    if (method == downsampling_method::none || num_points <= max_points) {
+        return parent_mask;
+    }
+    PLOTLY_PLOTTER_TRACE_SPAN("downsample", "figure_builders");
+
+    if (method == downsampling_method::every_nth || !y.is_numeric()) {
+        return select_every_nth(parent_mask, num_points, max_points);
+    }
+    const masked_points points(x, y, parent_mask);
+    if (method == downsampling_method::min_max) {
+        return select_min_max(points, parent_mask.size(), max_points);
+    }
+    return select_lttb(points, parent_mask.size(), max_points);
+}
+
+}  // namespace plotly_plotter::figure_builders::details
@@ -19,7 +19,17 @@
  */
 #include "plotly_plotter/figure_builders/details/figure_builder_helper.h"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <yyjson.h>
+
 #include "plotly_plotter/layout.h"
+#include "plotly_plotter/tracing/tracer.h"
 
 namespace plotly_plotter::figure_builders::details {
 
@@ -61,4 +71,124 @@ void configure_axes_common(figure& fig, std::size_t num_subplot_rows,
     }
 }
 
+namespace {
+
+/*!
+ * \brief Remove attributes of objects in frames which are the same as those
+ * in the object of the figure.
+ *
+ * \param[in] base Object in the figure.
+ * \param[in,out] objects Objects in frames.
+ */
+void remove_constant_attributes(
+    yyjson_mut_val* base, const std::vector<yyjson_mut_val*>& objects) {
+    std::vector<yyjson_mut_val*> values(objects.size());
+    yyjson_mut_obj_iter iter;
+    yyjson_mut_obj_iter_init(base, &iter);
+    while (yyjson_mut_val* key = yyjson_mut_obj_iter_next(&iter)) {
+        yyjson_mut_val* base_value = yyjson_mut_obj_iter_get_val(key);
+        const char* key_str = yyjson_mut_get_str(key);
+        const std::size_t key_len = yyjson_mut_get_len(key);
+        bool is_constant = true;
+        bool are_objects = yyjson_mut_is_obj(base_value);
+        bool is_in_all_objects = true;
+        for (std::size_t i = 0; i < objects.size(); ++i) {
+            values[i] = yyjson_mut_obj_getn(objects[i], key_str, key_len);
+            if (values[i] == nullptr) {
+                is_in_all_objects = false;
+                break;
+            }
+            is_constant =
+                is_constant && yyjson_mut_equals(base_value, values[i]);
+            are_objects = are_objects && yyjson_mut_is_obj(values[i]);
+        }
+        if (!is_in_all_objects) {
+            continue;
+        }
+        if (is_constant) {
+            for (yyjson_mut_val* object : objects) {
+                yyjson_mut_obj_remove_keyn(object, key_str, key_len);
+            }
+        } else if (are_objects) {
+            // Plotly merges objects recursively.
+            remove_constant_attributes(base_value, values);
+        }
+    }
+}
+
+}  // namespace
+
+void remove_constant_attributes_in_frames(figure& fig) {
+    PLOTLY_PLOTTER_TRACE_SPAN(
+        "remove_constant_attributes_in_frames", "builder");
+    yyjson_mut_val* root = fig.document().root().internal_value();
+    yyjson_mut_val* traces = yyjson_mut_obj_get(root, "data");
+    yyjson_mut_val* frames = yyjson_mut_obj_get(root, "frames");
+    if (!yyjson_mut_is_arr(traces) || !yyjson_mut_is_arr(frames)) {
+        return;
+    }
+
+    const std::size_t num_traces = yyjson_mut_arr_size(traces);
+    std::vector<std::vector<yyjson_mut_val*>> traces_in_frames(num_traces);
+    yyjson_mut_arr_iter frame_iter;
+    yyjson_mut_arr_iter_init(frames, &frame_iter);
+    while (yyjson_mut_val* frame = yyjson_mut_arr_iter_next(&frame_iter)) {
+        yyjson_mut_val* traces_in_frame = yyjson_mut_obj_get(frame, "data");
+        if (yyjson_mut_arr_size(traces_in_frame) != num_traces) {
+            return;
+        }
+        yyjson_mut_arr_iter trace_iter;
+        yyjson_mut_arr_iter_init(traces_in_frame, &trace_iter);
+        for (auto& traces_with_index : traces_in_frames) {
+            traces_with_index.push_back(yyjson_mut_arr_iter_next(&trace_iter));
+        }
+    }
+
+    yyjson_mut_arr_iter trace_iter;
+    yyjson_mut_arr_iter_init(traces, &trace_iter);
+    for (const auto& traces_with_index : traces_in_frames) {
+        remove_constant_attributes(
+            yyjson_mut_arr_iter_next(&trace_iter), traces_with_index);
+    }
+}
+
+std::vector<std::size_t> masked_row_positions(
+    const std::vector<bool>& parent_mask, const std::vector<bool>& mask) {
+    std::vector<std::size_t> positions;
+    std::size_t position = 0;
+    for (std::size_t row_index = 0; row_index < parent_mask.size();
+        ++row_index) {
+        if (!parent_mask[row_index]) {
+            continue;
+        }
+        if (mask[row_index]) {
+            positions.push_back(position);
+        }
+        ++position;
+    }
+    return positions;
+}
+
+std::pair<std::vector<std::size_t>, std::size_t> combine_group_indices(
+    const std::vector<std::size_t>& first_indices,
+    const std::vector<std::size_t>& second_indices) {
+    const std::size_t num_second_groups = second_indices.empty()
+        ? 0
+        : *std::max_element(second_indices.begin(), second_indices.end()) + 1;
+
+    std::vector<std::size_t> combined_indices;
+    combined_indices.reserve(first_indices.size());
+    std::unordered_map<std::uint64_t, std::size_t> pair_to_combined_index;
+    for (std::size_t row_index = 0; row_index < first_indices.size();
+        ++row_index) {
+        const auto pair = static_cast<std::uint64_t>(first_indices[row_index]) *
+                num_second_groups +
+            second_indices[row_index];
+        const auto [iter, is_inserted] = pair_to_combined_index.try_emplace(
+            pair, pair_to_combined_index.size());
+        combined_indices.push_back(iter->second);
+    }
+    return {std::move(combined_indices), pair_to_combined_index.size()};
+}
+
 }  // namespace plotly_plotter::figure_builders::details
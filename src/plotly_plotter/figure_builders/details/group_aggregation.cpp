@@ -0,0 +1,123 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of internal functions to aggregate values in groups.
+ */
+#include "plotly_plotter/figure_builders/details/group_aggregation.h"
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "plotly_plotter/figure_builders/details/group_accumulator.h"
+#include "plotly_plotter/figure_builders/details/quantile.h"
+#include "plotly_plotter/tracing/tracer.h"
+
+namespace plotly_plotter::figure_builders::details {
+
+namespace {
+
+/*!
+ * \brief Aggregate values in groups using quantiles.
+ *
+ * \param[in] keys Keys of groups of values.
+ * \param[in] num_keys Number of keys.
+ * \param[in] values Values to aggregate.
+ * \param[in] probability Probability of the quantile.
+ * \return Aggregated values.
+ */
+[[nodiscard]] group_aggregation_result aggregate_quantiles(
+    const std::vector<std::size_t>& keys, std::size_t num_keys,
+    const std::vector<double>& values, double probability) {
+    // Values are sorted by keys using counting sort so that quantiles are
+    // calculated in contiguous ranges.
+    std::vector<std::size_t> offsets(num_keys + 1U, 0);
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        if (!std::isnan(values[i])) {
+            ++offsets[keys[i] + 1U];
+        }
+    }
+    for (std::size_t key = 0; key < num_keys; ++key) {
+        offsets[key + 1U] += offsets[key];
+    }
+    std::vector<double> sorted_values(offsets.back());
+    std::vector<std::size_t> positions(offsets.begin(), offsets.end() - 1);
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        if (!std::isnan(values[i])) {
+            sorted_values[positions[keys[i]]++] = values[i];
+        }
+    }
+
+    group_aggregation_result result;
+    for (std::size_t key = 0; key < num_keys; ++key) {
+        if (offsets[key] == offsets[key + 1U]) {
+            continue;
+        }
+        result.keys.push_back(key);
+        result.values.push_back(select_quantile(
+            sorted_values.begin() + static_cast<std::ptrdiff_t>(offsets[key]),
+            sorted_values.begin() +
+                static_cast<std::ptrdiff_t>(offsets[key + 1U]),
+            probability));
+    }
+    return result;
+}
+
+}  // namespace
+
+group_aggregation_result aggregate_groups(const std::vector<std::size_t>& keys,
+    std::size_t num_keys, const std::vector<double>& values,
+    aggregation_function function, double quantile_probability) {
+    PLOTLY_PLOTTER_TRACE_SPAN("aggregate_groups", "figure_builders");
+    const bool use_values =
+        function != aggregation_function::count || !values.empty();
+    if (use_values && values.size() != keys.size()) {
+        throw std::invalid_argument("Sizes of values are different.");
+    }
+    if (function == aggregation_function::quantile) {
+        if (!(quantile_probability >= 0.0 && quantile_probability <= 1.0)) {
+            throw std::invalid_argument(
+                "Probability of quantiles must be in [0, 1].");
+        }
+        return aggregate_quantiles(
+            keys, num_keys, values, quantile_probability);
+    }
+    const group_accumulator accumulator = accumulate_groups(num_keys,
+        keys.size(), function,
+        [&](group_accumulator& target, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                const double value = use_values ? values[i] : 0.0;
+                if (std::isnan(value)) {
+                    continue;
+                }
+                target.add(keys[i], value);
+            }
+        });
+
+    group_aggregation_result result;
+    for (std::size_t key = 0; key < num_keys; ++key) {
+        if (accumulator.count(key) == 0) {
+            continue;
+        }
+        result.keys.push_back(key);
+        result.values.push_back(accumulator.result(key));
+    }
+    return result;
+}
+
+}  // namespace plotly_plotter::figure_builders::details
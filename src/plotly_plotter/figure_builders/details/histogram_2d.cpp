@@ -0,0 +1,155 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of internal functions of 2D histograms.
+ */
+#include "plotly_plotter/figure_builders/details/histogram_2d.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include "plotly_plotter/figure_builders/details/group_accumulator.h"
+#include "plotly_plotter/tracing/tracer.h"
+
+namespace plotly_plotter::figure_builders::details {
+
+std::size_t histogram_axis::bin_index(double value) const noexcept {
+    if (log_scale) {
+        if (!(value > 0.0)) {
+            return num_bins;
+        }
+        value = std::log10(value);
+    }
+    const double position = (value - min) / bin_width;
+    if (!(position >= 0.0) ||
+        position > static_cast<double>(num_bins)) {
+        return num_bins;
+    }
+    // The maximum value is included in the last bin.
+    return std::min(static_cast<std::size_t>(position), num_bins - 1);
+}
+
+std::vector<double> histogram_axis::edges() const {
+    std::vector<double> result(num_bins + 1);
+    for (std::size_t i = 0; i <= num_bins; ++i) {
+        const double edge = min + static_cast<double>(i) * bin_width;
+        // NOLINTNEXTLINE(*-magic-numbers)
+        result[i] = log_scale ? std::pow(10.0, edge) : edge;
+    }
+    return result;
+}
+
+histogram_axis create_histogram_axis(const data_column_base& column,
+    bool log_scale, std::optional<double> fixed_bin_width,
+    utils::histogram_bin_width_method method, std::size_t max_bins) {
+    if (max_bins == 0) {
+        throw std::invalid_argument("Maximum number of bins must be positive.");
+    }
+
+    histogram_axis axis;
+    axis.log_scale = log_scale;
+    double max = 0.0;
+    if (log_scale) {
+        const auto [min_value, max_value] = column.get_positive_range();
+        axis.min = std::log10(min_value);
+        max = std::log10(max_value);
+    } else {
+        const auto [min_value, max_value] = column.get_range();
+        axis.min = min_value;
+        max = max_value;
+    }
+    const double range = max - axis.min;
+
+    if (!fixed_bin_width) {
+        auto values = column.as_double_vector();
+        if (log_scale) {
+            values.erase(std::remove_if(values.begin(), values.end(),
+                             [](double value) { return !(value > 0.0); }),
+                values.end());
+            for (double& value : values) {
+                value = std::log10(value);
+            }
+        }
+        fixed_bin_width = utils::calculate_histogram_bin_width(values, method);
+    }
+
+    if (!(range > 0.0)) {
+        // All values are in a single bin.
+        axis.bin_width = (*fixed_bin_width > 0.0) ? *fixed_bin_width : 1.0;
+        axis.num_bins = 1;
+        return axis;
+    }
+    axis.bin_width = *fixed_bin_width;
+    const double num_bins = std::ceil(range / axis.bin_width);
+    if (!(axis.bin_width > 0.0) ||
+        !(num_bins <= static_cast<double>(max_bins))) {
+        // Too small widths are widened to keep the size of the figure small.
+        axis.num_bins = max_bins;
+        axis.bin_width = range / static_cast<double>(max_bins);
+        return axis;
+    }
+    axis.num_bins = std::max(static_cast<std::size_t>(num_bins),
+        static_cast<std::size_t>(1));
+    return axis;
+}
+
+std::vector<std::vector<double>> compute_histogram_2d(
+    const histogram_axis& x_axis, const histogram_axis& y_axis,
+    const std::vector<double>& x, const std::vector<double>& y,
+    const std::vector<double>& z, aggregation_function function) {
+    PLOTLY_PLOTTER_TRACE_SPAN("compute_histogram_2d", "figure_builders");
+    if (function == aggregation_function::quantile) {
+        throw std::invalid_argument(
+            "Quantiles are not supported in 2D histograms.");
+    }
+    const bool use_z = function != aggregation_function::count;
+    if (x.size() != y.size() || (use_z && z.size() != x.size())) {
+        throw std::invalid_argument("Sizes of values are different.");
+    }
+    const std::size_t num_cells = x_axis.num_bins * y_axis.num_bins;
+    const group_accumulator result = accumulate_groups(num_cells, x.size(),
+        function,
+        [&](group_accumulator& target, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                const std::size_t x_index = x_axis.bin_index(x[i]);
+                const std::size_t y_index = y_axis.bin_index(y[i]);
+                if (x_index == x_axis.num_bins || y_index == y_axis.num_bins) {
+                    continue;
+                }
+                const double value = use_z ? z[i] : 0.0;
+                if (std::isnan(value)) {
+                    continue;
+                }
+                target.add(y_index * x_axis.num_bins + x_index, value);
+            }
+        });
+
+    std::vector<std::vector<double>> values(
+        y_axis.num_bins, std::vector<double>(x_axis.num_bins));
+    for (std::size_t y_index = 0; y_index < y_axis.num_bins; ++y_index) {
+        for (std::size_t x_index = 0; x_index < x_axis.num_bins; ++x_index) {
+            values[y_index][x_index] =
+                result.result(y_index * x_axis.num_bins + x_index);
+        }
+    }
+    return values;
+}
+
+}  // namespace plotly_plotter::figure_builders::details
@@ -0,0 +1,144 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of estimate_kernel_density function.
+ */
+#include "plotly_plotter/figure_builders/details/kernel_density.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "plotly_plotter/tracing/tracer.h"
+
+namespace plotly_plotter::figure_builders::details {
+
+namespace {
+
+/*!
+ * \brief Calculate the bandwidth in the same way as plotly.js.
+ *
+ * \param[in] size Number of values.
+ * \param[in] span Difference between the maximum and minimum values.
+ * \param[in] statistics Statistics of the values.
+ * \return Bandwidth.
+ */
+[[nodiscard]] double calculate_bandwidth(
+    std::size_t size, double span, const box_statistics& statistics) {
+    const auto size_in_double = static_cast<double>(size);
+    // Sample standard deviation.
+    const double sample_sd = (size > 1U)
+        ? statistics.sd * std::sqrt(size_in_double / (size_in_double - 1.0))
+        : 0.0;
+    // Silverman's rule of thumb.
+    constexpr double iqr_factor = 1.349;
+    constexpr double coefficient = 1.059;
+    constexpr double exponent = -0.2;
+    const double scale =
+        std::min(sample_sd, (statistics.q3 - statistics.q1) / iqr_factor);
+    const double bandwidth =
+        coefficient * scale * std::pow(size_in_double, exponent);
+    // plotly.js limits the number of points to evaluate densities.
+    constexpr double min_bandwidth_ratio = 0.01;
+    return std::max(bandwidth, span * min_bandwidth_ratio);
+}
+
+}  // namespace
+
+kernel_density estimate_kernel_density(
+    const std::vector<double>& values, const box_statistics& statistics) {
+    PLOTLY_PLOTTER_TRACE_SPAN("estimate_kernel_density", "builder");
+    if (values.empty()) {
+        return kernel_density{0.0, {}, {}};
+    }
+
+    const auto [min_iter, max_iter] =
+        std::minmax_element(values.begin(), values.end());
+    const double min_value = *min_iter;
+    const double max_value = *max_iter;
+    const double span = max_value - min_value;
+    if (span <= 0.0) {
+        return kernel_density{0.0, {min_value}, {1.0}};
+    }
+
+    kernel_density result{
+        calculate_bandwidth(values.size(), span, statistics), {}, {}};
+    const double bandwidth = result.bandwidth;
+
+    // Positions of densities with padding of twice the bandwidth.
+    constexpr double padding_factor = 2.0;
+    constexpr double steps_per_bandwidth = 3.0;
+    const double begin = min_value - padding_factor * bandwidth;
+    const double distance = span + 2.0 * padding_factor * bandwidth;
+    const auto num_steps = static_cast<std::size_t>(
+        std::ceil(distance / (bandwidth / steps_per_bandwidth)));
+    const double step = distance / static_cast<double>(num_steps);
+    const std::size_t num_positions = num_steps + 1U;
+    result.positions.reserve(num_positions);
+    for (std::size_t i = 0; i < num_positions; ++i) {
+        result.positions.push_back(begin + static_cast<double>(i) * step);
+    }
+
+    // Linear binning.
+    std::vector<double> bins(num_positions, 0.0);
+    for (const double value : values) {
+        const double scaled = (value - begin) / step;
+        const auto lower = std::min(
+            static_cast<std::size_t>(scaled), num_positions - 2U);
+        const double fraction = scaled - static_cast<double>(lower);
+        bins[lower] += 1.0 - fraction;
+        bins[lower + 1U] += fraction;
+    }
+
+    // Weights of the kernel truncated at a distance where it is negligible.
+    constexpr double cutoff_in_bandwidth = 5.0;
+    const auto num_weights =
+        static_cast<std::size_t>(
+            std::ceil(cutoff_in_bandwidth * bandwidth / step)) +
+        1U;
+    constexpr double pi = 3.14159265358979323846;
+    const double normalization = 1.0 /
+        (std::sqrt(2.0 * pi) * static_cast<double>(values.size()) *
+            bandwidth);
+    std::vector<double> weights;
+    weights.reserve(num_weights);
+    for (std::size_t d = 0; d < num_weights; ++d) {
+        const double scaled = static_cast<double>(d) * step / bandwidth;
+        weights.push_back(normalization * std::exp(-0.5 * scaled * scaled));
+    }
+
+    // Convolution.
+    result.densities.resize(num_positions, 0.0);
+    for (std::size_t i = 0; i < num_positions; ++i) {
+        if (bins[i] == 0.0) {
+            continue;
+        }
+        const std::size_t first = (i >= num_weights - 1U)
+            ? i - (num_weights - 1U)
+            : 0U;
+        const std::size_t last =
+            std::min(i + num_weights - 1U, num_positions - 1U);
+        for (std::size_t j = first; j <= last; ++j) {
+            const std::size_t d = (j > i) ? j - i : i - j;
+            result.densities[j] += bins[i] * weights[d];
+        }
+    }
+    return result;
+}
+
+}  // namespace plotly_plotter::figure_builders::details
@@ -0,0 +1,56 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of select_quantile function.
+ */
+#include "plotly_plotter/figure_builders/details/quantile.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace plotly_plotter::figure_builders::details {
+
+double select_quantile(std::vector<double>::iterator begin,
+    std::vector<double>::iterator end, double probability,
+    std::size_t& num_ordered_values) {
+    const auto size = static_cast<std::size_t>(end - begin);
+    // Position defined in the linear method of plotly.js.
+    constexpr double offset = 0.5;
+    const double position = probability * static_cast<double>(size) - offset;
+    const double clamped_position =
+        std::clamp(position, 0.0, static_cast<double>(size - 1U));
+    const auto lower_index = std::max(
+        num_ordered_values, static_cast<std::size_t>(clamped_position));
+    const double fraction =
+        clamped_position - static_cast<double>(lower_index);
+
+    const auto lower_iter = begin + static_cast<std::ptrdiff_t>(lower_index);
+    std::nth_element(begin + static_cast<std::ptrdiff_t>(num_ordered_values),
+        lower_iter, end);
+    num_ordered_values = lower_index;
+    const double lower_value = *lower_iter;
+    if (fraction <= 0.0 || lower_index + 1U >= size) {
+        return lower_value;
+    }
+    // The next value in the sorted order is the minimum value after the
+    // selected value.
+    const double upper_value = *std::min_element(lower_iter + 1, end);
+    return fraction * upper_value + (1.0 - fraction) * lower_value;
+}
+
+}  // namespace plotly_plotter::figure_builders::details
@@ -19,11 +19,17 @@
  */
 #include "plotly_plotter/figure_builders/figure_builder_base.h"
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
+#include <filesystem>
 #include <iterator>
 #include <memory>
+#include <optional>
+#include <random>
 #include <stdexcept>
 #include <string>
+#include <system_error>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -33,19 +39,88 @@
 
 #include "plotly_plotter/data_column.h"
 #include "plotly_plotter/data_table.h"
+#include "plotly_plotter/details/write_html_impl.h"
 #include "plotly_plotter/figure.h"
+#include "plotly_plotter/figure_builders/details/figure_builder_helper.h"
+#include "plotly_plotter/figure_prototype.h"
+#include "plotly_plotter/io/output_sink.h"
 #include "plotly_plotter/json_document.h"
 #include "plotly_plotter/json_value.h"
 #include "plotly_plotter/layout.h"
+#include "plotly_plotter/tracing/tracer.h"
+#include "plotly_plotter/write_html.h"
 
 namespace plotly_plotter::figure_builders {
 
-figure figure_builder_base::create() const {
+figure figure_builder_base::create() const { return create_from(nullptr); }
+
+figure figure_builder_base::create(const figure_prototype& prototype) const {
+    return create_from(&prototype);
+}
+
+void figure_builder_base::write_html(const std::string& file_path) const {
+    // The figure is written to a temporary file in the same directory first,
+    // so that failures while creating frames never leave truncated files.
+    const std::string temporary_file_path = fmt::format("{}.{:08x}.tmp",
+        file_path, static_cast<std::uint32_t>(std::random_device()()));
+    try {
+        {
+            io::file_output_sink sink(temporary_file_path);
+            write_html_to(sink);
+        }
+        std::error_code error;
+        std::filesystem::rename(temporary_file_path, file_path, error);
+        if (error) {
+            throw std::runtime_error(fmt::format(
+                "Failed to rename {} to {}: {}", temporary_file_path,
+                file_path, error.message()));
+        }
+    } catch (...) {
+        std::error_code error;
+        std::filesystem::remove(temporary_file_path, error);
+        throw;
+    }
+}
+
+void figure_builder_base::write_html_to(io::output_sink& sink) const {
+    if (animation_frame_.empty()) {
+        plotly_plotter::write_html_to(sink, create());
+        return;
+    }
+
+    // The title is written before frames, so it is determined here in the
+    // same way as configure_figure function.
+    const std::string html_title = title_.empty() ? default_title() : title_;
+    // The writer is created when the first frame is written so that nothing
+    // is written when the figure can't be created due to errors in settings.
+    std::optional<plotly_plotter::details::html_frame_stream_writer> writer;
+    const figure fig = create_from(nullptr, [&](const json_document& frame) {
+        if (!writer) {
+            writer.emplace(sink, html_title.c_str());
+        }
+        writer->write_frame(frame);
+    });
+    if (!writer) {
+        writer.emplace(sink, html_title.c_str());
+    }
+    writer->finish(fig.document());
+}
+
+figure figure_builder_base::create_from(
+    const figure_prototype* prototype, const frame_writer& write_frame) const {
+    PLOTLY_PLOTTER_TRACE_SPAN("figure_builder::create", "builder");
     if (!data_.has_consistent_rows()) {
         throw std::runtime_error("Data table has inconsistent number of rows.");
     }
 
-    figure fig;
+    // This throws an exception before allocating the figure when the budget
+    // is exceeded.
+    check_row_budget();
+    // Rows are thinned in each trace, because thinning rows of the whole
+    // table at a regular interval can drop all rows of interleaved groups.
+    const std::vector<bool> parent_mask(data_.rows(), true);
+
+    figure fig = (prototype != nullptr) ? prototype->create() : figure();
 
     if (!subplot_row_.empty() || !subplot_column_.empty()) {
         fig.layout().grid().rows(1);
@@ -56,15 +131,25 @@ figure figure_builder_base::create() const {
         fig.layout().grid().pattern("independent");
     }
 
-    const std::vector<bool> parent_mask(data_.rows(), true);
     constexpr std::string_view hover_prefix;
     const auto additional_hover_text = generate_additional_hover_text();
-    const auto [num_subplot_rows, num_subplot_columns] = handle_animation_frame(
-        fig, parent_mask, hover_prefix, additional_hover_text);
+    const auto [num_subplot_rows, num_subplot_columns] =
+        handle_animation_frame(fig, parent_mask, hover_prefix,
+            additional_hover_text, write_frame);
 
     configure_figure(fig, num_subplot_rows, num_subplot_columns);
     fig.layout().legend().trace_group_gap(0.0);
 
+    // Arrays of uniformly spaced coordinates are removed before sharing
+    // arrays, and arrays like x coordinates are often repeated in traces of
+    // groups, subplots, and frames.
+    if (compress_uniform_coordinates_) {
+        fig.compress_uniform_coordinates();
+    }
+    if (share_repeated_arrays_) {
+        fig.share_repeated_arrays();
+    }
+
     return fig;
 }
 
@@ -95,8 +180,92 @@ void figure_builder_base::set_title(std::string value) {
     title_ = std::move(value);
 }
 
+void figure_builder_base::set_row_budget(
+    std::size_t max_rows, row_budget_policy policy) {
+    max_rows_ = max_rows;
+    row_budget_policy_ = policy;
+}
+
+void figure_builder_base::set_remove_constant_frame_attributes(bool value) {
+    remove_constant_frame_attributes_ = value;
+}
+
+void figure_builder_base::set_compress_uniform_coordinates(bool value) {
+    compress_uniform_coordinates_ = value;
+}
+
+void figure_builder_base::set_share_repeated_arrays(bool value) {
+    share_repeated_arrays_ = value;
+}
+
 const data_table& figure_builder_base::data() const noexcept { return data_; }
 
+const std::string& figure_builder_base::group_column() const noexcept {
+    return group_;
+}
+
+std::vector<std::size_t> figure_builder_base::trace_indices_of_rows() const {
+    std::vector<std::size_t> trace_indices(data_.rows(), 0);
+    for (const std::string* column_name :
+        {&animation_frame_, &subplot_row_, &subplot_column_, &group_}) {
+        if (column_name->empty()) {
+            continue;
+        }
+        trace_indices = details::combine_group_indices(
+            trace_indices, data_.at(*column_name)->generate_group().second)
+                            .first;
+    }
+    return trace_indices;
+}
+
+bool figure_builder_base::is_thinned_by_row_budget() const noexcept {
+    return max_rows_ != 0 && data_.rows() > max_rows_ &&
+        row_budget_policy_ == row_budget_policy::downsample;
+}
+
+std::vector<bool> figure_builder_base::apply_row_budget(
+    const std::vector<bool>& trace_mask) const {
+    if (!is_thinned_by_row_budget()) {
+        return trace_mask;
+    }
+
+    std::size_t num_trace_rows = 0;
+    for (const bool is_selected : trace_mask) {
+        num_trace_rows += static_cast<std::size_t>(is_selected);
+    }
+    const std::size_t num_plotted_rows = std::max<std::size_t>(
+        num_trace_rows * max_rows_ / data_.rows(), 1);
+    if (num_plotted_rows >= num_trace_rows) {
+        return trace_mask;
+    }
+
+    // Select the (i * num_trace_rows / num_plotted_rows)-th rows in the trace
+    // for i = 0, 1, ..., num_plotted_rows - 1.
+    std::vector<bool> mask(trace_mask.size(), false);
+    std::size_t position = 0;
+    std::size_t num_selected_rows = 0;
+    std::size_t next_position = 0;
+    for (std::size_t row_index = 0;
+        row_index < trace_mask.size() && num_selected_rows < num_plotted_rows;
+        ++row_index) {
+        if (!trace_mask[row_index]) {
+            continue;
+        }
+        if (position == next_position) {
+            mask[row_index] = true;
+            ++num_selected_rows;
+            next_position =
+                num_selected_rows * num_trace_rows / num_plotted_rows;
+        }
+        ++position;
+    }
+    return mask;
+}
+
+bool figure_builder_base::supports_row_downsampling() const noexcept {
+    return false;
+}
+
 namespace {
 
 //! Position of the annotation to place at the center.
@@ -113,7 +282,8 @@ constexpr double annotation_shift = 30;
 std::pair<std::size_t, std::size_t> figure_builder_base::handle_animation_frame(
     figure& fig, const std::vector<bool>& parent_mask,
     std::string_view hover_prefix,
-    const std::vector<std::string>& additional_hover_text) const {
+    const std::vector<std::string>& additional_hover_text,
+    const frame_writer& write_frame) const {
     if (animation_frame_.empty()) {
         constexpr bool is_first_frame = true;
         return handle_subplot_row(fig, is_first_frame, parent_mask,
@@ -138,17 +308,27 @@ std::pair<std::size_t, std::size_t> figure_builder_base::handle_animation_frame(
                 (group_indices[row_index] == group_index);
         }
 
-        auto frame = fig.add_frame();
         const auto& group_value = group_values[group_index];
-        frame.name(group_value);
         if (group_index == 0) {
             constexpr bool is_first_frame = true;
             subplot_size = handle_subplot_row(fig, is_first_frame, group_mask,
                 hover_prefix, additional_hover_text);
         }
         constexpr bool is_first_frame = false;
-        subplot_size = handle_subplot_row(frame, is_first_frame, group_mask,
-            hover_prefix, additional_hover_text);
+        if (write_frame) {
+            // The frame is released after written.
+            json_document frame_document;
+            animation_frame frame(frame_document.root());
+            frame.name(group_value);
+            subplot_size = handle_subplot_row(frame, is_first_frame,
+                group_mask, hover_prefix, additional_hover_text);
+            write_frame(frame_document);
+        } else {
+            auto frame = fig.add_frame();
+            frame.name(group_value);
+            subplot_size = handle_subplot_row(frame, is_first_frame,
+                group_mask, hover_prefix, additional_hover_text);
+        }
 
         auto step = slider.add_step();
         step.label(group_value);
@@ -156,6 +336,11 @@ std::pair<std::size_t, std::size_t> figure_builder_base::handle_animation_frame(
         step.args(std::make_tuple(std::vector{group_value}));
     }
 
+    if (remove_constant_frame_attributes_ && !write_frame) {
+        // Frames are shrunk to attributes changing among frames.
+        details::remove_constant_attributes_in_frames(fig);
+    }
+
     slider.pad().l(120.0);  // NOLINT(*-magic-numbers)
     slider.pad().t(70.0);   // NOLINT(*-magic-numbers)
 
@@ -324,6 +509,7 @@ void figure_builder_base::handle_groups(figure_frame_base& fig,
     if (group_.empty()) {
         const std::string group_name;
         constexpr std::size_t group_index = 0;
+        PLOTLY_PLOTTER_TRACE_SPAN("figure_builder::add_trace", "builder");
         add_trace(fig, parent_mask, subplot_index, group_name, group_index,
             hover_prefix, additional_hover_text);
         if (is_first_frame) {
@@ -345,6 +531,7 @@ void figure_builder_base::handle_groups(figure_frame_base& fig,
                 (group_indices[row_index] == group_index);
         }
 
+        PLOTLY_PLOTTER_TRACE_SPAN("figure_builder::add_trace", "builder");
         const auto& group_name = group_values[group_index];
         const auto group_hover_prefix =
             fmt::format("{}{}={}<br>", hover_prefix, group_, group_name);
@@ -368,6 +555,24 @@ void figure_builder_base::configure_figure(figure& fig,
     }
 }
 
+void figure_builder_base::check_row_budget() const {
+    const std::size_t rows = data_.rows();
+    if (max_rows_ == 0 || rows <= max_rows_) {
+        return;
+    }
+    if (row_budget_policy_ == row_budget_policy::throw_error) {
+        throw std::runtime_error(
+            fmt::format("Number of rows ({}) exceeds the budget ({}).", rows,
+                max_rows_));
+    }
+    if (!supports_row_downsampling()) {
+        throw std::runtime_error(fmt::format(
+            "Number of rows ({}) exceeds the budget ({}), but rows can't be "
+            "downsampled because values in rows are aggregated.",
+            rows, max_rows_));
+    }
+}
+
 std::vector<std::string> figure_builder_base::generate_additional_hover_text()
     const {
     std::vector<std::string> hover_columns = additional_hover_data_in_trace();
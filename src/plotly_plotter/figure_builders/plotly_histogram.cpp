@@ -110,6 +110,23 @@ plotly_histogram& plotly_histogram::title(std::string value) {
     return *this;
 }
 
+plotly_histogram& plotly_histogram::row_budget(
+    std::size_t max_rows, row_budget_policy policy) {
+    set_row_budget(max_rows, policy);
+    return *this;
+}
+
+plotly_histogram& plotly_histogram::remove_constant_frame_attributes(
+    bool value) {
+    set_remove_constant_frame_attributes(value);
+    return *this;
+}
+
+plotly_histogram& plotly_histogram::share_repeated_arrays(bool value) {
+    set_share_repeated_arrays(value);
+    return *this;
+}
+
 void plotly_histogram::configure_axes(figure& fig, std::size_t num_subplot_rows,
     std::size_t num_subplot_columns, bool require_manual_axis_ranges) const {
     details::configure_axes_common(
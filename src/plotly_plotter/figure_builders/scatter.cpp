@@ -32,6 +32,7 @@
 #include "plotly_plotter/data_table.h"
 #include "plotly_plotter/figure.h"
 #include "plotly_plotter/figure_builders/details/calculate_axis_range.h"
+#include "plotly_plotter/figure_builders/details/downsample.h"
 #include "plotly_plotter/figure_builders/details/figure_builder_helper.h"
 #include "plotly_plotter/figure_builders/figure_builder_base.h"
 #include "plotly_plotter/layout.h"
@@ -179,6 +180,35 @@ scatter& scatter::title(std::string value) {
     return *this;
 }
 
+scatter& scatter::row_budget(std::size_t max_rows, row_budget_policy policy) {
+    set_row_budget(max_rows, policy);
+    return *this;
+}
+
+scatter& scatter::remove_constant_frame_attributes(bool value) {
+    set_remove_constant_frame_attributes(value);
+    return *this;
+}
+
+scatter& scatter::compress_uniform_coordinates(bool value) {
+    set_compress_uniform_coordinates(value);
+    return *this;
+}
+
+scatter& scatter::share_repeated_arrays(bool value) {
+    set_share_repeated_arrays(value);
+    return *this;
+}
+
+scatter& scatter::downsampling(downsampling_method method, std::size_t width) {
+    if (width == 0) {
+        throw std::invalid_argument("Width must be positive.");
+    }
+    downsampling_method_ = method;
+    max_downsampled_points_ = 2 * width;
+    return *this;
+}
+
 void scatter::configure_axes(figure& fig, std::size_t num_subplot_rows,
     std::size_t num_subplot_columns, bool require_manual_axis_ranges) const {
     details::configure_axes_common(
@@ -240,30 +270,45 @@ void scatter::add_trace(figure_frame_base& figure,
     std::string_view group_name, std::size_t group_index,
     std::string_view hover_prefix,
     const std::vector<std::string>& additional_hover_text) const {
+    if (y_.empty()) {
+        throw std::runtime_error("y coordinates must be set.");
+    }
+    const std::shared_ptr<data_column_base> x_column =
+        x_.empty() ? nullptr : data().at(x_);
+    const std::vector<bool> mask = details::downsample(downsampling_method_,
+        x_column.get(), *data().at(y_), apply_row_budget(parent_mask),
+        max_downsampled_points_);
+
     const std::size_t rows = data().rows();
     const bool use_web_gl =
         use_web_gl_.value_or(rows >= max_rows_for_non_gl_trace);
     if (!use_web_gl) {
         auto scatter = figure.add_scatter();
-        configure_trace(scatter, parent_mask, subplot_index, group_name,
+        configure_trace(scatter, mask, parent_mask, subplot_index, group_name,
             group_index, hover_prefix, additional_hover_text);
     } else {
         auto scatter = figure.add_scatter_gl();
-        configure_trace(scatter, parent_mask, subplot_index, group_name,
+        configure_trace(scatter, mask, parent_mask, subplot_index, group_name,
             group_index, hover_prefix, additional_hover_text);
     }
 }
 
+bool scatter::supports_row_downsampling() const noexcept { return true; }
+
 template <typename Trace>
 void scatter::configure_trace(Trace& scatter,
-    const std::vector<bool>& parent_mask, std::size_t subplot_index,
-    std::string_view group_name, std::size_t group_index,
-    std::string_view hover_prefix,
+    const std::vector<bool>& parent_mask, const std::vector<bool>& trace_mask,
+    std::size_t subplot_index, std::string_view group_name,
+    std::size_t group_index, std::string_view hover_prefix,
     const std::vector<std::string>& additional_hover_text) const {
     scatter.mode(mode_);
 
     if (!x_.empty()) {
         scatter.x(filter_data_column(*data().at(x_), parent_mask));
+    } else if (parent_mask != trace_mask) {
+        // Points are placed at the positions in the trace as without
+        // thinning.
+        scatter.x(details::masked_row_positions(trace_mask, parent_mask));
     }
 
     if (y_.empty()) {
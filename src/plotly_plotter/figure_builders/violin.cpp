@@ -19,19 +19,32 @@
  */
 #include "plotly_plotter/figure_builders/violin.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
 #include <memory>
+#include <numeric>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 #include <fmt/format.h>
 
 #include "plotly_plotter/data_column.h"
 #include "plotly_plotter/figure.h"
+#include "plotly_plotter/figure_builders/details/box_statistics.h"
 #include "plotly_plotter/figure_builders/details/calculate_axis_range.h"
 #include "plotly_plotter/figure_builders/details/figure_builder_helper.h"
+#include "plotly_plotter/figure_builders/details/kernel_density.h"
 #include "plotly_plotter/layout.h"
+#include "plotly_plotter/traces/box.h"
+#include "plotly_plotter/traces/scatter.h"
 #include "plotly_plotter/traces/violin.h"
+#include "plotly_plotter/tracing/tracer.h"
 
 namespace plotly_plotter::figure_builders {
 
@@ -117,20 +130,54 @@ violin& violin::log_y(bool value) {
     return *this;
 }
 
+violin& violin::precompute_density(bool value) {
+    precompute_density_ = value;
+    return *this;
+}
+
 violin& violin::title(std::string value) {
     set_title(std::move(value));
     return *this;
 }
 
+violin& violin::row_budget(std::size_t max_rows, row_budget_policy policy) {
+    set_row_budget(max_rows, policy);
+    return *this;
+}
+
+violin& violin::remove_constant_frame_attributes(bool value) {
+    set_remove_constant_frame_attributes(value);
+    return *this;
+}
+
+violin& violin::share_repeated_arrays(bool value) {
+    set_share_repeated_arrays(value);
+    return *this;
+}
+
 void violin::configure_axes(figure& fig, std::size_t num_subplot_rows,
     std::size_t num_subplot_columns, bool require_manual_axis_ranges) const {
     details::configure_axes_common(
         fig, num_subplot_rows, num_subplot_columns, x_, y_);
 
-    // Set x-axis to categorical.
-    for (std::size_t i = 0; i < num_subplot_rows * num_subplot_columns; ++i) {
-        const std::size_t index = i + 1;
-        fig.layout().xaxis(index).type("category");
+    if (precompute_density_) {
+        // Set labels of categories to the linear x-axis.
+        prepare_violin_positions();
+        std::vector<double> tick_values(violin_position_labels_.size());
+        std::iota(tick_values.begin(), tick_values.end(), 0.0);
+        for (std::size_t i = 0; i < num_subplot_rows * num_subplot_columns;
+            ++i) {
+            const std::size_t index = i + 1;
+            fig.layout().xaxis(index).tick_values(tick_values);
+            fig.layout().xaxis(index).tick_text(violin_position_labels_);
+        }
+    } else {
+        // Set x-axis to categorical.
+        for (std::size_t i = 0; i < num_subplot_rows * num_subplot_columns;
+            ++i) {
+            const std::size_t index = i + 1;
+            fig.layout().xaxis(index).type("category");
+        }
     }
 
     // Set log scale.
@@ -164,40 +211,30 @@ void violin::add_trace(figure_frame_base& figure,
     std::string_view group_name, std::size_t group_index,
     std::string_view hover_prefix,
     const std::vector<std::string>& additional_hover_text) const {
+    const std::vector<bool> mask = apply_row_budget(parent_mask);
+    if (y_.empty()) {
+        throw std::runtime_error("y coordinates must be set.");
+    }
+    if (precompute_density_) {
+        add_precomputed_density(
+            figure, mask, subplot_index, group_name, group_index, hover_prefix);
+        return;
+    }
+
     auto violin = figure.add_violin();
 
     if (!x_.empty()) {
-        violin.x(filter_data_column(*data().at(x_), parent_mask));
+        violin.x(filter_data_column(*data().at(x_), mask));
     }
-
-    if (y_.empty()) {
-        throw std::runtime_error("y coordinates must be set.");
-    }
-    violin.y(filter_data_column(*data().at(y_), parent_mask));
+    violin.y(filter_data_column(*data().at(y_), mask));
 
     const bool has_additional_hover_text = !additional_hover_text.empty() &&
         !additional_hover_text.front().empty();
     if (has_additional_hover_text) {
-        details::add_hover_text(violin, parent_mask, additional_hover_text);
+        details::add_hover_text(violin, mask, additional_hover_text);
     }
 
-    switch (color_mode_) {
-    case color_mode::fixed:
-        violin.color(fixed_color_);
-        break;
-    case color_mode::sequence:
-        violin.color(color_sequence_[group_index % color_sequence_.size()]);
-        break;
-    case color_mode::map: {
-        const auto iter = color_map_.find(std::string(group_name));
-        if (iter == color_map_.end()) {
-            throw std::runtime_error(fmt::format(
-                "Color map does not contain group name: {}", group_name));
-        }
-        violin.color(iter->second);
-        break;
-    }
-    }
+    violin.color(color_of(group_name, group_index));
 
     violin.box().visible(show_box_);
     violin.mean_line().visible(show_mean_line_);
@@ -228,8 +265,254 @@ void violin::add_trace(figure_frame_base& figure,
     }
 }
 
+const std::string& violin::color_of(
+    std::string_view group_name, std::size_t group_index) const {
+    switch (color_mode_) {
+    case color_mode::fixed:
+        return fixed_color_;
+    case color_mode::sequence:
+        return color_sequence_[group_index % color_sequence_.size()];
+    case color_mode::map: {
+        const auto iter = color_map_.find(std::string(group_name));
+        if (iter == color_map_.end()) {
+            throw std::runtime_error(fmt::format(
+                "Color map does not contain group name: {}", group_name));
+        }
+        return iter->second;
+    }
+    }
+    throw std::runtime_error("Invalid color mode.");
+}
+
+void violin::prepare_violin_positions() const {
+    if (violin_positions_prepared_) {
+        return;
+    }
+    std::vector<std::string> groups;
+    if (!group_column().empty()) {
+        groups = data().at(group_column())->generate_group().first;
+        num_groups_ = groups.size();
+    }
+    if (!x_.empty()) {
+        std::tie(violin_position_labels_, violin_position_indices_) =
+            data().at(x_)->generate_group();
+    } else if (!groups.empty()) {
+        // Violins of groups are placed at different positions
+        // as violin traces without x coordinates in plotly.js.
+        violin_position_labels_ = std::move(groups);
+    } else {
+        violin_position_labels_ = {std::string()};
+    }
+    violin_positions_prepared_ = true;
+}
+
+void violin::add_precomputed_density(figure_frame_base& figure,
+    const std::vector<bool>& mask, std::size_t subplot_index,
+    std::string_view group_name, std::size_t group_index,
+    std::string_view hover_prefix) const {
+    PLOTLY_PLOTTER_TRACE_SPAN("violin::add_precomputed_density", "builder");
+    const auto& y_column = *data().at(y_);
+    if (!y_column.is_numeric()) {
+        throw std::runtime_error(
+            "y coordinates must be numeric to precompute densities.");
+    }
+    prepare_violin_positions();
+    const std::string& color = color_of(group_name, group_index);
+    const std::vector<double> y_values =
+        y_column.as_masked_double_vector(mask);
+
+    // Values of y coordinates at each position of violins.
+    std::vector<std::vector<double>> values_at_positions(
+        violin_position_labels_.size());
+    if (x_.empty()) {
+        const std::size_t position = (num_groups_ > 0) ? group_index : 0;
+        for (const double value : y_values) {
+            if (!std::isnan(value)) {
+                values_at_positions[position].push_back(value);
+            }
+        }
+    } else {
+        std::size_t masked_index = 0;
+        for (std::size_t i = 0; i < mask.size(); ++i) {
+            if (!mask[i]) {
+                continue;
+            }
+            const double value = y_values[masked_index];
+            ++masked_index;
+            if (!std::isnan(value)) {
+                values_at_positions[violin_position_indices_[i]].push_back(
+                    value);
+            }
+        }
+    }
+
+    // Violins of groups are placed side by side in each category.
+    constexpr double max_violin_width = 0.8;
+    const std::size_t num_slots =
+        (!x_.empty() && num_groups_ > 1) ? num_groups_ : 1;
+    const double slot_width =
+        max_violin_width / static_cast<double>(num_slots);
+    const double offset = (num_slots > 1)
+        ? -0.5 * max_violin_width +
+            (static_cast<double>(group_index) + 0.5) * slot_width
+        : 0.0;
+    const double max_half_width = 0.5 * slot_width;
+
+    constexpr double gap = std::numeric_limits<double>::quiet_NaN();
+    const bool show_all_points = points_ == "all";
+    const bool show_outliers =
+        points_ == "outliers" || points_ == "suspectedoutliers";
+    std::vector<double> outline_x;
+    std::vector<double> outline_y;
+    std::vector<double> box_x;
+    std::vector<double> q1;
+    std::vector<double> median;
+    std::vector<double> q3;
+    std::vector<double> lower_fence;
+    std::vector<double> upper_fence;
+    std::vector<double> mean_line_x;
+    std::vector<double> mean_line_y;
+    std::vector<double> point_x;
+    std::vector<double> point_y;
+    for (std::size_t position = 0; position < values_at_positions.size();
+        ++position) {
+        auto& values = values_at_positions[position];
+        if (values.empty()) {
+            continue;
+        }
+        const double center = static_cast<double>(position) + offset;
+        const auto statistics = details::calculate_box_statistics(values);
+        const auto density =
+            details::estimate_kernel_density(values, statistics);
+        const double max_density = *std::max_element(
+            density.densities.begin(), density.densities.end());
+        const double scale = max_half_width / max_density;
+
+        // Outline of the violin in a closed shape.
+        if (!outline_x.empty()) {
+            outline_x.push_back(gap);
+            outline_y.push_back(gap);
+        }
+        const std::size_t num_positions = density.positions.size();
+        for (std::size_t i = 0; i < num_positions; ++i) {
+            outline_x.push_back(center + scale * density.densities[i]);
+            outline_y.push_back(density.positions[i]);
+        }
+        for (std::size_t i = num_positions; i > 0; --i) {
+            outline_x.push_back(center - scale * density.densities[i - 1]);
+            outline_y.push_back(density.positions[i - 1]);
+        }
+        outline_x.push_back(outline_x[outline_x.size() - 2 * num_positions]);
+        outline_y.push_back(density.positions.front());
+
+        box_x.push_back(center);
+        q1.push_back(statistics.q1);
+        median.push_back(statistics.median);
+        q3.push_back(statistics.q3);
+        lower_fence.push_back(statistics.lower_fence);
+        upper_fence.push_back(statistics.upper_fence);
+
+        // Mean line across the violin.
+        const auto upper_iter = std::lower_bound(density.positions.begin(),
+            density.positions.end(), statistics.mean);
+        double density_at_mean = density.densities.front();
+        if (upper_iter == density.positions.end()) {
+            density_at_mean = density.densities.back();
+        } else if (upper_iter != density.positions.begin()) {
+            const auto upper_index = static_cast<std::size_t>(
+                upper_iter - density.positions.begin());
+            const double lower_position = density.positions[upper_index - 1];
+            const double ratio = (statistics.mean - lower_position) /
+                (density.positions[upper_index] - lower_position);
+            density_at_mean =
+                (1.0 - ratio) * density.densities[upper_index - 1] +
+                ratio * density.densities[upper_index];
+        }
+        const double half_width_at_mean = scale * density_at_mean;
+        mean_line_x.insert(mean_line_x.end(),
+            {center - half_width_at_mean, center + half_width_at_mean, gap});
+        mean_line_y.insert(mean_line_y.end(),
+            {statistics.mean, statistics.mean, gap});
+
+        for (const double value : values) {
+            if (show_all_points ||
+                (show_outliers &&
+                    (value < statistics.lower_fence ||
+                        value > statistics.upper_fence))) {
+                point_x.push_back(center);
+                point_y.push_back(value);
+            }
+        }
+    }
+
+    const auto hover_template =
+        fmt::format("{}{}=%{{y}}", hover_prefix, y_);
+    const auto configure_common = [&](auto& trace) {
+        trace.legend_group(group_name);
+        trace.hover_template(hover_template);
+        if (subplot_index > 1) {
+            trace.xaxis(fmt::format("x{}", subplot_index));
+            trace.yaxis(fmt::format("y{}", subplot_index));
+        }
+    };
+
+    auto outline = figure.add_scatter();
+    outline.x(outline_x);
+    outline.y(outline_y);
+    outline.mode("lines");
+    outline.fill("toself");
+    outline.color(color);
+    outline.name(group_name);
+    configure_common(outline);
+    if (subplot_index > 1) {
+        outline.show_legend(false);
+    }
+
+    if (show_box_) {
+        // Boxes in violins are a quarter as wide as violins in plotly.js.
+        constexpr double box_width_ratio = 0.25;
+        auto box = figure.add_box();
+        box.x(box_x);
+        box.q1(q1);
+        box.median(median);
+        box.q3(q3);
+        box.lower_fence(lower_fence);
+        box.upper_fence(upper_fence);
+        box.width(2.0 * max_half_width * box_width_ratio);
+        box.box_points("false");
+        box.color(color);
+        box.name(group_name);
+        box.show_legend(false);
+        configure_common(box);
+    }
+
+    if (show_mean_line_) {
+        auto mean_line = figure.add_scatter();
+        mean_line.x(mean_line_x);
+        mean_line.y(mean_line_y);
+        mean_line.mode("lines");
+        mean_line.color(color);
+        mean_line.name(group_name);
+        mean_line.show_legend(false);
+        configure_common(mean_line);
+    }
+
+    if (!point_x.empty()) {
+        auto points = figure.add_scatter();
+        points.x(point_x);
+        points.y(point_y);
+        points.mode("markers");
+        points.color(color);
+        points.name(group_name);
+        points.show_legend(false);
+        configure_common(points);
+    }
+}
+
 std::vector<std::string> violin::additional_hover_data_in_trace() const {
     return {};
 }
 
+bool violin::supports_row_downsampling() const noexcept { return true; }
+
 }  // namespace plotly_plotter::figure_builders
@@ -28,7 +28,11 @@
 #include <fmt/format.h>
 
 #include "plotly_plotter/details/config.h"
+#include "plotly_plotter/io/details/executable_check_cache.h"
+#include "plotly_plotter/io/details/executable_version_cache.h"
 #include "plotly_plotter/io/details/execute_command.h"
+#include "plotly_plotter/metrics/metrics_registry.h"
+#include "plotly_plotter/tracing/tracer.h"
 
 namespace plotly_plotter::io {
 
@@ -52,16 +56,36 @@ namespace {
 #endif
 }
 
+/*!
+ * \brief Get the version of a Chrome executable.
+ *
+ * \param[in] executable_path Path of the Chrome executable.
+ * \return Version, or an empty string if not available.
+ */
+[[nodiscard]] std::string get_chrome_version(
+    const std::string& executable_path) {
+#if PLOTLY_PLOTTER_USE_WIN_SUBPROCESS
+    // Currently not supported.
+    (void)executable_path;
+    return std::string();
+#else
+    const std::vector<std::string> command{executable_path, "--version"};
+    return details::capture_command_output(command).value_or(std::string());
+#endif
+}
+
 /*!
  * \brief Find the path of the Chrome executable.
  *
+ * \param[in,out] check_cache Cache of results of checks.
  * \return Path of the Chrome executable.
  */
-[[nodiscard]] std::string find_chrome_path() {
+[[nodiscard]] std::string find_chrome_path(
+    details::executable_check_cache& check_cache) {
     const std::vector<std::string> possible_paths{"chromium",
         "chromium-browser", "google-chrome", "google-chrome-stable", "chrome"};
     for (const auto& path : possible_paths) {
-        if (check_chrome_executable(path)) {
+        if (check_cache.check(path, check_chrome_executable)) {
             return path;
         }
     }
@@ -76,11 +100,15 @@ chrome_converter& chrome_converter::get_instance() {
 }
 
 bool chrome_converter::is_html_to_pdf_conversion_supported() {
-    return check_chrome_executable(get_chrome_path());
+    return check_cache_.check(get_chrome_path(), check_chrome_executable);
 }
 
 void chrome_converter::convert_html_to_pdf(const char* html_file_path,
     const char* pdf_file_path, std::size_t width, std::size_t height) {
+    PLOTLY_PLOTTER_TRACE_SPAN(
+        "chrome_converter::convert_html_to_pdf", "converter");
+    const metrics::scoped_conversion_measurement measurement(
+        metrics::converter_type::chrome);
     std::vector<std::string> command{get_chrome_path(), "--headless",
         fmt::format("--print-to-pdf={}", pdf_file_path),
         fmt::format("--window-size={},{}", width, height),
@@ -101,11 +129,15 @@ void chrome_converter::convert_html_to_pdf(const char* html_file_path,
 }
 
 bool chrome_converter::is_html_to_png_conversion_supported() {
-    return check_chrome_executable(get_chrome_path());
+    return check_cache_.check(get_chrome_path(), check_chrome_executable);
 }
 
 void chrome_converter::convert_html_to_png(const char* html_file_path,
     const char* png_file_path, std::size_t width, std::size_t height) {
+    PLOTLY_PLOTTER_TRACE_SPAN(
+        "chrome_converter::convert_html_to_png", "converter");
+    const metrics::scoped_conversion_measurement measurement(
+        metrics::converter_type::chrome);
     std::vector<std::string> command{get_chrome_path(), "--headless",
         fmt::format("--screenshot={}", png_file_path),
         fmt::format("--window-size={},{}", width, height),
@@ -129,13 +161,21 @@ std::string chrome_converter::get_chrome_path() {
     return chrome_path_;
 }
 
+std::string chrome_converter::get_version() {
+    return version_cache_.get(get_chrome_path(), get_chrome_version);
+}
+
 void chrome_converter::set_chrome_path(std::string path) {
-    std::unique_lock<std::mutex> lock(mutex_);
-    chrome_path_ = std::move(path);
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        chrome_path_ = std::move(path);
+    }
+    check_cache_.clear();
 }
 
 chrome_converter::~chrome_converter() = default;
 
-chrome_converter::chrome_converter() : chrome_path_(find_chrome_path()) {}
+chrome_converter::chrome_converter()
+    : chrome_path_(find_chrome_path(check_cache_)) {}
 
 }  // namespace plotly_plotter::io
@@ -19,55 +19,200 @@
  */
 #include "plotly_plotter/io/details/execute_command.h"
 
+#include <optional>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 
 #include "plotly_plotter/details/config.h"
+#include "plotly_plotter/metrics/metrics_registry.h"
+#include "plotly_plotter/tracing/tracer.h"
+
+namespace plotly_plotter::io::details {
+
+//! Header of outputs of processes.
+constexpr std::string_view command_output_header =
+    "\n"
+    "Output from a process:\n";
+
+}  // namespace plotly_plotter::io::details
 
 #if PLOTLY_PLOTTER_USE_UNIX_SUBPROCESS
 
+#include <algorithm>
 #include <array>
 #include <cerrno>
 #include <chrono>
 #include <cstdio>
 #include <string>
 #include <thread>
+#include <tuple>
 #include <utility>
 #include <vector>
 
 #include <fcntl.h>
 #include <fmt/format.h>
+#include <poll.h>
 #include <signal.h>  // NOLINT: for some Linux APIs.
+#include <spawn.h>
 #include <stdlib.h>  // NOLINT: for some Linux APIs.
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
+#include "plotly_plotter/io/subprocess_settings.h"
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+// NOLINTNEXTLINE(*-avoid-non-const-global-variables): Required by POSIX.
+extern char** environ;
+
 namespace plotly_plotter::io::details {
 
+namespace {
+
 /*!
- * \brief Execute a command.
+ * \brief Class of file descriptors.
  *
- * \param[in] command Command.
- * \param[in] capture_logs Whether to capture logs.
- * \return Exit status and output of the command.
+ * This class is for RAII of file descriptors.
  */
-[[nodiscard]] inline std::pair<int, std::string> execute_command_impl(
-    const std::vector<std::string>& command, bool capture_logs) {
-    std::vector<std::string> command_copy = command;
-    std::vector<char*> argv;
-    argv.reserve(command.size() + 1);
-    for (auto& arg : command_copy) {
-        argv.push_back(arg.data());
+class file_descriptor {
+public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param[in] descriptor File descriptor.
+     */
+    explicit file_descriptor(int descriptor = -1) noexcept
+        : descriptor_(descriptor) {}
+
+    file_descriptor(const file_descriptor&) = delete;
+    file_descriptor& operator=(const file_descriptor&) = delete;
+    file_descriptor(file_descriptor&&) = delete;
+    file_descriptor& operator=(file_descriptor&&) = delete;
+
+    /*!
+     * \brief Destructor.
+     */
+    ~file_descriptor() { close(); }
+
+    /*!
+     * \brief Close the file descriptor.
+     */
+    void close() noexcept {
+        if (descriptor_ != -1) {
+            (void)::close(descriptor_);
+            descriptor_ = -1;
+        }
+    }
+
+    /*!
+     * \brief Reset the file descriptor.
+     *
+     * \param[in] descriptor New file descriptor.
+     */
+    void reset(int descriptor) noexcept {
+        close();
+        descriptor_ = descriptor;
     }
-    argv.push_back(nullptr);
 
+    /*!
+     * \brief Get the file descriptor.
+     *
+     * \return File descriptor.
+     */
+    [[nodiscard]] int get() const noexcept { return descriptor_; }
+
+    /*!
+     * \brief Check whether the file descriptor is valid.
+     *
+     * \retval true The file descriptor is valid.
+     * \retval false The file descriptor is invalid.
+     */
+    [[nodiscard]] bool is_valid() const noexcept { return descriptor_ != -1; }
+
+private:
+    //! File descriptor.
+    int descriptor_;
+};
+
+/*!
+ * \brief Create a pipe whose file descriptors are closed on exec.
+ *
+ * \param[out] read_end File descriptor of the reading end.
+ * \param[out] write_end File descriptor of the writing end.
+ */
+void create_pipe(file_descriptor& read_end, file_descriptor& write_end) {
     std::array<int, 2> pipe_descriptors{};
-    if (capture_logs) {
-        if (pipe(pipe_descriptors.data()) == -1) {
-            throw std::runtime_error("Failed to create a pipe.");
+    if (pipe(pipe_descriptors.data()) == -1) {
+        throw std::runtime_error("Failed to create a pipe.");
+    }
+    read_end.reset(pipe_descriptors[0]);
+    write_end.reset(pipe_descriptors[1]);
+    // The writing end is duplicated to stdout and stderr of the child process,
+    // which clears this flag for the duplicated descriptors.
+    for (const int descriptor : pipe_descriptors) {
+        // NOLINTNEXTLINE(*-vararg)
+        if (fcntl(descriptor, F_SETFD, FD_CLOEXEC) == -1) {
+            throw std::runtime_error("Failed to configure a pipe.");
+        }
+    }
+    // NOLINTNEXTLINE(*-vararg)
+    if (fcntl(read_end.get(), F_SETFL, O_NONBLOCK) == -1) {
+        throw std::runtime_error("Failed to configure a pipe.");
+    }
+}
+
+/*!
+ * \brief Start a process using `posix_spawn` function.
+ *
+ * \param[in] argv Arguments.
+ * \param[in] write_end File descriptor to which the output is redirected.
+ * (-1 to disable redirection.)
+ * \return Process ID, or -1 when the command could not be started.
+ */
+[[nodiscard]] pid_t start_process_with_posix_spawn(
+    std::vector<char*>& argv, int write_end) {
+    PLOTLY_PLOTTER_TRACE_SPAN("start_process_with_posix_spawn", "subprocess");
+    posix_spawn_file_actions_t file_actions{};
+    if (posix_spawn_file_actions_init(&file_actions) != 0) {
+        throw std::runtime_error("Failed to initialize file actions.");
+    }
+    if (write_end != -1) {
+        if (posix_spawn_file_actions_adddup2(
+                &file_actions, write_end, STDOUT_FILENO) != 0 ||
+            posix_spawn_file_actions_adddup2(
+                &file_actions, write_end, STDERR_FILENO) != 0) {
+            posix_spawn_file_actions_destroy(&file_actions);
+            throw std::runtime_error("Failed to configure file actions.");
         }
     }
 
+    pid_t pid = -1;
+    const int result = posix_spawnp(
+        &pid, argv[0], &file_actions, nullptr, argv.data(), environ);
+    posix_spawn_file_actions_destroy(&file_actions);
+    if (result != 0) {
+        // Failures in exec are reported here in some implementations
+        // (e.g., glibc 2.24 or later).
+        return -1;
+    }
+    return pid;
+}
+
+/*!
+ * \brief Start a process using `fork` and `exec` functions.
+ *
+ * \param[in] argv Arguments.
+ * \param[in] write_end File descriptor to which the output is redirected.
+ * (-1 to disable redirection.)
+ * \return Process ID.
+ */
+[[nodiscard]] pid_t start_process_with_fork(
+    std::vector<char*>& argv, int write_end) {
+    PLOTLY_PLOTTER_TRACE_SPAN("start_process_with_fork", "subprocess");
     pid_t pid = fork();
     if (pid == -1) {
         throw std::runtime_error("Failed to fork.");
@@ -75,81 +220,270 @@ namespace plotly_plotter::io::details {
 
     if (pid == 0) {
         // Child process
-        if (capture_logs) {
-            close(pipe_descriptors[0]);
-            if (dup2(pipe_descriptors[1], STDOUT_FILENO) == -1) {
+        if (write_end != -1) {
+            if (dup2(write_end, STDOUT_FILENO) == -1) {
                 perror("Failed to redirect stdout");
-                exit(1);  // NOLINT(concurrency-mt-unsafe)
+                _exit(1);
             }
-            if (dup2(pipe_descriptors[1], STDERR_FILENO) == -1) {
+            if (dup2(write_end, STDERR_FILENO) == -1) {
                 perror("Failed to redirect stderr");
-                exit(1);  // NOLINT(concurrency-mt-unsafe)
+                _exit(1);
             }
-            close(pipe_descriptors[1]);
-        }
-
-        int result = execvp(argv[0], argv.data());
-        if (result == -1) {
-            perror("Failed to execute child process");
-            exit(1);  // NOLINT(concurrency-mt-unsafe)
         }
 
-        // This line should not be reached
-        exit(2);  // NOLINT(concurrency-mt-unsafe)
+        (void)execvp(argv[0], argv.data());
+        perror("Failed to execute child process");
+        _exit(1);
     }
 
-    std::string command_output;
-    if (capture_logs) {
-        command_output =
-            "\n"
-            "Output from a process:\n";
+    return pid;
+}
+
+/*!
+ * \brief Open a file descriptor to wait for a process.
+ *
+ * \param[in] pid Process ID.
+ * \return File descriptor, or -1 if not supported.
+ */
+[[nodiscard]] int open_process_descriptor(pid_t pid) noexcept {
+#if defined(__linux__) && defined(SYS_pidfd_open)
+    // NOLINTNEXTLINE(*-vararg)
+    const long result = syscall(SYS_pidfd_open, pid, 0);
+    if (result >= 0) {
+        // NOLINTNEXTLINE(*-vararg)
+        (void)fcntl(static_cast<int>(result), F_SETFD, FD_CLOEXEC);
+        return static_cast<int>(result);
+    }
+    // Linux kernels older than 5.3 don't support pidfd_open.
+    return -1;
+#else
+    (void)pid;
+    return -1;
+#endif
+}
 
-        close(pipe_descriptors[1]);
+/*!
+ * \brief Terminate a process which exceeded the timeout and reap it.
+ *
+ * \param[in] pid Process ID.
+ */
+void terminate_process(pid_t pid) noexcept {
+    (void)kill(pid, SIGTERM);
 
-        if (fcntl(pipe_descriptors[0], F_SETFL, O_NONBLOCK) == -1) {
-            perror("Failed to set the pipe to non-blocking mode");
+    // Give the process a chance to clean up its children.
+    constexpr auto grace_period = std::chrono::seconds(1);
+    constexpr auto check_interval = std::chrono::milliseconds(10);
+    const auto deadline = std::chrono::steady_clock::now() + grace_period;
+    int status{};
+    while (std::chrono::steady_clock::now() < deadline) {
+        if (waitpid(pid, &status, WNOHANG) != 0) {
+            return;
         }
+        std::this_thread::sleep_for(check_interval);
+    }
+    (void)kill(pid, SIGKILL);
+    (void)waitpid(pid, &status, 0);
+}
 
-        constexpr std::size_t buffer_size = 1024;
-        char buffer[buffer_size];
-        const auto deadline =
-            std::chrono::steady_clock::now() + std::chrono::seconds(10);
-        while (true) {
-            ssize_t read_result =
-                read(pipe_descriptors[0], buffer, sizeof(buffer));
-            if (read_result == -1) {
-                if (errno == EAGAIN || errno == EWOULDBLOCK) {
-                    if (std::chrono::steady_clock::now() > deadline) {
-                        kill(pid, SIGTERM);
-                        throw std::runtime_error(fmt::format(
-                            "Timeout in child process.{}", command_output));
-                    }
-                    // NOLINTNEXTLINE
-                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
-                    continue;
-                }
-                perror("Failed to read from the pipe");
-                break;
+/*!
+ * \brief Read the output of a process from a pipe.
+ *
+ * \param[in,out] read_end File descriptor of the pipe.
+ * The descriptor is closed at the end of the output.
+ * \param[out] command_output Output of the process.
+ */
+void read_process_output(
+    file_descriptor& read_end, std::string& command_output) {
+    constexpr std::size_t buffer_size = 4096;
+    std::array<char, buffer_size> buffer{};
+    while (true) {
+        const ssize_t read_result =
+            read(read_end.get(), buffer.data(), buffer.size());
+        if (read_result > 0) {
+            command_output.append(
+                buffer.data(), static_cast<std::size_t>(read_result));
+            continue;
+        }
+        if (read_result == -1) {
+            if (errno == EINTR) {
+                continue;
             }
-            if (read_result == 0) {
-                break;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                return;
             }
-            command_output.append(
-                buffer, static_cast<std::size_t>(read_result));
+            perror("Failed to read from the pipe");
         }
-        close(pipe_descriptors[0]);
+        // End of the output, or an error.
+        read_end.close();
+        return;
     }
+}
 
-    int status{};
-    pid_t wait_result = waitpid(pid, &status, 0);
-    if (wait_result == -1) {
+/*!
+ * \brief Check whether a process has exited without blocking.
+ *
+ * \param[in] pid Process ID.
+ * \param[out] status Status of the process.
+ * \param[in] command_output Output of the process. (Used in error messages.)
+ * \retval true The process has exited.
+ * \retval false The process is still running.
+ */
+[[nodiscard]] bool try_wait_process(
+    pid_t pid, int& status, const std::string& command_output) {
+    const pid_t wait_result = waitpid(pid, &status, WNOHANG);
+    if (wait_result == pid) {
+        return true;
+    }
+    if (wait_result == -1 && errno != EINTR) {
         const auto error_number = errno;
         throw std::runtime_error(
             fmt::format("Failed to wait for the child process with error {}.{}",
                 error_number, command_output));
     }
+    return false;
+}
+
+/*!
+ * \brief Wait for a process, reading its output.
+ *
+ * \param[in] pid Process ID.
+ * \param[in,out] read_end File descriptor of the pipe of the output.
+ * (Invalid descriptor when the output is not captured.)
+ * \param[in] timeout Timeout.
+ * \param[out] command_output Output of the process.
+ * \return Status of the process.
+ *
+ * This function blocks in `poll` function on the pipe and the pidfd of the
+ * process, so no busy loop is needed on Linux 5.3 or later.
+ */
+[[nodiscard]] int wait_for_process(pid_t pid, file_descriptor& read_end,
+    std::chrono::milliseconds timeout, std::string& command_output) {
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    const file_descriptor process_descriptor(open_process_descriptor(pid));
+
+    int status{};
+    while (true) {
+        const auto remaining_time =
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                deadline - std::chrono::steady_clock::now());
+        if (remaining_time.count() <= 0) {
+            terminate_process(pid);
+            metrics::metrics_registry::get_instance().add(
+                metrics::counter_type::conversion_timeouts);
+            throw std::runtime_error(
+                fmt::format("Timeout in child process.{}", command_output));
+        }
+
+        std::array<pollfd, 2> poll_targets{};
+        nfds_t num_poll_targets = 0;
+        const bool has_output = read_end.is_valid();
+        if (has_output) {
+            poll_targets[num_poll_targets] = pollfd{read_end.get(), POLLIN, 0};
+            ++num_poll_targets;
+        }
+        const nfds_t process_target_index = num_poll_targets;
+        if (process_descriptor.is_valid()) {
+            poll_targets[num_poll_targets] =
+                pollfd{process_descriptor.get(), POLLIN, 0};
+            ++num_poll_targets;
+        }
+
+        if (num_poll_targets == 0) {
+            // Fallback when pidfd is not available and the output has been
+            // closed.
+            if (try_wait_process(pid, status, command_output)) {
+                return status;
+            }
+            constexpr auto check_interval = std::chrono::milliseconds(10);
+            std::this_thread::sleep_for(
+                std::min<std::chrono::milliseconds>(remaining_time,
+                    check_interval));
+            continue;
+        }
+
+        const int poll_result = poll(poll_targets.data(), num_poll_targets,
+            static_cast<int>(remaining_time.count()));
+        if (poll_result == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+            const auto error_number = errno;
+            terminate_process(pid);
+            throw std::runtime_error(
+                fmt::format("Failed to poll the child process with error {}.{}",
+                    error_number, command_output));
+        }
+        if (has_output && poll_targets[0].revents != 0) {
+            read_process_output(read_end, command_output);
+        }
+        const bool process_signaled = process_descriptor.is_valid() &&
+            poll_targets[process_target_index].revents != 0;
+        const bool output_closed = has_output && !read_end.is_valid();
+        if (process_signaled || output_closed) {
+            if (try_wait_process(pid, status, command_output)) {
+                if (read_end.is_valid()) {
+                    // Processes started by the child process may still hold
+                    // the pipe, so read only the remaining output.
+                    read_process_output(read_end, command_output);
+                }
+                return status;
+            }
+        }
+    }
+}
+
+}  // namespace
+
+/*!
+ * \brief Execute a command.
+ *
+ * \param[in] command Command.
+ * \param[in] capture_logs Whether to capture logs.
+ * \return Whether the command started, exit status and output of the command.
+ */
+[[nodiscard]] inline std::tuple<bool, int, std::string> execute_command_impl(
+    const std::vector<std::string>& command, bool capture_logs) {
+    std::vector<std::string> command_copy = command;
+    std::vector<char*> argv;
+    argv.reserve(command.size() + 1);
+    for (auto& arg : command_copy) {
+        argv.push_back(arg.data());
+    }
+    argv.push_back(nullptr);
+
+    file_descriptor read_end;
+    file_descriptor write_end;
+    if (capture_logs) {
+        create_pipe(read_end, write_end);
+    }
+
+    pid_t pid = -1;
+    switch (get_process_launcher()) {
+    case process_launcher::fork:
+        pid = start_process_with_fork(argv, write_end.get());
+        break;
+    case process_launcher::posix_spawn:
+    default:
+        pid = start_process_with_posix_spawn(argv, write_end.get());
+        break;
+    }
+    write_end.close();
+    if (pid == -1) {
+        return {false, 0, ""};
+    }
+    metrics::metrics_registry::get_instance().add(
+        metrics::counter_type::subprocesses_spawned);
+
+    std::string command_output;
+    if (capture_logs) {
+        command_output = command_output_header;
+    }
 
-    return {status, command_output};
+    PLOTLY_PLOTTER_TRACE_SPAN("wait_for_process", "subprocess");
+    const int status = wait_for_process(
+        pid, read_end, get_subprocess_timeout(), command_output);
+
+    return {true, status, command_output};
 }
 
 bool check_command_success(
@@ -158,10 +492,28 @@ bool check_command_success(
         throw std::invalid_argument("Command is empty.");
     }
 
-    const auto [status, command_output] =
+    PLOTLY_PLOTTER_TRACE_SPAN("execute_command", "subprocess");
+    const auto [started, status, command_output] =
+        execute_command_impl(command, capture_logs);
+
+    return started && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+std::optional<std::string> capture_command_output(
+    const std::vector<std::string>& command) {
+    if (command.empty()) {
+        throw std::invalid_argument("Command is empty.");
+    }
+
+    PLOTLY_PLOTTER_TRACE_SPAN("execute_command", "subprocess");
+    constexpr bool capture_logs = true;
+    const auto [started, status, command_output] =
         execute_command_impl(command, capture_logs);
 
-    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    if (!started || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        return std::nullopt;
+    }
+    return command_output.substr(command_output_header.size());
 }
 
 void execute_command(
@@ -170,9 +522,15 @@ void execute_command(
         throw std::invalid_argument("Command is empty.");
     }
 
-    const auto [status, command_output] =
+    PLOTLY_PLOTTER_TRACE_SPAN("execute_command", "subprocess");
+    const auto [started, status, command_output] =
         execute_command_impl(command, capture_logs);
 
+    if (!started) {
+        throw std::runtime_error(
+            fmt::format("Failed to start the command {}.", command.front()));
+    }
+
     if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
         if (WIFSIGNALED(status)) {
             throw std::runtime_error(
@@ -197,11 +555,15 @@ void execute_command(
 #include <processthreadsapi.h>
 // clang-format on
 
+#include <algorithm>
+#include <chrono>
 #include <thread>
 #include <tuple>
 
 #include <fmt/format.h>
 
+#include "plotly_plotter/io/subprocess_settings.h"
+
 namespace plotly_plotter::io::details {
 
 /*!
@@ -287,6 +649,8 @@ void close_handle_if_not_null(HANDLE handle) noexcept {
         const DWORD error_code = GetLastError();
         return {false, error_code, ""};
     }
+    metrics::metrics_registry::get_instance().add(
+        metrics::counter_type::subprocesses_spawned);
 
     // Close unused handles.
     close_handle_if_not_null(stdin_pipe_read);
@@ -298,9 +662,7 @@ void close_handle_if_not_null(HANDLE handle) noexcept {
     if (capture_logs) {
         command_output_reader_thread =
             std::thread([stdout_pipe_read, &command_output] {
-                command_output =
-                    "\n"
-                    "Output from a process:\n";
+                command_output = command_output_header;
 
                 constexpr std::size_t buffer_size = 1024;
                 char buffer[buffer_size]{};
@@ -323,11 +685,17 @@ void close_handle_if_not_null(HANDLE handle) noexcept {
             });
     }
 
-    constexpr DWORD wait_timeout_msec = 60000;  // 1 minute
+    // INFINITE means no timeout, so longer timeouts are clamped below it.
+    constexpr auto max_wait_timeout_msec =
+        static_cast<std::chrono::milliseconds::rep>(INFINITE - 1);
+    const auto wait_timeout_msec = static_cast<DWORD>(
+        (std::min)(get_subprocess_timeout().count(), max_wait_timeout_msec));
     const DWORD wait_result =
         WaitForSingleObject(process_info.hProcess, wait_timeout_msec);
     if (wait_result == WAIT_TIMEOUT) {
         TerminateProcess(process_info.hProcess, 1);
+        metrics::metrics_registry::get_instance().add(
+            metrics::counter_type::conversion_timeouts);
         if (command_output_reader_thread.joinable()) {
             command_output_reader_thread.join();
         }
@@ -370,17 +738,34 @@ bool check_command_success(
     if (command.empty()) {
         throw std::invalid_argument("Command is empty.");
     }
+    PLOTLY_PLOTTER_TRACE_SPAN("execute_command", "subprocess");
     const auto [started, exit_code, command_output] =
         execute_command_impl(command, capture_logs);
     return started && exit_code == 0;
 }
 
+std::optional<std::string> capture_command_output(
+    const std::vector<std::string>& command) {
+    if (command.empty()) {
+        throw std::invalid_argument("Command is empty.");
+    }
+    PLOTLY_PLOTTER_TRACE_SPAN("execute_command", "subprocess");
+    constexpr bool capture_logs = true;
+    const auto [started, exit_code, command_output] =
+        execute_command_impl(command, capture_logs);
+    if (!started || exit_code != 0) {
+        return std::nullopt;
+    }
+    return command_output.substr(command_output_header.size());
+}
+
 void execute_command(
     const std::vector<std::string>& command, bool capture_logs) {
     if (command.empty()) {
         throw std::invalid_argument("Command is empty.");
     }
 
+    PLOTLY_PLOTTER_TRACE_SPAN("execute_command", "subprocess");
     const auto [started, exit_code, command_output] =
         execute_command_impl(command, capture_logs);
 
@@ -410,6 +795,12 @@ bool check_command_success(
     return false;
 }
 
+std::optional<std::string> capture_command_output(
+    const std::vector<std::string>& command) {
+    (void)command;
+    return std::nullopt;
+}
+
 void execute_command(
     const std::vector<std::string>& command, bool capture_logs) {
     (void)command;
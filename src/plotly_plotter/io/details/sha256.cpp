@@ -0,0 +1,169 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of sha256_hasher class.
+ */
+#include "plotly_plotter/io/details/sha256.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <fmt/format.h>
+
+namespace plotly_plotter::io::details {
+
+namespace {
+
+//! Round constants.
+constexpr std::array<std::uint32_t, 64> round_constants{0x428a2f98, 0x71374491,
+    0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe,
+    0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d,
+    0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb,
+    0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116, 0x1e376c08,
+    0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb,
+    0xbef9a3f7, 0xc67178f2};
+
+//! Initial state.
+constexpr std::array<std::uint32_t, 8> initial_state{0x6a09e667, 0xbb67ae85,
+    0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+
+/*!
+ * \brief Rotate bits to the right.
+ *
+ * \param[in] value Value.
+ * \param[in] shift Number of bits.
+ * \return Rotated value.
+ */
+[[nodiscard]] constexpr std::uint32_t rotate_right(
+    std::uint32_t value, unsigned int shift) noexcept {
+    constexpr unsigned int num_bits = 32;
+    return (value >> shift) | (value << (num_bits - shift));
+}
+
+}  // namespace
+
+sha256_hasher::sha256_hasher() noexcept : state_(initial_state) {}
+
+void sha256_hasher::add(std::string_view data) noexcept {
+    total_size_ += data.size();
+    for (const char c : data) {
+        block_[block_used_] = static_cast<std::uint8_t>(c);
+        ++block_used_;
+        if (block_used_ == block_size) {
+            process_block();
+            block_used_ = 0;
+        }
+    }
+}
+
+std::string sha256_hasher::finish() {
+    // NOLINTBEGIN(*-magic-numbers)
+    const std::uint64_t total_bits = total_size_ * 8U;
+    block_[block_used_] = 0x80;
+    ++block_used_;
+    if (block_used_ > block_size - 8) {
+        while (block_used_ < block_size) {
+            block_[block_used_] = 0;
+            ++block_used_;
+        }
+        process_block();
+        block_used_ = 0;
+    }
+    while (block_used_ < block_size - 8) {
+        block_[block_used_] = 0;
+        ++block_used_;
+    }
+    for (std::size_t i = 0; i < 8; ++i) {
+        block_[block_size - 1 - i] =
+            static_cast<std::uint8_t>(total_bits >> (8U * i));
+    }
+    process_block();
+    block_used_ = 0;
+
+    std::string result;
+    result.reserve(64);
+    for (const std::uint32_t word : state_) {
+        result += fmt::format("{:08x}", word);
+    }
+    return result;
+    // NOLINTEND(*-magic-numbers)
+}
+
+void sha256_hasher::process_block() noexcept {
+    // NOLINTBEGIN(*-magic-numbers)
+    std::array<std::uint32_t, 64> words{};
+    for (std::size_t i = 0; i < 16; ++i) {
+        words[i] = (static_cast<std::uint32_t>(block_[4 * i]) << 24U) |
+            (static_cast<std::uint32_t>(block_[4 * i + 1]) << 16U) |
+            (static_cast<std::uint32_t>(block_[4 * i + 2]) << 8U) |
+            static_cast<std::uint32_t>(block_[4 * i + 3]);
+    }
+    for (std::size_t i = 16; i < 64; ++i) {
+        const std::uint32_t s0 = rotate_right(words[i - 15], 7) ^
+            rotate_right(words[i - 15], 18) ^ (words[i - 15] >> 3U);
+        const std::uint32_t s1 = rotate_right(words[i - 2], 17) ^
+            rotate_right(words[i - 2], 19) ^ (words[i - 2] >> 10U);
+        words[i] = words[i - 16] + s0 + words[i - 7] + s1;
+    }
+
+    std::uint32_t a = state_[0];
+    std::uint32_t b = state_[1];
+    std::uint32_t c = state_[2];
+    std::uint32_t d = state_[3];
+    std::uint32_t e = state_[4];
+    std::uint32_t f = state_[5];
+    std::uint32_t g = state_[6];
+    std::uint32_t h = state_[7];
+    for (std::size_t i = 0; i < 64; ++i) {
+        const std::uint32_t s1 =
+            rotate_right(e, 6) ^ rotate_right(e, 11) ^ rotate_right(e, 25);
+        const std::uint32_t choice = (e & f) ^ (~e & g);
+        const std::uint32_t temp1 =
+            h + s1 + choice + round_constants[i] + words[i];
+        const std::uint32_t s0 =
+            rotate_right(a, 2) ^ rotate_right(a, 13) ^ rotate_right(a, 22);
+        const std::uint32_t majority = (a & b) ^ (a & c) ^ (b & c);
+        const std::uint32_t temp2 = s0 + majority;
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + temp2;
+    }
+    state_[0] += a;
+    state_[1] += b;
+    state_[2] += c;
+    state_[3] += d;
+    state_[4] += e;
+    state_[5] += f;
+    state_[6] += g;
+    state_[7] += h;
+    // NOLINTEND(*-magic-numbers)
+}
+
+}  // namespace plotly_plotter::io::details
@@ -0,0 +1,150 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of export_executor class.
+ */
+#include "plotly_plotter/io/export_executor.h"
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+namespace plotly_plotter::io {
+
+export_executor& export_executor::get_instance() {
+    static export_executor instance(
+        default_num_threads(), default_queue_capacity());
+    return instance;
+}
+
+std::size_t export_executor::default_num_threads() noexcept {
+    // Browsers used in conversions use multiple threads internally,
+    // so a half of the hardware threads are used.
+    constexpr std::size_t divisor = 2;
+    return std::max<std::size_t>(
+        1, static_cast<std::size_t>(std::thread::hardware_concurrency()) /
+            divisor);
+}
+
+std::size_t export_executor::default_queue_capacity() noexcept {
+    constexpr std::size_t jobs_per_thread = 4;
+    return default_num_threads() * jobs_per_thread;
+}
+
+export_executor::export_executor(
+    std::size_t num_threads, std::size_t queue_capacity)
+    : queue_capacity_(queue_capacity) {
+    if (num_threads == 0) {
+        throw std::invalid_argument("Number of threads must be positive.");
+    }
+    if (queue_capacity == 0) {
+        throw std::invalid_argument("Capacity of the queue must be positive.");
+    }
+    workers_.reserve(num_threads);
+    for (std::size_t i = 0; i < num_threads; ++i) {
+        workers_.emplace_back([this] { run_worker(); });
+    }
+}
+
+export_executor::~export_executor() {
+    (void)cancel_pending();
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        is_stopped_ = true;
+    }
+    job_added_.notify_all();
+    job_removed_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+std::future<void> export_executor::submit(job_function function) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    job_removed_.wait(lock,
+        [this] { return is_stopped_ || queue_.size() < queue_capacity_; });
+    if (is_stopped_) {
+        throw std::runtime_error("Executor is stopped.");
+    }
+    return enqueue(std::move(function), lock);
+}
+
+std::optional<std::future<void>> export_executor::try_submit(
+    job_function function) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (is_stopped_ || queue_.size() >= queue_capacity_) {
+        return std::nullopt;
+    }
+    return enqueue(std::move(function), lock);
+}
+
+std::size_t export_executor::cancel_pending() {
+    std::deque<job> cancelled_jobs;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cancelled_jobs.swap(queue_);
+    }
+    job_removed_.notify_all();
+    for (auto& cancelled_job : cancelled_jobs) {
+        cancelled_job.promise.set_exception(std::make_exception_ptr(
+            std::runtime_error("Export job was cancelled.")));
+    }
+    return cancelled_jobs.size();
+}
+
+std::size_t export_executor::num_pending_jobs() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return queue_.size();
+}
+
+std::future<void> export_executor::enqueue(
+    job_function function, std::unique_lock<std::mutex>& lock) {
+    job new_job{std::move(function), std::promise<void>()};
+    auto future = new_job.promise.get_future();
+    queue_.push_back(std::move(new_job));
+    lock.unlock();
+    job_added_.notify_one();
+    return future;
+}
+
+void export_executor::run_worker() {
+    while (true) {
+        job current_job;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            job_added_.wait(
+                lock, [this] { return is_stopped_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                // Stopped.
+                return;
+            }
+            current_job = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        job_removed_.notify_one();
+
+        try {
+            current_job.function();
+            current_job.promise.set_value();
+        } catch (...) {
+            current_job.promise.set_exception(std::current_exception());
+        }
+    }
+}
+
+}  // namespace plotly_plotter::io
@@ -0,0 +1,183 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of classes of output sinks.
+ */
+#include "plotly_plotter/io/output_sink.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <climits>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include "plotly_plotter/metrics/metrics_registry.h"
+
+namespace plotly_plotter::io {
+
+void output_sink::write_parts(
+    const std::string_view* parts, std::size_t num_parts) {
+    for (std::size_t i = 0; i < num_parts; ++i) {
+        write(parts[i]);
+    }
+}
+
+output_sink::~output_sink() = default;
+
+string_output_sink::string_output_sink(std::string& buffer) noexcept
+    : buffer_(&buffer) {}
+
+void string_output_sink::write(std::string_view data) {
+    buffer_->append(data);
+}
+
+void string_output_sink::write_parts(
+    const std::string_view* parts, std::size_t num_parts) {
+    std::size_t total_size = buffer_->size();
+    for (std::size_t i = 0; i < num_parts; ++i) {
+        total_size += parts[i].size();
+    }
+    buffer_->reserve(total_size);
+    for (std::size_t i = 0; i < num_parts; ++i) {
+        buffer_->append(parts[i]);
+    }
+}
+
+ostream_output_sink::ostream_output_sink(std::ostream& stream) noexcept
+    : stream_(&stream) {}
+
+void ostream_output_sink::write(std::string_view data) {
+    stream_->write(data.data(), static_cast<std::streamsize>(data.size()));
+    if (!*stream_) {
+        throw std::runtime_error("Failed to write to stream.");
+    }
+}
+
+callback_output_sink::callback_output_sink(callback_type callback)
+    : callback_(std::move(callback)) {}
+
+void callback_output_sink::write(std::string_view data) { callback_(data); }
+
+fd_output_sink::fd_output_sink(int fd) noexcept : fd_(fd) {}
+
+void fd_output_sink::write(std::string_view data) { write_parts(&data, 1); }
+
+#ifdef _WIN32
+
+void fd_output_sink::write_parts(
+    const std::string_view* parts, std::size_t num_parts) {
+    for (std::size_t i = 0; i < num_parts; ++i) {
+        std::string_view remaining = parts[i];
+        while (!remaining.empty()) {
+            constexpr std::size_t max_size = 1U << 30U;
+            const int written = ::_write(fd_, remaining.data(),
+                static_cast<unsigned int>(
+                    std::min(remaining.size(), max_size)));
+            if (written < 0) {
+                throw std::runtime_error("Failed to write to file descriptor.");
+            }
+            metrics::metrics_registry::get_instance().add(
+                metrics::counter_type::bytes_written,
+                static_cast<std::uint64_t>(written));
+            remaining.remove_prefix(static_cast<std::size_t>(written));
+        }
+    }
+}
+
+#else
+
+void fd_output_sink::write_parts(
+    const std::string_view* parts, std::size_t num_parts) {
+#ifdef IOV_MAX
+    constexpr std::size_t max_vectors = IOV_MAX;
+#else
+    constexpr std::size_t max_vectors = 16;
+#endif
+
+    std::vector<iovec> vectors;
+    vectors.reserve(std::min(num_parts, max_vectors));
+    std::size_t next_part = 0;
+    std::size_t offset_in_part = 0;
+    while (next_part < num_parts) {
+        // Prepare vectors of remaining strings.
+        vectors.clear();
+        for (std::size_t i = next_part;
+             i < num_parts && vectors.size() < max_vectors; ++i) {
+            const std::size_t offset = (i == next_part) ? offset_in_part : 0;
+            if (parts[i].size() == offset) {
+                continue;
+            }
+            vectors.push_back(iovec{
+                // NOLINTNEXTLINE(*-const-cast): Required by writev.
+                const_cast<char*>(parts[i].data() + offset),
+                parts[i].size() - offset});
+        }
+        if (vectors.empty()) {
+            break;
+        }
+
+        const ssize_t written = ::writev(
+            fd_, vectors.data(), static_cast<int>(vectors.size()));
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::runtime_error("Failed to write to file descriptor.");
+        }
+
+        metrics::metrics_registry::get_instance().add(
+            metrics::counter_type::bytes_written,
+            static_cast<std::uint64_t>(written));
+
+        // Skip written strings.
+        auto remaining_written = static_cast<std::size_t>(written);
+        while (next_part < num_parts) {
+            const std::size_t remaining_in_part =
+                parts[next_part].size() - offset_in_part;
+            if (remaining_written < remaining_in_part) {
+                offset_in_part += remaining_written;
+                break;
+            }
+            remaining_written -= remaining_in_part;
+            ++next_part;
+            offset_in_part = 0;
+        }
+    }
+}
+
+#endif
+
+file_output_sink::file_output_sink(const std::string& file_path)
+    : file_(file_path, "w") {}
+
+void file_output_sink::write(std::string_view data) {
+    file_.write(data);
+    metrics::metrics_registry::get_instance().add(
+        metrics::counter_type::bytes_written, data.size());
+}
+
+}  // namespace plotly_plotter::io
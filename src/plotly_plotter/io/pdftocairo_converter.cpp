@@ -28,7 +28,10 @@
 #include <fmt/format.h>
 
 #include "plotly_plotter/details/config.h"
+#include "plotly_plotter/io/details/executable_version_cache.h"
 #include "plotly_plotter/io/details/execute_command.h"
+#include "plotly_plotter/metrics/metrics_registry.h"
+#include "plotly_plotter/tracing/tracer.h"
 
 namespace plotly_plotter::io {
 
@@ -52,6 +55,24 @@ namespace {
 #endif
 }
 
+/*!
+ * \brief Get the version of a pdftocairo executable.
+ *
+ * \param[in] executable_path Path of the pdftocairo executable.
+ * \return Version, or an empty string if not available.
+ */
+[[nodiscard]] std::string get_pdftocairo_version(
+    const std::string& executable_path) {
+#if PLOTLY_PLOTTER_USE_WIN_SUBPROCESS
+    // Currently not supported.
+    (void)executable_path;
+    return std::string();
+#else
+    const std::vector<std::string> command{executable_path, "-v"};
+    return details::capture_command_output(command).value_or(std::string());
+#endif
+}
+
 }  // namespace
 
 pdftocairo_converter& pdftocairo_converter::get_instance() {
@@ -60,11 +81,16 @@ pdftocairo_converter& pdftocairo_converter::get_instance() {
 }
 
 bool pdftocairo_converter::is_pdf_to_svg_conversion_supported() {
-    return check_pdftocairo_executable(get_pdftocairo_path());
+    return check_cache_.check(
+        get_pdftocairo_path(), check_pdftocairo_executable);
 }
 
 void pdftocairo_converter::convert_pdf_to_svg(
     const char* pdf_file_path, const char* svg_file_path) {
+    PLOTLY_PLOTTER_TRACE_SPAN(
+        "pdftocairo_converter::convert_pdf_to_svg", "converter");
+    const metrics::scoped_conversion_measurement measurement(
+        metrics::converter_type::pdftocairo);
     std::vector<std::string> command{
         get_pdftocairo_path(), pdf_file_path, "-svg", svg_file_path};
     details::execute_command(command);
@@ -75,9 +101,16 @@ std::string pdftocairo_converter::get_pdftocairo_path() {
     return pdftocairo_path_;
 }
 
+std::string pdftocairo_converter::get_version() {
+    return version_cache_.get(get_pdftocairo_path(), get_pdftocairo_version);
+}
+
 void pdftocairo_converter::set_pdftocairo_path(const std::string& path) {
-    std::unique_lock<std::mutex> lock(mutex_);
-    pdftocairo_path_ = path;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        pdftocairo_path_ = path;
+    }
+    check_cache_.clear();
 }
 
 pdftocairo_converter::~pdftocairo_converter() = default;
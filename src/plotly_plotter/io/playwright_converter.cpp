@@ -31,7 +31,11 @@
 #include "plotly_plotter/details/file_handle.h"
 #include "plotly_plotter/details/templates/generate_pdf_with_playwright.h"
 #include "plotly_plotter/details/templates/generate_png_with_playwright.h"
+#include "plotly_plotter/io/details/executable_check_cache.h"
+#include "plotly_plotter/io/details/executable_version_cache.h"
 #include "plotly_plotter/io/details/execute_command.h"
+#include "plotly_plotter/metrics/metrics_registry.h"
+#include "plotly_plotter/tracing/tracer.h"
 
 namespace plotly_plotter::io {
 
@@ -50,15 +54,30 @@ namespace {
     return details::check_command_success(command);
 }
 
+/*!
+ * \brief Get the version of Playwright.
+ *
+ * \param[in] executable_path Path of the Python executable.
+ * \return Version, or an empty string if not available.
+ */
+[[nodiscard]] std::string get_playwright_version(
+    const std::string& executable_path) {
+    const std::vector<std::string> command{
+        executable_path, "-m", "playwright", "--version"};
+    return details::capture_command_output(command).value_or(std::string());
+}
+
 /*!
  * \brief Find the path of the Python executable with Playwright.
  *
+ * \param[in,out] check_cache Cache of results of checks.
  * \return Path of the Python executable with Playwright.
  */
-[[nodiscard]] std::string find_python_path() {
+[[nodiscard]] std::string find_python_path(
+    details::executable_check_cache& check_cache) {
     const std::vector<std::string> possible_paths{"python3", "python"};
     for (const auto& path : possible_paths) {
-        if (check_python_executable(path)) {
+        if (check_cache.check(path, check_python_executable)) {
             return path;
         }
     }
@@ -73,11 +92,15 @@ playwright_converter& playwright_converter::get_instance() {
 }
 
 bool playwright_converter::is_html_to_pdf_conversion_supported() {
-    return check_python_executable(get_python_path());
+    return check_cache_.check(get_python_path(), check_python_executable);
 }
 
 void playwright_converter::convert_html_to_pdf(const char* html_file_path,
     const char* pdf_file_path, std::size_t width, std::size_t height) {
+    PLOTLY_PLOTTER_TRACE_SPAN(
+        "playwright_converter::convert_html_to_pdf", "converter");
+    const metrics::scoped_conversion_measurement measurement(
+        metrics::converter_type::playwright);
     const std::string temp_python_script_path =
         fmt::format("{}.py", pdf_file_path);
     plotly_plotter::details::file_handle temp_python_script_file(
@@ -95,11 +118,15 @@ void playwright_converter::convert_html_to_pdf(const char* html_file_path,
 }
 
 bool playwright_converter::is_html_to_png_conversion_supported() {
-    return check_python_executable(get_python_path());
+    return check_cache_.check(get_python_path(), check_python_executable);
 }
 
 void playwright_converter::convert_html_to_png(const char* html_file_path,
     const char* png_file_path, std::size_t width, std::size_t height) {
+    PLOTLY_PLOTTER_TRACE_SPAN(
+        "playwright_converter::convert_html_to_png", "converter");
+    const metrics::scoped_conversion_measurement measurement(
+        metrics::converter_type::playwright);
     const std::string temp_python_script_path =
         fmt::format("{}.py", png_file_path);
     plotly_plotter::details::file_handle temp_python_script_file(
@@ -121,14 +148,21 @@ std::string playwright_converter::get_python_path() {
     return python_path_;
 }
 
+std::string playwright_converter::get_version() {
+    return version_cache_.get(get_python_path(), get_playwright_version);
+}
+
 void playwright_converter::set_python_path(std::string path) {
-    std::unique_lock<std::mutex> lock(mutex_);
-    python_path_ = std::move(path);
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        python_path_ = std::move(path);
+    }
+    check_cache_.clear();
 }
 
 playwright_converter::~playwright_converter() = default;
 
 playwright_converter::playwright_converter()
-    : python_path_(find_python_path()) {}
+    : python_path_(find_python_path(check_cache_)) {}
 
 }  // namespace plotly_plotter::io
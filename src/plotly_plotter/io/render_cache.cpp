@@ -0,0 +1,307 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of render_cache class.
+ */
+#include "plotly_plotter/io/render_cache.h"
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "plotly_plotter/details/write_html_impl.h"
+#include "plotly_plotter/io/details/sha256.h"
+#include "plotly_plotter/version.h"
+
+namespace plotly_plotter::io {
+
+namespace {
+
+/*!
+ * \brief Add a string to a hash with its size.
+ *
+ * \param[in,out] hasher Hasher.
+ * \param[in] data String.
+ *
+ * \note Sizes are added to distinguish boundaries of strings.
+ */
+void add_with_size(details::sha256_hasher& hasher, std::string_view data) {
+    hasher.add(fmt::format("{}:", data.size()));
+    hasher.add(data);
+}
+
+//! Number of characters in stems of names of cached files.
+constexpr std::size_t entry_stem_length = 64;
+
+/*!
+ * \brief Check whether a path is a cached file.
+ *
+ * \param[in] path Path.
+ * \retval true The path is a cached file.
+ * \retval false The path is not a cached file.
+ */
+[[nodiscard]] bool is_entry(const std::filesystem::path& path) {
+    const std::string stem = path.stem().string();
+    const std::string extension = path.extension().string();
+    return stem.size() == entry_stem_length &&
+        std::all_of(stem.begin(), stem.end(),
+            [](char c) {
+                return ('0' <= c && c <= '9') || ('a' <= c && c <= 'f');
+            }) &&
+        (extension == ".pdf" || extension == ".png" || extension == ".svg");
+}
+
+}  // namespace
+
+render_cache& render_cache::get_instance() {
+    static render_cache instance;
+    return instance;
+}
+
+void render_cache::enable(
+    const std::string& directory, std::uintmax_t max_size) {
+    std::filesystem::create_directories(directory);
+    std::unique_lock<std::mutex> lock(mutex_);
+    is_enabled_ = true;
+    directory_ = directory;
+    max_size_ = max_size;
+}
+
+void render_cache::disable() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    is_enabled_ = false;
+}
+
+bool render_cache::is_enabled() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return is_enabled_;
+}
+
+void render_cache::set_use_hard_links(bool use_hard_links) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    use_hard_links_ = use_hard_links;
+}
+
+std::uint64_t render_cache::num_hits() const noexcept {
+    return num_hits_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t render_cache::num_misses() const noexcept {
+    return num_misses_.load(std::memory_order_relaxed);
+}
+
+void render_cache::reset_counters() noexcept {
+    num_hits_.store(0, std::memory_order_relaxed);
+    num_misses_.store(0, std::memory_order_relaxed);
+}
+
+void render_cache::clear() {
+    std::filesystem::path directory;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        directory = directory_;
+    }
+    if (directory.empty()) {
+        return;
+    }
+    evict(directory, 0);
+}
+
+std::string render_cache::create_entry_name(std::string_view extension,
+    std::string_view html_title, const json_document& data, std::size_t width,
+    std::size_t height, std::string_view converter) {
+    return create_entry_name(extension, html_title,
+        plotly_plotter::details::serialize_for_html(data), width, height,
+        converter);
+}
+
+std::string render_cache::create_entry_name(std::string_view extension,
+    std::string_view html_title, std::string_view escaped_data,
+    std::size_t width, std::size_t height, std::string_view converter) {
+    details::sha256_hasher hasher;
+    add_with_size(hasher,
+        fmt::format("{}.{}.{}", PLOTLY_PLOTTER_VERSION_MAJOR,
+            PLOTLY_PLOTTER_VERSION_MINOR, PLOTLY_PLOTTER_VERSION_PATCH));
+    add_with_size(hasher, extension);
+    add_with_size(hasher, fmt::format("{}x{}", width, height));
+    add_with_size(hasher, converter);
+    add_with_size(hasher, html_title);
+    add_with_size(hasher, escaped_data);
+    return fmt::format("{}.{}", hasher.finish(), extension);
+}
+
+void render_cache::render(const char* file_path,
+    const std::function<std::string()>& entry_name_creator,
+    const std::function<void()>& renderer) {
+    std::filesystem::path directory;
+    std::uintmax_t max_size = 0;
+    bool use_hard_links = false;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!is_enabled_) {
+            lock.unlock();
+            renderer();
+            return;
+        }
+        directory = directory_;
+        max_size = max_size_;
+        use_hard_links = use_hard_links_;
+    }
+
+    const std::string entry_name = entry_name_creator();
+    if (restore(directory, entry_name, use_hard_links, file_path)) {
+        num_hits_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    num_misses_.fetch_add(1, std::memory_order_relaxed);
+
+    if (use_hard_links) {
+        // Output file may be a hard link to a cached file,
+        // which must not be overwritten.
+        std::error_code error;
+        std::filesystem::remove(file_path, error);
+    }
+    renderer();
+    store(directory, entry_name, max_size, file_path);
+}
+
+render_cache::render_cache()
+    : temporary_file_token_(
+          (static_cast<std::uint64_t>(std::random_device()()) << 32U) |
+          static_cast<std::uint64_t>(std::random_device()())) {}
+
+render_cache::~render_cache() = default;
+
+bool render_cache::restore(const std::filesystem::path& directory,
+    const std::string& entry_name, bool use_hard_links,
+    const char* file_path) {
+    const std::filesystem::path entry_path = directory / entry_name;
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(entry_path, error)) {
+        return false;
+    }
+
+    // Update the time of the last use.
+    std::filesystem::last_write_time(entry_path,
+        std::filesystem::file_time_type::clock::now(), error);
+
+    std::filesystem::remove(file_path, error);
+    if (use_hard_links) {
+        std::filesystem::create_hard_link(entry_path, file_path, error);
+        if (!error) {
+            return true;
+        }
+    }
+    // The cached file can be removed by other processes at any time,
+    // so errors are treated as misses.
+    return std::filesystem::copy_file(entry_path, file_path,
+               std::filesystem::copy_options::overwrite_existing, error) &&
+        !error;
+}
+
+void render_cache::store(const std::filesystem::path& directory,
+    const std::string& entry_name, std::uintmax_t max_size,
+    const char* file_path) {
+    // Files are copied to temporary files first,
+    // so that other threads and processes never read incomplete files.
+    const std::filesystem::path temporary_path = directory /
+        fmt::format("{}.{:016x}.{}.tmp", entry_name, temporary_file_token_,
+            num_temporary_files_.fetch_add(1, std::memory_order_relaxed));
+    std::error_code error;
+    std::filesystem::copy_file(file_path, temporary_path,
+        std::filesystem::copy_options::overwrite_existing, error);
+    if (!error) {
+        std::filesystem::rename(temporary_path, directory / entry_name, error);
+    }
+    if (error) {
+        // Failures of caches must not cause failures of outputs.
+        std::filesystem::remove(temporary_path, error);
+        return;
+    }
+
+    const std::uintmax_t stored_size =
+        std::filesystem::file_size(directory / entry_name, error);
+    std::unique_lock<std::mutex> lock(files_mutex_);
+    if (error || directory != size_directory_) {
+        evict_locked(directory, max_size);
+        return;
+    }
+    // The directory is scanned only when the total size estimated from
+    // stored files exceeds the maximum size, because scanning the directory
+    // after every miss is slow for large caches.
+    total_size_ += stored_size;
+    if (total_size_ > max_size) {
+        evict_locked(directory, max_size);
+    }
+}
+
+void render_cache::evict(
+    const std::filesystem::path& directory, std::uintmax_t max_size) {
+    std::unique_lock<std::mutex> lock(files_mutex_);
+    evict_locked(directory, max_size);
+}
+
+void render_cache::evict_locked(
+    const std::filesystem::path& directory, std::uintmax_t max_size) {
+    struct entry {
+        std::filesystem::path path;
+        std::uintmax_t size;
+        std::filesystem::file_time_type last_use;
+    };
+    std::vector<entry> entries;
+    std::uintmax_t total_size = 0;
+    std::error_code error;
+    for (std::filesystem::directory_iterator iter(directory, error), end;
+         !error && iter != end; iter.increment(error)) {
+        std::error_code entry_error;
+        if (!iter->is_regular_file(entry_error) || !is_entry(iter->path())) {
+            continue;
+        }
+        const std::uintmax_t size = iter->file_size(entry_error);
+        const auto last_use = iter->last_write_time(entry_error);
+        if (entry_error) {
+            continue;
+        }
+        entries.push_back(entry{iter->path(), size, last_use});
+        total_size += size;
+    }
+    size_directory_ = directory;
+    total_size_ = total_size;
+    if (total_size <= max_size) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(),
+        [](const entry& left, const entry& right) {
+            return left.last_use < right.last_use;
+        });
+    for (const auto& removed : entries) {
+        if (total_size <= max_size) {
+            break;
+        }
+        std::filesystem::remove(removed.path, error);
+        total_size -= removed.size;
+    }
+    total_size_ = total_size;
+}
+
+}  // namespace plotly_plotter::io
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of functions to configure subprocesses.
+ */
+#include "plotly_plotter/io/subprocess_settings.h"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+
+#include "plotly_plotter/details/config.h"
+
+namespace plotly_plotter::io {
+
+namespace {
+
+#if PLOTLY_PLOTTER_USE_WIN_SUBPROCESS
+//! Default timeout of subprocesses in milliseconds.
+constexpr std::chrono::milliseconds::rep default_subprocess_timeout_msec =
+    60000;
+#else
+//! Default timeout of subprocesses in milliseconds.
+constexpr std::chrono::milliseconds::rep default_subprocess_timeout_msec =
+    10000;
+#endif
+
+//! Method to launch subprocesses.
+std::atomic<process_launcher> current_process_launcher{
+    process_launcher::posix_spawn};
+
+//! Timeout of subprocesses in milliseconds.
+std::atomic<std::chrono::milliseconds::rep> current_subprocess_timeout_msec{
+    default_subprocess_timeout_msec};
+
+}  // namespace
+
+process_launcher get_process_launcher() noexcept {
+    return current_process_launcher.load(std::memory_order_relaxed);
+}
+
+void set_process_launcher(process_launcher value) noexcept {
+    current_process_launcher.store(value, std::memory_order_relaxed);
+}
+
+std::chrono::milliseconds get_subprocess_timeout() noexcept {
+    return std::chrono::milliseconds(
+        current_subprocess_timeout_msec.load(std::memory_order_relaxed));
+}
+
+void set_subprocess_timeout(std::chrono::milliseconds value) {
+    if (value.count() <= 0) {
+        throw std::invalid_argument("Timeout must be a positive value.");
+    }
+    current_subprocess_timeout_msec.store(
+        value.count(), std::memory_order_relaxed);
+}
+
+}  // namespace plotly_plotter::io
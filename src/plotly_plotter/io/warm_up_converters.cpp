@@ -0,0 +1,50 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of functions to warm up converters.
+ */
+#include "plotly_plotter/io/warm_up_converters.h"
+
+#include <future>
+
+#include "plotly_plotter/io/chrome_converter.h"
+#include "plotly_plotter/io/pdftocairo_converter.h"
+#include "plotly_plotter/io/playwright_converter.h"
+
+namespace plotly_plotter::io {
+
+void warm_up_converters() {
+    // Checks run subprocesses, so run them in parallel.
+    auto playwright_check = std::async(std::launch::async, [] {
+        (void)playwright_converter::get_instance()
+            .is_html_to_png_conversion_supported();
+    });
+    auto chrome_check = std::async(std::launch::async, [] {
+        (void)chrome_converter::get_instance()
+            .is_html_to_png_conversion_supported();
+    });
+    (void)pdftocairo_converter::get_instance()
+        .is_pdf_to_svg_conversion_supported();
+    playwright_check.get();
+    chrome_check.get();
+}
+
+std::future<void> warm_up_converters_async() {
+    return std::async(std::launch::async, warm_up_converters);
+}
+
+}  // namespace plotly_plotter::io
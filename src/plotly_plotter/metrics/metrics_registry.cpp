@@ -0,0 +1,147 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of metrics_registry class.
+ */
+#include "plotly_plotter/metrics/metrics_registry.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace plotly_plotter::metrics {
+
+namespace {
+
+//! Upper bounds of buckets in histograms of latencies in seconds.
+constexpr std::array<double, num_latency_buckets> latency_bucket_upper_bounds{
+    0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1.0, 2.5, 5.0,
+    10.0, 30.0, 60.0, std::numeric_limits<double>::infinity()};
+
+}  // namespace
+
+std::string_view counter_name(counter_type type) noexcept {
+    switch (type) {
+    case counter_type::figures_created:
+        return "figures_created";
+    case counter_type::traces_created:
+        return "traces_created";
+    case counter_type::json_nodes_serialized:
+        return "json_nodes_serialized";
+    case counter_type::json_bytes_serialized:
+        return "json_bytes_serialized";
+    case counter_type::bytes_written:
+        return "bytes_written";
+    case counter_type::subprocesses_spawned:
+        return "subprocesses_spawned";
+    case counter_type::conversion_failures:
+        return "conversion_failures";
+    case counter_type::conversion_timeouts:
+        return "conversion_timeouts";
+    default:
+        return "unknown";
+    }
+}
+
+std::string_view converter_name(converter_type type) noexcept {
+    switch (type) {
+    case converter_type::playwright:
+        return "playwright_converter";
+    case converter_type::chrome:
+        return "chrome_converter";
+    case converter_type::pdftocairo:
+        return "pdftocairo_converter";
+    default:
+        return "unknown";
+    }
+}
+
+double latency_bucket_upper_bound(std::size_t index) noexcept {
+    if (index >= num_latency_buckets) {
+        return std::numeric_limits<double>::infinity();
+    }
+    return latency_bucket_upper_bounds[index];
+}
+
+metrics_registry& metrics_registry::get_instance() {
+    static metrics_registry instance;
+    return instance;
+}
+
+void metrics_registry::enable() noexcept {
+    is_enabled_.store(true, std::memory_order_relaxed);
+}
+
+void metrics_registry::disable() noexcept {
+    is_enabled_.store(false, std::memory_order_relaxed);
+}
+
+void metrics_registry::record_conversion_latency(
+    converter_type type, std::chrono::nanoseconds latency) noexcept {
+    if (!is_enabled()) {
+        return;
+    }
+    const auto nanoseconds =
+        static_cast<std::uint64_t>(std::max<std::int64_t>(latency.count(), 0));
+    const double seconds = static_cast<double>(nanoseconds) * 1e-9;
+    std::size_t bucket = 0;
+    while (bucket + 1 < num_latency_buckets &&
+        seconds > latency_bucket_upper_bounds[bucket]) {
+        ++bucket;
+    }
+
+    auto& histogram = conversion_latencies_[static_cast<std::size_t>(type)];
+    histogram.bucket_counts[bucket].fetch_add(1, std::memory_order_relaxed);
+    histogram.count.fetch_add(1, std::memory_order_relaxed);
+    histogram.sum_nanoseconds.fetch_add(
+        nanoseconds, std::memory_order_relaxed);
+}
+
+metrics_snapshot metrics_registry::snapshot() const noexcept {
+    metrics_snapshot result;
+    for (std::size_t i = 0; i < num_counter_types; ++i) {
+        result.counters[i] = counters_[i].load(std::memory_order_relaxed);
+    }
+    for (std::size_t i = 0; i < num_converter_types; ++i) {
+        const auto& source = conversion_latencies_[i];
+        auto& destination = result.conversion_latencies[i];
+        for (std::size_t j = 0; j < num_latency_buckets; ++j) {
+            destination.bucket_counts[j] =
+                source.bucket_counts[j].load(std::memory_order_relaxed);
+        }
+        destination.count = source.count.load(std::memory_order_relaxed);
+        destination.sum_seconds =
+            static_cast<double>(
+                source.sum_nanoseconds.load(std::memory_order_relaxed)) *
+            1e-9;
+    }
+    return result;
+}
+
+void metrics_registry::reset() noexcept {
+    for (auto& counter : counters_) {
+        counter.store(0, std::memory_order_relaxed);
+    }
+    for (auto& histogram : conversion_latencies_) {
+        for (auto& bucket_count : histogram.bucket_counts) {
+            bucket_count.store(0, std::memory_order_relaxed);
+        }
+        histogram.count.store(0, std::memory_order_relaxed);
+        histogram.sum_nanoseconds.store(0, std::memory_order_relaxed);
+    }
+}
+
+}  // namespace plotly_plotter::metrics
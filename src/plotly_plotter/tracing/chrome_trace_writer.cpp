@@ -0,0 +1,103 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of chrome_trace_writer class.
+ */
+#include "plotly_plotter/tracing/chrome_trace_writer.h"
+
+#include <chrono>
+#include <string_view>
+#include <utility>
+
+#include <fmt/format.h>
+
+#include "plotly_plotter/details/file_handle.h"
+
+namespace plotly_plotter::tracing {
+
+namespace {
+
+/*!
+ * \brief Escape a string for JSON.
+ *
+ * \param[in] input Input string.
+ * \return Escaped string.
+ */
+[[nodiscard]] std::string escape_for_json(std::string_view input) {
+    std::string output;
+    output.reserve(input.size());
+    for (const char c : input) {
+        switch (c) {
+        case '\"':
+            output.append("\\\"");
+            break;
+        case '\\':
+            output.append("\\\\");
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20U) {
+                output.append(fmt::format(
+                    "\\u{:04x}", static_cast<unsigned int>(c)));
+            } else {
+                output.push_back(c);
+            }
+        }
+    }
+    return output;
+}
+
+}  // namespace
+
+chrome_trace_writer::chrome_trace_writer(std::string file_path)
+    : file_path_(std::move(file_path)), origin_(clock_type::now()) {}
+
+chrome_trace_writer::~chrome_trace_writer() {
+    try {
+        flush();
+    } catch (...) {
+        // Destructors must not throw exceptions.
+    }
+}
+
+void chrome_trace_writer::record(const span_record& record) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    records_.push_back(record);
+}
+
+void chrome_trace_writer::flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    using microseconds = std::chrono::duration<double, std::micro>;
+    plotly_plotter::details::file_handle file(file_path_, "w");
+    file.write(R"({"displayTimeUnit":"ms","traceEvents":[)");
+    bool is_first = true;
+    for (const auto& record : records_) {
+        if (!is_first) {
+            file.write(",\n");
+        }
+        is_first = false;
+        file.write(fmt::format(
+            R"({{"name":"{}","cat":"{}","ph":"X","ts":{:.3f},"dur":{:.3f},"pid":1,"tid":{}}})",
+            escape_for_json(record.name), escape_for_json(record.category),
+            microseconds(record.start - origin_).count(),
+            microseconds(record.finish - record.start).count(),
+            record.thread_index));
+    }
+    file.write("]}\n");
+}
+
+}  // namespace plotly_plotter::tracing
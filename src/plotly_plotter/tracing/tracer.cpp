@@ -0,0 +1,75 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of tracer class.
+ */
+#include "plotly_plotter/tracing/tracer.h"
+
+#include <atomic>
+#include <utility>
+
+namespace plotly_plotter::tracing {
+
+namespace {
+
+/*!
+ * \brief Get the variable of the process-wide tracer.
+ *
+ * \return Variable.
+ */
+[[nodiscard]] std::shared_ptr<tracer>& global_tracer() {
+    static std::shared_ptr<tracer> instance;
+    return instance;
+}
+
+/*!
+ * \brief Get the flag whether a tracer is set.
+ *
+ * This flag avoids locks in `std::atomic_load` when tracing is disabled.
+ *
+ * \return Flag.
+ */
+[[nodiscard]] std::atomic<bool>& is_tracer_set() {
+    static std::atomic<bool> flag{false};
+    return flag;
+}
+
+}  // namespace
+
+tracer::~tracer() = default;
+
+void set_tracer(std::shared_ptr<tracer> new_tracer) {
+    const bool is_set = static_cast<bool>(new_tracer);
+    std::atomic_store(&global_tracer(), std::move(new_tracer));
+    is_tracer_set().store(is_set, std::memory_order_release);
+}
+
+std::shared_ptr<tracer> get_tracer() {
+    if (!is_tracer_set().load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+    return std::atomic_load(&global_tracer());
+}
+
+std::uint32_t current_thread_index() {
+    static std::atomic<std::uint32_t> next_index{0};
+    thread_local const std::uint32_t index =
+        next_index.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+}  // namespace plotly_plotter::tracing
@@ -0,0 +1,205 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Implementation of write_html_page function.
+ */
+#include "plotly_plotter/write_html_page.h"
+
+#include <array>
+#include <cstdlib>
+#include <initializer_list>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+#include <yyjson.h>
+
+#include "plotly_plotter/details/escape_for_html.h"
+#include "plotly_plotter/details/compiled_template.h"
+#include "plotly_plotter/details/templates/plotly_page.h"
+#include "plotly_plotter/details/templates/plotly_page_figure.h"
+#include "plotly_plotter/details/templates/plotly_page_with_shared_arrays.h"
+#include "plotly_plotter/io/output_sink.h"
+#include "plotly_plotter/json_document.h"
+
+namespace plotly_plotter::details {
+
+namespace {
+
+/*!
+ * \brief Serialize a JSON value to a string.
+ *
+ * \param[in] value Value.
+ * \param[out] output String to append the result.
+ */
+void serialize_value_to(const yyjson_mut_val* value, std::string& output) {
+    yyjson_write_err error;
+    std::size_t length = 0;
+    char* str = yyjson_mut_val_write_opts(value, 0, nullptr, &length, &error);
+    if (str == nullptr) {
+        throw std::runtime_error(
+            std::string("Failed to serialize JSON document.") +
+            (error.msg != nullptr ? std::string(" Error: ") + error.msg
+                                  : std::string()));
+    }
+    output.append(str, length);
+    // NOLINTNEXTLINE(*-no-malloc): Required by an external library.
+    std::free(str);
+}
+
+/*!
+ * \brief Serialize data of a figure separating its template.
+ *
+ * \param[in] data Data of a figure.
+ * \param[out] figure_data Data without the template.
+ * \param[out] template_data Template.
+ */
+void serialize_separating_template(const json_document& data,
+    std::string& figure_data, std::string& template_data) {
+    yyjson_mut_val* root = data.root().internal_value();
+    if (!yyjson_mut_is_obj(root)) {
+        throw std::runtime_error("Invalid data of a figure.");
+    }
+
+    figure_data = "{";
+    template_data = "{}";
+    bool is_first = true;
+    yyjson_mut_obj_iter iter;
+    yyjson_mut_obj_iter_init(root, &iter);
+    while (yyjson_mut_val* key = yyjson_mut_obj_iter_next(&iter)) {
+        yyjson_mut_val* value = yyjson_mut_obj_iter_get_val(key);
+        if (std::string_view(yyjson_mut_get_str(key)) == "template") {
+            template_data.clear();
+            serialize_value_to(value, template_data);
+            continue;
+        }
+        if (!is_first) {
+            figure_data.push_back(',');
+        }
+        is_first = false;
+        serialize_value_to(key, figure_data);
+        figure_data.push_back(':');
+        serialize_value_to(value, figure_data);
+    }
+    figure_data.push_back('}');
+}
+
+}  // namespace
+
+void write_html_page_impl(const char* file_path, const char* html_title,
+    const json_document* const* documents, std::size_t num_documents,
+    std::size_t figure_height) {
+    std::vector<std::string> figures;
+    std::vector<std::size_t> template_indices;
+    std::string templates = "[";
+    std::unordered_map<std::string, std::size_t> template_index_map;
+    bool has_shared_arrays = false;
+    figures.reserve(num_documents);
+    template_indices.reserve(num_documents);
+    for (std::size_t i = 0; i < num_documents; ++i) {
+        // Parsed documents are converted in copies without changing the
+        // documents given via const pointers.
+        const json_document* document = documents[i];
+        std::optional<json_document> converted;
+        if (!document->is_mutable()) {
+            converted.emplace(document->clone());
+            converted->make_mutable();
+            document = &*converted;
+        }
+        has_shared_arrays =
+            has_shared_arrays || document->has_root_key("shared_arrays");
+        std::string figure_data;
+        std::string template_data;
+        serialize_separating_template(*document, figure_data, template_data);
+        record_json_serialization(document->root().internal_value(),
+            figure_data.size() + template_data.size());
+        figures.push_back(std::move(figure_data));
+
+        const auto [iter, is_inserted] = template_index_map.try_emplace(
+            std::move(template_data), template_index_map.size());
+        if (is_inserted) {
+            if (iter->second > 0) {
+                templates.push_back(',');
+            }
+            templates += iter->first;
+        }
+        template_indices.push_back(iter->second);
+    }
+    templates.push_back(']');
+
+    static const std::initializer_list<std::string_view>
+        page_placeholder_names{
+            "title", "escaped_templates", "height", "figures"};
+    static const details::compiled_template page_template_without_sharing(
+        details::templates::plotly_page, page_placeholder_names);
+    static const details::compiled_template page_template_with_sharing(
+        details::templates::plotly_page_with_shared_arrays,
+        page_placeholder_names);
+    // The script to restore shared arrays is written only when a figure has
+    // shared arrays.
+    const details::compiled_template& page_template = has_shared_arrays
+        ? page_template_with_sharing
+        : page_template_without_sharing;
+    static const details::compiled_template figure_template(
+        details::templates::plotly_page_figure,
+        {"index", "template_index", "escaped_data"});
+
+    const std::string escaped_title = details::escape_for_html(html_title);
+    const std::string escaped_templates = details::escape_for_html(templates);
+    const std::string height_str = fmt::to_string(figure_height);
+    std::vector<std::string> index_strs;
+    index_strs.reserve(figures.size());
+    for (std::size_t i = 0; i < figures.size(); ++i) {
+        index_strs.push_back(fmt::to_string(i));
+    }
+
+    // Parts of figures are prepared first,
+    // because figures are in the middle of the page template.
+    std::vector<std::string_view> figure_parts;
+    for (std::size_t i = 0; i < figures.size(); ++i) {
+        figures[i] = details::escape_for_html(figures[i]);
+        // Indices of templates never exceed indices of figures.
+        const std::array<std::string_view, 3> figure_values{
+            index_strs[i], index_strs[template_indices[i]], figures[i]};
+        figure_template.append_to(figure_parts, figure_values.data());
+    }
+
+    std::vector<std::string_view> parts;
+    const std::array<std::string_view, 3> page_values{
+        escaped_title, escaped_templates, height_str};
+    constexpr std::size_t figures_index = 3;
+    page_template.append_to(parts,
+        [&page_values, &figure_parts](std::vector<std::string_view>& target,
+            std::size_t placeholder_index) {
+            if (placeholder_index == figures_index) {
+                target.insert(
+                    target.end(), figure_parts.begin(), figure_parts.end());
+            } else {
+                target.push_back(page_values.at(placeholder_index));
+            }
+        });
+
+    io::file_output_sink sink(file_path);
+    sink.write_parts(parts.data(), parts.size());
+}
+
+}  // namespace plotly_plotter::details
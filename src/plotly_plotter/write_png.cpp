@@ -22,16 +22,30 @@
 #include <filesystem>
 #include <stdexcept>
 
+#include <fmt/format.h>
+
 #include "plotly_plotter/details/write_html_impl.h"
 #include "plotly_plotter/io/chrome_converter.h"
 #include "plotly_plotter/io/playwright_converter.h"
+#include "plotly_plotter/io/render_cache.h"
 
 namespace plotly_plotter {
 
 namespace details {
 
-void write_png_impl(const char* file_path, const char* html_title,
-    const json_document& data, std::size_t width, std::size_t height) {
+namespace {
+
+/*!
+ * \brief Render a figure to a PNG file.
+ *
+ * \param[in] file_path File path.
+ * \param[in] html_title Title of the HTML file.
+ * \param[in] data Data prepared for HTML.
+ * \param[in] width Width of the PNG file.
+ * \param[in] height Height of the PNG file.
+ */
+void render_png(const char* file_path, const char* html_title,
+    const html_figure_data& data, std::size_t width, std::size_t height) {
     const std::string html_file_path = std::string(file_path) + ".html";
     write_html_impl(html_file_path.c_str(), html_title, data,
         html_template_type::png, width, height);
@@ -55,6 +69,33 @@ void write_png_impl(const char* file_path, const char* html_title,
     std::filesystem::remove(html_file_path);
 }
 
+}  // namespace
+
+void write_png_impl(const char* file_path, const char* html_title,
+    const json_document& data, std::size_t width, std::size_t height) {
+    const std::string escaped_data = serialize_for_html(data);
+    write_png_impl(file_path, html_title,
+        html_figure_data{escaped_data, data.has_root_key("frames"),
+            data.has_root_key("shared_arrays")},
+        width, height);
+}
+
+void write_png_impl(const char* file_path, const char* html_title,
+    const html_figure_data& data, std::size_t width, std::size_t height) {
+    io::render_cache::get_instance().render(
+        file_path,
+        [&] {
+            return io::render_cache::create_entry_name("png", html_title,
+                data.escaped_data, width, height,
+                fmt::format("{}\n{}\n{}\n{}",
+                    io::playwright_converter::get_instance().get_python_path(),
+                    io::playwright_converter::get_instance().get_version(),
+                    io::chrome_converter::get_instance().get_chrome_path(),
+                    io::chrome_converter::get_instance().get_version()));
+        },
+        [&] { render_png(file_path, html_title, data, width, height); });
+}
+
 }  // namespace details
 
 bool is_png_supported() {
@@ -1,11 +1,23 @@
 set(SOURCE_FILES
     plotly_plotter/color_scales.cpp
+    plotly_plotter/details/compress_uniform_coordinates.cpp
     plotly_plotter/details/format_time.cpp
+    plotly_plotter/details/json_allocator.cpp
+    plotly_plotter/details/json_statistics.cpp
+    plotly_plotter/details/parsed_json.cpp
+    plotly_plotter/details/share_repeated_arrays.cpp
     plotly_plotter/details/write_html_impl.cpp
     plotly_plotter/figure_builders/bar.cpp
     plotly_plotter/figure_builders/bar_based_histogram.cpp
     plotly_plotter/figure_builders/box.cpp
+    plotly_plotter/figure_builders/density_heatmap.cpp
+    plotly_plotter/figure_builders/details/box_statistics.cpp
+    plotly_plotter/figure_builders/details/downsample.cpp
     plotly_plotter/figure_builders/details/figure_builder_helper.cpp
+    plotly_plotter/figure_builders/details/group_aggregation.cpp
+    plotly_plotter/figure_builders/details/histogram_2d.cpp
+    plotly_plotter/figure_builders/details/kernel_density.cpp
+    plotly_plotter/figure_builders/details/quantile.cpp
     plotly_plotter/figure_builders/figure_builder_base.cpp
     plotly_plotter/figure_builders/plotly_histogram.cpp
     plotly_plotter/figure_builders/scatter.cpp
@@ -13,15 +25,25 @@ set(SOURCE_FILES
     plotly_plotter/invert_color_scale.cpp
     plotly_plotter/io/chrome_converter.cpp
     plotly_plotter/io/details/execute_command.cpp
+    plotly_plotter/io/details/sha256.cpp
+    plotly_plotter/io/export_executor.cpp
     plotly_plotter/io/html_to_pdf_converter_base.cpp
     plotly_plotter/io/html_to_png_converter_base.cpp
+    plotly_plotter/io/output_sink.cpp
     plotly_plotter/io/pdf_to_svg_converter_base.cpp
     plotly_plotter/io/pdftocairo_converter.cpp
     plotly_plotter/io/playwright_converter.cpp
+    plotly_plotter/io/render_cache.cpp
+    plotly_plotter/io/subprocess_settings.cpp
+    plotly_plotter/io/warm_up_converters.cpp
     plotly_plotter/json_converter.cpp
+    plotly_plotter/metrics/metrics_registry.cpp
     plotly_plotter/styles.cpp
     plotly_plotter/to_string.cpp
+    plotly_plotter/tracing/chrome_trace_writer.cpp
+    plotly_plotter/tracing/tracer.cpp
     plotly_plotter/utils/calculate_histogram_bin_width.cpp
+    plotly_plotter/write_html_page.cpp
     plotly_plotter/write_pdf.cpp
     plotly_plotter/write_png.cpp
     plotly_plotter/write_svg.cpp
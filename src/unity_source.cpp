@@ -1,10 +1,22 @@
 #include "plotly_plotter/color_scales.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/details/compress_uniform_coordinates.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/details/format_time.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/details/json_allocator.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/details/json_statistics.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/details/parsed_json.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/details/share_repeated_arrays.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/details/write_html_impl.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/figure_builders/bar.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/figure_builders/bar_based_histogram.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/figure_builders/box.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/figure_builders/density_heatmap.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/figure_builders/details/box_statistics.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/figure_builders/details/downsample.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/figure_builders/details/figure_builder_helper.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/figure_builders/details/group_aggregation.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/figure_builders/details/histogram_2d.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/figure_builders/details/kernel_density.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/figure_builders/details/quantile.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/figure_builders/figure_builder_base.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/figure_builders/plotly_histogram.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/figure_builders/scatter.cpp"  // NOLINT(bugprone-suspicious-include)
@@ -12,15 +24,25 @@
 #include "plotly_plotter/invert_color_scale.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/io/chrome_converter.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/io/details/execute_command.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/io/details/sha256.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/io/export_executor.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/io/html_to_pdf_converter_base.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/io/html_to_png_converter_base.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/io/output_sink.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/io/pdf_to_svg_converter_base.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/io/pdftocairo_converter.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/io/playwright_converter.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/io/render_cache.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/io/subprocess_settings.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/io/warm_up_converters.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/json_converter.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/metrics/metrics_registry.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/styles.cpp"     // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/to_string.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/tracing/chrome_trace_writer.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/tracing/tracer.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/utils/calculate_histogram_bin_width.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "plotly_plotter/write_html_page.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/write_pdf.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/write_png.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "plotly_plotter/write_svg.cpp"  // NOLINT(bugprone-suspicious-include)
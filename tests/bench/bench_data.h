@@ -0,0 +1,131 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Definition of functions to generate data for benchmarks.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace plotly_plotter_bench {
+
+//! Minimum size of data in benchmarks.
+constexpr std::size_t min_bench_size = 1000;
+
+//! Default maximum size of data in benchmarks.
+constexpr std::size_t default_max_bench_size = 1000000;
+
+//! Limit of the maximum size of data in benchmarks.
+constexpr std::size_t max_bench_size_limit = 100000000;
+
+/*!
+ * \brief Get sizes of data in benchmarks.
+ *
+ * Sizes are powers of 10 from \ref min_bench_size to the maximum size.
+ * The maximum size can be changed using `PLOTLY_PLOTTER_BENCH_MAX_SIZE`
+ * environment variable (up to \ref max_bench_size_limit).
+ *
+ * \param[in] max_size_limit Limit of the maximum size for the benchmark.
+ * \return Sizes.
+ *
+ * \note This function throws std::invalid_argument if the environment
+ * variable is not an integer of at least \ref min_bench_size.
+ */
+[[nodiscard]] inline std::vector<std::size_t> bench_sizes(
+    std::size_t max_size_limit = max_bench_size_limit) {
+    std::size_t max_size = default_max_bench_size;
+    // NOLINTNEXTLINE(concurrency-mt-unsafe): Benchmarks use a single thread.
+    if (const char* env = std::getenv("PLOTLY_PLOTTER_BENCH_MAX_SIZE");
+        env != nullptr) {
+        char* end = nullptr;
+        constexpr int radix = 10;
+        const unsigned long long value = std::strtoull(env, &end, radix);
+        if (end == env || *end != '\0' || value < min_bench_size) {
+            throw std::invalid_argument(fmt::format(
+                "Invalid PLOTLY_PLOTTER_BENCH_MAX_SIZE: \"{}\" "
+                "(must be an integer of at least {}).",
+                env, min_bench_size));
+        }
+        max_size = static_cast<std::size_t>(value);
+    }
+    if (max_size > max_size_limit) {
+        max_size = max_size_limit;
+    }
+
+    std::vector<std::size_t> sizes;
+    constexpr std::size_t base = 10;
+    for (std::size_t size = min_bench_size; size <= max_size; size *= base) {
+        sizes.push_back(size);
+    }
+    return sizes;
+}
+
+/*!
+ * \brief Generate random numbers.
+ *
+ * \param[in] size Number of values.
+ * \return Values.
+ */
+[[nodiscard]] inline std::vector<double> generate_values(std::size_t size) {
+    // Fixed seed for reproducibility.
+    std::mt19937 engine;  // NOLINT(cert-msc32-c,cert-msc51-cpp)
+    std::normal_distribution<double> distribution;
+    std::vector<double> values;
+    values.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        values.push_back(distribution(engine));
+    }
+    return values;
+}
+
+/*!
+ * \brief Generate names of groups.
+ *
+ * \param[in] size Number of values.
+ * \param[in] num_groups Number of groups.
+ * \return Names of groups.
+ */
+[[nodiscard]] inline std::vector<std::string> generate_groups(
+    std::size_t size, std::size_t num_groups) {
+    std::vector<std::string> groups;
+    groups.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        groups.push_back(fmt::format("group{}", i % num_groups));
+    }
+    return groups;
+}
+
+/*!
+ * \brief Create the name of a benchmark.
+ *
+ * \param[in] name Name of the benchmark without size.
+ * \param[in] size Size of data.
+ * \return Name.
+ */
+[[nodiscard]] inline std::string bench_name(
+    const std::string& name, std::size_t size) {
+    return fmt::format("{} (size={})", name, size);
+}
+
+}  // namespace plotly_plotter_bench
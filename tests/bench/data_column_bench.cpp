@@ -0,0 +1,80 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Benchmarks of data_column class.
+ */
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+
+#include "bench_data.h"
+#include "plotly_plotter/data_column.h"
+#include "plotly_plotter/data_table.h"
+#include "plotly_plotter/json_document.h"
+
+TEST_CASE("bench: plotly_plotter::data_column") {
+    using plotly_plotter::data_table;
+    using plotly_plotter::json_document;
+    using plotly_plotter_bench::bench_name;
+
+    const std::size_t size = GENERATE(
+        Catch::Generators::from_range(plotly_plotter_bench::bench_sizes()));
+    constexpr std::size_t num_groups = 10;
+
+    data_table table;
+    table.emplace("values", plotly_plotter_bench::generate_values(size));
+    table.emplace(
+        "groups", plotly_plotter_bench::generate_groups(size, num_groups));
+
+    SECTION("to_json_partial") {
+        std::vector<bool> mask(size, false);
+        for (std::size_t i = 0; i < size; i += 2) {
+            mask[i] = true;
+        }
+        const auto column = table.at("values");
+
+        BENCHMARK_ADVANCED(bench_name("data_column::to_json_partial", size))
+        (Catch::Benchmark::Chronometer meter) {
+            meter.measure([&column, &mask] {
+                json_document document;
+                column->to_json_partial(document.root(), mask);
+                return document.root().internal_value();
+            });
+        };
+    }
+
+    SECTION("generate_group of strings") {
+        const auto column = table.at("groups");
+
+        BENCHMARK(bench_name("data_column::generate_group (string)", size)) {
+            return column->generate_group();
+        };
+    }
+
+    SECTION("generate_group of numbers") {
+        const auto column = table.at("values");
+
+        BENCHMARK(bench_name("data_column::generate_group (double)", size)) {
+            return column->generate_group();
+        };
+    }
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Benchmarks of execution of commands.
+ */
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "plotly_plotter/details/config.h"
+#include "plotly_plotter/io/details/execute_command.h"
+#include "plotly_plotter/io/subprocess_settings.h"
+
+#if PLOTLY_PLOTTER_USE_UNIX_SUBPROCESS
+TEST_CASE("bench: plotly_plotter::io::details::execute_command") {
+    using plotly_plotter::io::process_launcher;
+
+    const std::vector<std::string> command{"true"};
+
+    SECTION("posix_spawn") {
+        plotly_plotter::io::set_process_launcher(process_launcher::posix_spawn);
+        BENCHMARK("execute_command (posix_spawn)") {
+            plotly_plotter::io::details::execute_command(command);
+        };
+    }
+
+    SECTION("fork") {
+        plotly_plotter::io::set_process_launcher(process_launcher::fork);
+        BENCHMARK("execute_command (fork)") {
+            plotly_plotter::io::details::execute_command(command);
+        };
+    }
+
+    plotly_plotter::io::set_process_launcher(process_launcher::posix_spawn);
+}
+#endif
@@ -0,0 +1,165 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Benchmarks of exports of figures using a stub converter.
+ */
+#include <cstddef>
+#include <future>
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <fmt/format.h>
+
+#include "plotly_plotter/details/config.h"
+#include "plotly_plotter/figure.h"
+#include "plotly_plotter/io/chrome_converter.h"
+#include "plotly_plotter/io/export_executor.h"
+#include "plotly_plotter/io/pdftocairo_converter.h"
+#include "plotly_plotter/io/playwright_converter.h"
+#include "plotly_plotter/traces/scatter.h"
+#include "plotly_plotter/write_pdf.h"
+#include "plotly_plotter/write_png.h"
+#include "plotly_plotter/write_svg.h"
+
+#if PLOTLY_PLOTTER_USE_UNIX_SUBPROCESS || PLOTLY_PLOTTER_USE_WIN_SUBPROCESS
+
+namespace {
+
+/*!
+ * \brief Export figures concurrently.
+ *
+ * \tparam Writer Type of the function to write a figure.
+ * \param[in] executor Executor.
+ * \param[in] num_exports Number of exports.
+ * \param[in] extension Extension of files.
+ * \param[in] writer Function to write a figure to a file path.
+ */
+template <typename Writer>
+void export_concurrently(plotly_plotter::io::export_executor& executor,
+    std::size_t num_exports, const std::string& extension,
+    const Writer& writer) {
+    std::vector<std::future<void>> futures;
+    futures.reserve(num_exports);
+    for (std::size_t i = 0; i < num_exports; ++i) {
+        futures.push_back(executor.submit([i, &extension, &writer] {
+            writer(fmt::format("export_bench_{}.{}", i, extension));
+        }));
+    }
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
+/*!
+ * \brief Create a figure for benchmarks.
+ *
+ * \return Figure.
+ */
+[[nodiscard]] plotly_plotter::figure create_figure() {
+    plotly_plotter::figure figure;
+    auto scatter = figure.add_scatter();
+    scatter.x(std::vector{1, 2, 3});
+    scatter.y(std::vector{4, 5, 6});  // NOLINT(*-magic-numbers)
+    return figure;
+}
+
+}  // namespace
+
+TEST_CASE("bench: checks of converters with a stub converter") {
+    auto& playwright = plotly_plotter::io::playwright_converter::get_instance();
+    auto& chrome = plotly_plotter::io::chrome_converter::get_instance();
+    const std::string stub_path = PLOTLY_PLOTTER_STUB_CONVERTER_PATH;
+
+    BENCHMARK("check playwright_converter") {
+        // Setting the path clears the cache of the check.
+        playwright.set_python_path(stub_path);
+        return playwright.is_html_to_png_conversion_supported();
+    };
+    BENCHMARK("check chrome_converter") {
+        chrome.set_chrome_path(stub_path);
+        return chrome.is_html_to_png_conversion_supported();
+    };
+}
+
+TEST_CASE("bench: exports with a stub converter") {
+    auto& playwright = plotly_plotter::io::playwright_converter::get_instance();
+    auto& chrome = plotly_plotter::io::chrome_converter::get_instance();
+    auto& pdftocairo =
+        plotly_plotter::io::pdftocairo_converter::get_instance();
+    const std::string stub_path = PLOTLY_PLOTTER_STUB_CONVERTER_PATH;
+    const plotly_plotter::figure figure = create_figure();
+
+    const std::size_t num_threads = GENERATE(1, 2, 4, 8);
+    constexpr std::size_t num_exports = 16;
+    constexpr std::size_t queue_capacity = num_exports;
+    plotly_plotter::io::export_executor executor(num_threads, queue_capacity);
+
+    SECTION("PNG with playwright_converter") {
+        playwright.set_python_path(stub_path);
+        BENCHMARK(fmt::format(
+            "{} PNG exports via playwright_converter (threads={})",
+            num_exports, num_threads)) {
+            export_concurrently(executor, num_exports, "png",
+                [&figure](const std::string& path) {
+                    plotly_plotter::write_png(path, figure);
+                });
+        };
+    }
+
+    SECTION("PNG with chrome_converter") {
+        // Use chrome_converter by disabling playwright_converter.
+        playwright.set_python_path("plotly_plotter_non_existing_python");
+        chrome.set_chrome_path(stub_path);
+        BENCHMARK(
+            fmt::format("{} PNG exports via chrome_converter (threads={})",
+                num_exports, num_threads)) {
+            export_concurrently(executor, num_exports, "png",
+                [&figure](const std::string& path) {
+                    plotly_plotter::write_png(path, figure);
+                });
+        };
+    }
+
+    SECTION("PDF with playwright_converter") {
+        playwright.set_python_path(stub_path);
+        BENCHMARK(fmt::format(
+            "{} PDF exports via playwright_converter (threads={})",
+            num_exports, num_threads)) {
+            export_concurrently(executor, num_exports, "pdf",
+                [&figure](const std::string& path) {
+                    plotly_plotter::write_pdf(path, figure);
+                });
+        };
+    }
+
+    SECTION("SVG with playwright_converter and pdftocairo_converter") {
+        playwright.set_python_path(stub_path);
+        pdftocairo.set_pdftocairo_path(stub_path);
+        BENCHMARK(fmt::format("{} SVG exports (threads={})", num_exports,
+            num_threads)) {
+            export_concurrently(executor, num_exports, "svg",
+                [&figure](const std::string& path) {
+                    plotly_plotter::write_svg(path, figure);
+                });
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Benchmarks of figure builders.
+ */
+#include <cstddef>
+#include <string>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+
+#include "bench_data.h"
+#include "plotly_plotter/data_table.h"
+#include "plotly_plotter/figure_builders/bar.h"
+#include "plotly_plotter/figure_builders/bar_based_histogram.h"
+#include "plotly_plotter/figure_builders/box.h"
+#include "plotly_plotter/figure_builders/line.h"
+#include "plotly_plotter/figure_builders/plotly_histogram.h"
+#include "plotly_plotter/figure_builders/scatter.h"
+#include "plotly_plotter/figure_builders/violin.h"
+
+namespace {
+
+/*!
+ * \brief Run benchmarks of create function of a figure builder.
+ *
+ * \tparam BuilderFactory Type of the function to create builders.
+ * \param[in] name Name of the builder.
+ * \param[in] size Size of data.
+ * \param[in] factory Function to create builders.
+ */
+template <typename BuilderFactory>
+void bench_create(
+    const std::string& name, std::size_t size, BuilderFactory&& factory) {
+    using plotly_plotter_bench::bench_name;
+
+    BENCHMARK(bench_name(name + "::create", size)) {
+        return factory().create();
+    };
+    BENCHMARK(bench_name(name + "::create with groups", size)) {
+        return factory().group("group").create();
+    };
+    BENCHMARK(bench_name(name + "::create with subplots", size)) {
+        return factory().subplot_row("row").subplot_column("column").create();
+    };
+    BENCHMARK(bench_name(name + "::create with frames", size)) {
+        return factory().animation_frame("frame").create();
+    };
+}
+
+}  // namespace
+
+TEST_CASE("bench: plotly_plotter::figure_builders") {
+    using plotly_plotter::data_table;
+    using plotly_plotter_bench::generate_groups;
+
+    const std::size_t size = GENERATE(
+        Catch::Generators::from_range(plotly_plotter_bench::bench_sizes()));
+    constexpr std::size_t num_groups = 10;
+    constexpr std::size_t num_subplot_rows = 2;
+    constexpr std::size_t num_subplot_columns = 2;
+    constexpr std::size_t num_frames = 5;
+
+    data_table data;
+    data.emplace("x", plotly_plotter_bench::generate_values(size));
+    data.emplace("y", plotly_plotter_bench::generate_values(size));
+    data.emplace("group", generate_groups(size, num_groups));
+    data.emplace("row", generate_groups(size, num_subplot_rows));
+    data.emplace("column", generate_groups(size, num_subplot_columns));
+    data.emplace("frame", generate_groups(size, num_frames));
+
+    SECTION("scatter") {
+        bench_create("scatter", size, [&data] {
+            return plotly_plotter::figure_builders::scatter(data).x("x").y(
+                "y");
+        });
+    }
+
+    SECTION("line") {
+        bench_create("line", size, [&data] {
+            return plotly_plotter::figure_builders::line(data).x("x").y("y");
+        });
+    }
+
+    SECTION("bar") {
+        bench_create("bar", size, [&data] {
+            return plotly_plotter::figure_builders::bar(data).x("x").y("y");
+        });
+    }
+
+    SECTION("box") {
+        bench_create("box", size, [&data] {
+            return plotly_plotter::figure_builders::box(data).y("y");
+        });
+    }
+
+    SECTION("violin") {
+        bench_create("violin", size, [&data] {
+            return plotly_plotter::figure_builders::violin(data).y("y");
+        });
+    }
+
+    SECTION("plotly_histogram") {
+        bench_create("plotly_histogram", size, [&data] {
+            return plotly_plotter::figure_builders::plotly_histogram(data).x(
+                "x");
+        });
+    }
+
+    SECTION("bar_based_histogram") {
+        bench_create("bar_based_histogram", size, [&data] {
+            return plotly_plotter::figure_builders::bar_based_histogram(data)
+                .x("x");
+        });
+    }
+}
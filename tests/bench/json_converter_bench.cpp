@@ -0,0 +1,68 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Benchmarks of conversion of data to JSON.
+ */
+#include <cstddef>
+#include <vector>
+
+#include <Eigen/Core>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+
+#include "bench_data.h"
+#include "plotly_plotter/eigen.h"  // IWYU pragma: keep
+#include "plotly_plotter/json_converter.h"  // IWYU pragma: keep
+#include "plotly_plotter/json_document.h"
+#include "plotly_plotter/json_value.h"
+
+TEST_CASE("bench: plotly_plotter::json_converter") {
+    using plotly_plotter::json_document;
+    using plotly_plotter_bench::bench_name;
+
+    const std::size_t size = GENERATE(
+        Catch::Generators::from_range(plotly_plotter_bench::bench_sizes()));
+    const std::vector<double> values =
+        plotly_plotter_bench::generate_values(size);
+
+    SECTION("std::vector") {
+        BENCHMARK_ADVANCED(
+            bench_name("json_converter<std::vector<double>>", size))
+        (Catch::Benchmark::Chronometer meter) {
+            meter.measure([&values] {
+                json_document document;
+                document.root() = values;
+                return document.root().internal_value();
+            });
+        };
+    }
+
+    SECTION("Eigen::VectorXd") {
+        const Eigen::VectorXd vector = Eigen::Map<const Eigen::VectorXd>(
+            values.data(), static_cast<Eigen::Index>(values.size()));
+        BENCHMARK_ADVANCED(bench_name("json_converter<Eigen::VectorXd>", size))
+        (Catch::Benchmark::Chronometer meter) {
+            meter.measure([&vector] {
+                json_document document;
+                document.root() = vector;
+                return document.root().internal_value();
+            });
+        };
+    }
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Benchmarks of outputs of figures.
+ */
+#include <cstddef>
+#include <string>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+
+#include "bench_data.h"
+#include "plotly_plotter/details/escape_for_html.h"
+#include "plotly_plotter/figure.h"
+#include "plotly_plotter/io/output_sink.h"
+#include "plotly_plotter/traces/scatter.h"
+#include "plotly_plotter/write_html.h"
+
+TEST_CASE("bench: outputs") {
+    using plotly_plotter_bench::bench_name;
+
+    const std::size_t size = GENERATE(
+        Catch::Generators::from_range(plotly_plotter_bench::bench_sizes()));
+
+    plotly_plotter::figure figure;
+    auto scatter = figure.add_scatter();
+    scatter.x(plotly_plotter_bench::generate_values(size));
+    scatter.y(plotly_plotter_bench::generate_values(size));
+
+    SECTION("serialize_to_string") {
+        BENCHMARK(bench_name("json_document::serialize_to_string", size)) {
+            return figure.document().serialize_to_string();
+        };
+    }
+
+    SECTION("escape_for_html") {
+        const std::string serialized = figure.document().serialize_to_string();
+        BENCHMARK(bench_name("escape_for_html", size)) {
+            return plotly_plotter::details::escape_for_html(serialized);
+        };
+    }
+
+    SECTION("write_html to a file") {
+        const std::string file_path = "output_bench.html";
+        BENCHMARK(bench_name("write_html (file)", size)) {
+            plotly_plotter::write_html(file_path, figure);
+        };
+    }
+
+    SECTION("write_html to a string") {
+        BENCHMARK_ADVANCED(bench_name("write_html (string)", size))
+        (Catch::Benchmark::Chronometer meter) {
+            meter.measure([&figure] {
+                std::string buffer;
+                plotly_plotter::io::string_output_sink sink(buffer);
+                plotly_plotter::write_html_to(sink, figure);
+                return buffer.size();
+            });
+        };
+    }
+}
@@ -0,0 +1,8 @@
+set(SOURCE_FILES
+    data_column_bench.cpp
+    execute_command_bench.cpp
+    export_bench.cpp
+    figure_builders_bench.cpp
+    json_converter_bench.cpp
+    output_bench.cpp
+)
@@ -0,0 +1,6 @@
+#include "data_column_bench.cpp"      // NOLINT(bugprone-suspicious-include)
+#include "execute_command_bench.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "export_bench.cpp"           // NOLINT(bugprone-suspicious-include)
+#include "figure_builders_bench.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "json_converter_bench.cpp"   // NOLINT(bugprone-suspicious-include)
+#include "output_bench.cpp"           // NOLINT(bugprone-suspicious-include)
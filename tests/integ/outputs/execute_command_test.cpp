@@ -19,9 +19,14 @@
  */
 #include "plotly_plotter/io/details/execute_command.h"
 
+#include <chrono>
+#include <string>
+#include <vector>
+
 #include <catch2/catch_test_macros.hpp>
 
 #include "plotly_plotter/details/config.h"
+#include "plotly_plotter/io/subprocess_settings.h"
 
 TEST_CASE("plotly_plotter::io::details::execute_command") {
     SECTION("check command execution") {
@@ -125,4 +130,78 @@ TEST_CASE("plotly_plotter::io::details::execute_command") {
             command, capture_logs));
 #endif
     }
+
+#if PLOTLY_PLOTTER_USE_UNIX_SUBPROCESS
+    SECTION("capture the output of a command") {
+        SECTION("success") {
+            std::vector<std::string> command{"echo", "abc"};
+            CHECK(plotly_plotter::io::details::capture_command_output(
+                      command) == "abc\n");
+        }
+
+        SECTION("failure in command") {
+            std::vector<std::string> command{"ls", "non_existent_file"};
+            CHECK_FALSE(
+                plotly_plotter::io::details::capture_command_output(command));
+        }
+
+        SECTION("failure in starting the command") {
+            std::vector<std::string> command{"non_existent_command"};
+            CHECK_FALSE(
+                plotly_plotter::io::details::capture_command_output(command));
+        }
+    }
+
+    SECTION("execute a command using fork") {
+        plotly_plotter::io::set_process_launcher(
+            plotly_plotter::io::process_launcher::fork);
+
+        SECTION("success") {
+            std::vector<std::string> command{"ls", "-l"};
+            const bool capture_logs = true;
+            CHECK_NOTHROW(plotly_plotter::io::details::execute_command(
+                command, capture_logs));
+        }
+
+        SECTION("failure in command") {
+            std::vector<std::string> command{"ls", "non_existent_file"};
+            const bool capture_logs = true;
+            CHECK_THROWS(plotly_plotter::io::details::execute_command(
+                command, capture_logs));
+        }
+
+        SECTION("failure in starting the command") {
+            std::vector<std::string> command{"non_existent_command"};
+            const bool capture_logs = true;
+            CHECK_FALSE(plotly_plotter::io::details::check_command_success(
+                command, capture_logs));
+        }
+
+        plotly_plotter::io::set_process_launcher(
+            plotly_plotter::io::process_launcher::posix_spawn);
+    }
+
+    SECTION("timeout") {
+        const auto default_timeout =
+            plotly_plotter::io::get_subprocess_timeout();
+        plotly_plotter::io::set_subprocess_timeout(
+            std::chrono::milliseconds(100));  // NOLINT(*-magic-numbers)
+
+        SECTION("with logs") {
+            std::vector<std::string> command{"sleep", "10"};
+            const bool capture_logs = true;
+            CHECK_THROWS(plotly_plotter::io::details::execute_command(
+                command, capture_logs));
+        }
+
+        SECTION("without logs") {
+            std::vector<std::string> command{"sleep", "10"};
+            const bool capture_logs = false;
+            CHECK_THROWS(plotly_plotter::io::details::execute_command(
+                command, capture_logs));
+        }
+
+        plotly_plotter::io::set_subprocess_timeout(default_timeout);
+    }
+#endif
 }
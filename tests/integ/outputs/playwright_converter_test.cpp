@@ -19,6 +19,7 @@
  */
 #include "plotly_plotter/io/playwright_converter.h"
 
+#include <chrono>
 #include <filesystem>
 #include <string>
 #include <vector>
@@ -31,6 +32,7 @@
 #include "plotly_plotter/figure.h"
 #include "plotly_plotter/figure_builders/line.h"
 #include "plotly_plotter/figure_builders/scatter.h"
+#include "plotly_plotter/io/warm_up_converters.h"
 
 TEST_CASE("plotly_plotter::io::playwright_converter") {
     // Create a figure for test.
@@ -87,6 +89,25 @@ TEST_CASE("plotly_plotter::io::playwright_converter") {
         CHECK_FALSE(converter.is_html_to_png_conversion_supported());
         CHECK_THROWS(converter.convert_html_to_png(
             html_file_path.c_str(), png_file_path.c_str(), width, height));
+#endif
+    }
+
+    SECTION("cache results of checks") {
+        plotly_plotter::io::warm_up_converters_async().get();
+
+        const auto start = std::chrono::steady_clock::now();
+        (void)converter.is_html_to_png_conversion_supported();
+        (void)converter.is_html_to_pdf_conversion_supported();
+        const auto duration = std::chrono::steady_clock::now() - start;
+        // Cached results are returned without subprocesses.
+        CHECK(duration < std::chrono::milliseconds(100));
+
+        const std::string python_path = converter.get_python_path();
+        converter.set_python_path("non_existent_python");
+        CHECK_FALSE(converter.is_html_to_png_conversion_supported());
+        converter.set_python_path(python_path);
+#if PLOTLY_PLOTTER_USE_UNIX_SUBPROCESS || PLOTLY_PLOTTER_USE_WIN_SUBPROCESS
+        CHECK(converter.is_html_to_png_conversion_supported());
 #endif
     }
 }
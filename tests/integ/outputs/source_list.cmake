@@ -5,6 +5,7 @@ set(SOURCE_FILES
     output_types_test.cpp
     pdftocairo_converter_test.cpp
     playwright_converter_test.cpp
+    write_async_test.cpp
     write_pdf_test.cpp
     write_png_test.cpp
     write_svg_test.cpp
@@ -4,6 +4,7 @@
 #include "output_types_test.cpp"          // NOLINT(bugprone-suspicious-include)
 #include "pdftocairo_converter_test.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "playwright_converter_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "write_async_test.cpp"           // NOLINT(bugprone-suspicious-include)
 #include "write_pdf_test.cpp"             // NOLINT(bugprone-suspicious-include)
 #include "write_png_test.cpp"             // NOLINT(bugprone-suspicious-include)
 #include "write_svg_test.cpp"             // NOLINT(bugprone-suspicious-include)
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of functions to write figures asynchronously.
+ */
+#include "plotly_plotter/write_async.h"
+
+#include <filesystem>
+#include <future>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "plotly_plotter/details/config.h"
+#include "plotly_plotter/figure.h"
+#include "plotly_plotter/traces/scatter.h"
+
+TEST_CASE("plotly_plotter::write_png_async") {
+    // Figure for test.
+    const auto create_figure = [] {
+        plotly_plotter::figure figure;
+        auto scatter = figure.add_scatter();
+        scatter.x(std::vector{1, 2, 3});
+        scatter.y(std::vector{4, 5, 6});  // NOLINT(*-magic-numbers)
+        return figure;
+    };
+
+    SECTION("create PNG files") {
+        const std::vector<std::string> png_file_paths{
+            "write_png_async_test1.png", "write_png_async_test2.png"};
+
+        std::vector<std::future<void>> futures;
+        for (const auto& png_file_path : png_file_paths) {
+            futures.push_back(plotly_plotter::write_png_async(
+                png_file_path, create_figure()));
+        }
+
+#if PLOTLY_PLOTTER_USE_UNIX_SUBPROCESS || PLOTLY_PLOTTER_USE_WIN_SUBPROCESS
+        for (auto& future : futures) {
+            CHECK_NOTHROW(future.get());
+        }
+        for (const auto& png_file_path : png_file_paths) {
+            CHECK(std::filesystem::exists(png_file_path));
+        }
+#else
+        for (auto& future : futures) {
+            CHECK_THROWS(future.get());
+        }
+#endif
+    }
+}
+
+TEST_CASE("plotly_plotter::write_pdf_async") {
+    plotly_plotter::figure figure;
+    auto scatter = figure.add_scatter();
+    scatter.x(std::vector{1, 2, 3});
+    scatter.y(std::vector{4, 5, 6});  // NOLINT(*-magic-numbers)
+
+    SECTION("create a PDF file") {
+        const std::string pdf_file_path = "write_pdf_async_test.pdf";
+
+        auto future =
+            plotly_plotter::write_pdf_async(pdf_file_path, std::move(figure));
+
+#if PLOTLY_PLOTTER_USE_UNIX_SUBPROCESS || PLOTLY_PLOTTER_USE_WIN_SUBPROCESS
+        CHECK_NOTHROW(future.get());
+        CHECK(std::filesystem::exists(pdf_file_path));
+#else
+        CHECK_THROWS(future.get());
+#endif
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Stub of converters used in benchmarks.
+ *
+ * This executable accepts command line arguments of Python with Playwright,
+ * Chrome, and pdftocairo used in converters, and writes dummy outputs without
+ * rendering anything.
+ */
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+/*!
+ * \brief Write a dummy output file.
+ *
+ * \param[in] file_path File path.
+ * \retval EXIT_SUCCESS Succeeded.
+ * \retval EXIT_FAILURE Failed.
+ */
+int write_dummy_file(const std::string& file_path) {
+    std::ofstream stream(file_path, std::ios::binary);
+    stream << "dummy output of stub_converter\n";
+    return stream ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    const std::vector<std::string> args(argv + 1, argv + argc);
+
+    // Checks of executables.
+    if (args == std::vector<std::string>{"-m", "playwright", "--version"} ||
+        args == std::vector<std::string>{"--version"} ||
+        args == std::vector<std::string>{"-v"}) {
+        std::cout << "stub_converter 1.0.0" << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    // Chrome: --print-to-pdf=<path> or --screenshot=<path>.
+    for (const auto& arg : args) {
+        for (const std::string_view prefix :
+            {std::string_view("--print-to-pdf="),
+                std::string_view("--screenshot=")}) {
+            if (std::string_view(arg).substr(0, prefix.size()) == prefix) {
+                return write_dummy_file(arg.substr(prefix.size()));
+            }
+        }
+    }
+
+    // pdftocairo: <pdf> -svg <svg>.
+    constexpr std::size_t num_pdftocairo_args = 3;
+    if (args.size() == num_pdftocairo_args && args[1] == "-svg") {
+        return write_dummy_file(args[2]);
+    }
+
+    // Python with Playwright: <script> <html> <output> <width> <height>.
+    constexpr std::size_t num_playwright_args = 5;
+    if (args.size() == num_playwright_args) {
+        return write_dummy_file(args[2]);
+    }
+
+    std::cerr << "Unsupported arguments." << std::endl;
+    return EXIT_FAILURE;
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of compiled_template class.
+ */
+#include "plotly_plotter/details/compiled_template.h"
+
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("plotly_plotter::details::compiled_template") {
+    using plotly_plotter::details::compiled_template;
+
+    SECTION("fill placeholders") {
+        const compiled_template html_template(
+            "<p>{{ first }}, {{ second }}, {{ first }}</p>",
+            {"first", "second"});
+        const std::array<std::string_view, 2> values{"abc", "def"};
+
+        std::vector<std::string_view> parts;
+        html_template.append_to(parts, values.data());
+
+        std::string result;
+        for (const auto& part : parts) {
+            result += part;
+        }
+        CHECK(result == "<p>abc, def, abc</p>");
+        CHECK(html_template.num_placeholders() == 2);
+    }
+
+    SECTION("fill placeholders with functions") {
+        const compiled_template html_template("[{{ items }}]", {"items"});
+
+        std::vector<std::string_view> parts;
+        html_template.append_to(parts,
+            [](std::vector<std::string_view>& target,
+                std::size_t /*placeholder_index*/) {
+                target.push_back("1");
+                target.push_back(",");
+                target.push_back("2");
+            });
+
+        std::string result;
+        for (const auto& part : parts) {
+            result += part;
+        }
+        CHECK(result == "[1,2]");
+    }
+
+    SECTION("reject invalid placeholders") {
+        CHECK_THROWS_AS(compiled_template("{{ unknown }}", {"known"}),
+            std::runtime_error);
+        CHECK_THROWS_AS(
+            compiled_template("{{ known", {"known"}), std::runtime_error);
+    }
+}
@@ -0,0 +1,228 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of compress_uniform_coordinates function.
+ */
+#include "plotly_plotter/details/compress_uniform_coordinates.h"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <yyjson.h>
+
+#include "plotly_plotter/figure.h"
+#include "plotly_plotter/traces/bar.h"
+#include "plotly_plotter/traces/heatmap.h"
+#include "plotly_plotter/traces/histogram.h"
+#include "plotly_plotter/traces/scatter.h"
+
+namespace {
+
+[[nodiscard]] yyjson_mut_val* get_trace(
+    yyjson_mut_val* parent, std::size_t index) {
+    return yyjson_mut_arr_get(yyjson_mut_obj_get(parent, "data"), index);
+}
+
+[[nodiscard]] double get_number(yyjson_mut_val* trace, const char* key) {
+    return yyjson_mut_get_num(yyjson_mut_obj_get(trace, key));
+}
+
+}  // namespace
+
+TEST_CASE("plotly_plotter::details::detect_uniform_spacing") {
+    using plotly_plotter::details::detect_uniform_spacing;
+
+    SECTION("detect integers") {
+        const std::vector<double> values{3.0, 5.0, 7.0, 9.0};
+
+        const auto spacing = detect_uniform_spacing(values.data(), 4);
+
+        REQUIRE(spacing);
+        CHECK(spacing->start == 3.0);  // NOLINT(*-magic-numbers)
+        CHECK(spacing->step == 2.0);   // NOLINT(*-magic-numbers)
+    }
+
+    SECTION("detect values with rounding errors") {
+        constexpr std::size_t size = 1000;
+        std::vector<double> values;
+        for (std::size_t i = 0; i < size; ++i) {
+            values.push_back(0.1 * static_cast<double>(i));  // NOLINT
+        }
+
+        const auto spacing = detect_uniform_spacing(values.data(), size);
+
+        REQUIRE(spacing);
+        CHECK(spacing->start == 0.0);
+        CHECK_THAT(spacing->step, Catch::Matchers::WithinRel(0.1));  // NOLINT
+    }
+
+    SECTION("detect decreasing values") {
+        const std::vector<double> values{1.0, 0.5, 0.0, -0.5};
+
+        const auto spacing = detect_uniform_spacing(values.data(), 4);
+
+        REQUIRE(spacing);
+        CHECK(spacing->start == 1.0);
+        CHECK(spacing->step == -0.5);  // NOLINT(*-magic-numbers)
+    }
+
+    SECTION("reject non-uniform values") {
+        const std::vector<double> values{1.0, 2.0, 4.0, 5.0};
+
+        CHECK_FALSE(detect_uniform_spacing(values.data(), 4));
+    }
+
+    SECTION("reject slightly perturbed values") {
+        const std::vector<double> values{1.0, 2.0, 3.001, 4.0};
+
+        CHECK_FALSE(detect_uniform_spacing(values.data(), 4));
+    }
+
+    SECTION("reject constant values") {
+        const std::vector<double> values{1.0, 1.0, 1.0};
+
+        CHECK_FALSE(detect_uniform_spacing(values.data(), 3));
+    }
+
+    SECTION("reject NaN") {
+        const std::vector<double> values{
+            1.0, std::numeric_limits<double>::quiet_NaN(), 3.0};
+
+        CHECK_FALSE(detect_uniform_spacing(values.data(), 3));
+    }
+
+    SECTION("reject too few values") {
+        const std::vector<double> values{1.0};
+
+        CHECK_FALSE(detect_uniform_spacing(values.data(), 1));
+    }
+}
+
+TEST_CASE("plotly_plotter::details::compress_uniform_coordinates") {
+    using plotly_plotter::figure;
+    using plotly_plotter::details::compress_uniform_coordinates;
+
+    constexpr std::size_t min_size = 3;
+
+    SECTION("compress x in scatter traces") {
+        figure fig;
+        auto scatter = fig.add_scatter();
+        scatter.x(std::vector<int>{1, 2, 3, 4});
+        scatter.y(std::vector<double>{1.0, 4.0, 9.0, 16.0});  // NOLINT
+
+        CHECK(compress_uniform_coordinates(fig.document(), min_size) == 1);
+
+        yyjson_mut_val* root = fig.document().root().internal_value();
+        yyjson_mut_val* trace = get_trace(root, 0);
+        CHECK(yyjson_mut_obj_get(trace, "x") == nullptr);
+        CHECK(get_number(trace, "x0") == 1.0);
+        CHECK(get_number(trace, "dx") == 1.0);
+        CHECK(yyjson_mut_obj_get(trace, "y") != nullptr);
+        CHECK(yyjson_mut_obj_get(trace, "y0") == nullptr);
+    }
+
+    SECTION("compress y in bar traces") {
+        figure fig;
+        auto bar = fig.add_bar();
+        bar.x(std::vector<double>{3.0, 1.0, 2.0});   // NOLINT
+        bar.y(std::vector<double>{0.5, 1.0, 1.5});  // NOLINT
+
+        CHECK(compress_uniform_coordinates(fig.document(), min_size) == 1);
+
+        yyjson_mut_val* root = fig.document().root().internal_value();
+        yyjson_mut_val* trace = get_trace(root, 0);
+        CHECK(yyjson_mut_obj_get(trace, "x") != nullptr);
+        CHECK(yyjson_mut_obj_get(trace, "y") == nullptr);
+        CHECK(get_number(trace, "y0") == 0.5);  // NOLINT(*-magic-numbers)
+        CHECK(get_number(trace, "dy") == 0.5);  // NOLINT(*-magic-numbers)
+    }
+
+    SECTION("compress edges of cells in heatmaps") {
+        figure fig;
+        auto heatmap = fig.add_heatmap();
+        heatmap.x(std::vector<double>{0.0, 1.0, 2.0, 3.0});
+        heatmap.y(std::vector<double>{0.0, 2.0, 4.0});  // NOLINT
+        heatmap.z(std::vector<std::vector<double>>{
+            {1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}, {7.0, 8.0, 9.0}});  // NOLINT
+
+        CHECK(compress_uniform_coordinates(fig.document(), min_size) == 2);
+
+        yyjson_mut_val* root = fig.document().root().internal_value();
+        yyjson_mut_val* trace = get_trace(root, 0);
+        CHECK(yyjson_mut_obj_get(trace, "x") == nullptr);
+        CHECK(get_number(trace, "x0") == 0.5);  // NOLINT(*-magic-numbers)
+        CHECK(get_number(trace, "dx") == 1.0);
+        CHECK(yyjson_mut_obj_get(trace, "y") == nullptr);
+        CHECK(get_number(trace, "y0") == 0.0);
+        CHECK(get_number(trace, "dy") == 2.0);  // NOLINT(*-magic-numbers)
+    }
+
+    SECTION("keep coordinates of heatmaps inconsistent with z") {
+        figure fig;
+        auto heatmap = fig.add_heatmap();
+        heatmap.x(std::vector<double>{0.0, 1.0, 2.0, 3.0, 4.0});  // NOLINT
+        heatmap.z(std::vector<std::vector<double>>{{1.0, 2.0, 3.0}});
+
+        CHECK(compress_uniform_coordinates(fig.document(), min_size) == 0);
+    }
+
+    SECTION("keep short or non-numeric coordinates") {
+        figure fig;
+        auto scatter1 = fig.add_scatter();
+        scatter1.x(std::vector<int>{1, 2});
+        auto scatter2 = fig.add_scatter();
+        scatter2.x(std::vector<const char*>{"a", "b", "c"});
+
+        CHECK(compress_uniform_coordinates(fig.document(), min_size) == 0);
+    }
+
+    SECTION("keep coordinates of unsupported traces") {
+        figure fig;
+        auto histogram = fig.add_histogram();
+        histogram.x(std::vector<int>{1, 2, 3, 4});
+
+        CHECK(compress_uniform_coordinates(fig.document(), min_size) == 0);
+    }
+
+    SECTION("compress coordinates in all frames") {
+        figure fig;
+        fig.add_scatter().x(std::vector<int>{1, 2, 3});
+        fig.add_frame().add_scatter().x(std::vector<int>{2, 4, 6});
+
+        CHECK(compress_uniform_coordinates(fig.document(), min_size) == 2);
+
+        yyjson_mut_val* root = fig.document().root().internal_value();
+        yyjson_mut_val* frame = yyjson_mut_arr_get_first(
+            yyjson_mut_obj_get(root, "frames"));
+        yyjson_mut_val* trace = get_trace(frame, 0);
+        CHECK(yyjson_mut_obj_get(trace, "x") == nullptr);
+        CHECK(get_number(trace, "x0") == 2.0);  // NOLINT(*-magic-numbers)
+        CHECK(get_number(trace, "dx") == 2.0);  // NOLINT(*-magic-numbers)
+    }
+
+    SECTION("keep coordinates when a frame can't be compressed") {
+        figure fig;
+        fig.add_scatter().x(std::vector<int>{1, 2, 3});
+        fig.add_frame().add_scatter().x(std::vector<int>{1, 2, 4});
+
+        CHECK(compress_uniform_coordinates(fig.document(), min_size) == 0);
+    }
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of encode_base64 function.
+ */
+#include "plotly_plotter/details/encode_base64.h"
+
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("plotly_plotter::details::encode_base64") {
+    using plotly_plotter::details::encode_base64;
+
+    SECTION("encode strings") {
+        CHECK(encode_base64("").empty());
+        CHECK(encode_base64("f") == "Zg==");
+        CHECK(encode_base64("fo") == "Zm8=");
+        CHECK(encode_base64("foo") == "Zm9v");
+        CHECK(encode_base64("foob") == "Zm9vYg==");
+        CHECK(encode_base64("fooba") == "Zm9vYmE=");
+        CHECK(encode_base64("foobar") == "Zm9vYmFy");
+    }
+
+    SECTION("encode binary data") {
+        const std::string input{'\x00', '\xFF', '\xFE'};
+        CHECK(encode_base64(input) == "AP/+");
+    }
+}
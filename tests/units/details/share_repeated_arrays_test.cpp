@@ -0,0 +1,81 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of share_repeated_arrays function.
+ */
+#include "plotly_plotter/details/share_repeated_arrays.h"
+
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "plotly_plotter/json_converter.h"  // IWYU pragma: keep
+#include "plotly_plotter/json_document.h"
+#include "plotly_plotter/json_value.h"
+
+TEST_CASE("plotly_plotter::details::share_repeated_arrays") {
+    using plotly_plotter::json_document;
+    using plotly_plotter::details::share_repeated_arrays;
+
+    SECTION("share repeated arrays") {
+        json_document document;
+        document.root()["a"] = std::vector<int>{1, 2, 3};
+        document.root()["b"]["c"] = std::vector<int>{1, 2, 3};
+        document.root()["b"]["d"] = std::vector<int>{4, 5, 6};
+        document.root()["e"] = std::vector<int>{4, 5, 6};
+        document.root()["f"] = std::vector<int>{1, 2, 3};
+        document.root()["g"] = std::vector<int>{7, 8, 9};
+
+        CHECK(share_repeated_arrays(document, 3) == 5);  // NOLINT
+
+        CHECK(document.serialize_to_string() ==
+            R"({"a":{"$shared_array":0},)"
+            R"("b":{"c":{"$shared_array":0},"d":{"$shared_array":1}},)"
+            R"("e":{"$shared_array":1},"f":{"$shared_array":0},)"
+            R"("g":[7,8,9],"shared_arrays":[[1,2,3],[4,5,6]]})");
+    }
+
+    SECTION("ignore short arrays") {
+        json_document document;
+        document.root()["a"] = std::vector<int>{1, 2, 3};
+        document.root()["b"] = std::vector<int>{1, 2, 3};
+
+        CHECK(share_repeated_arrays(document, 4) == 0);  // NOLINT
+
+        CHECK(document.serialize_to_string() == R"({"a":[1,2,3],"b":[1,2,3]})");
+    }
+
+    SECTION("ignore arrays with different types of elements") {
+        json_document document;
+        document.root()["a"] = std::vector<int>{1, 2, 3};
+        document.root()["b"] = std::vector<double>{1.0, 2.0, 3.0};
+
+        CHECK(share_repeated_arrays(document, 3) == 0);  // NOLINT
+    }
+
+    SECTION("share rows of nested arrays") {
+        json_document document;
+        document.root()["a"] = std::vector<std::vector<int>>{{1, 2}, {3, 4}};
+        document.root()["b"] = std::vector<int>{3, 4};
+
+        CHECK(share_repeated_arrays(document, 2) == 2);  // NOLINT
+
+        CHECK(document.serialize_to_string() ==
+            R"({"a":[[1,2],{"$shared_array":0}],"b":{"$shared_array":0},)"
+            R"("shared_arrays":[[3,4]]})");
+    }
+}
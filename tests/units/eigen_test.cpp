@@ -19,11 +19,15 @@
  */
 #include "plotly_plotter/eigen.h"
 
+#include <memory>
+#include <vector>
+
 #include <catch2/catch_test_macros.hpp>
 
+#include "plotly_plotter/data_table.h"
 #include "plotly_plotter/json_document.h"
 
-TEST_CASE("plotly_plotter::json_converter<Eigen::Matrix>") {
+TEST_CASE("plotly_plotter::json_converter<Eigen::DenseBase>") {
     using plotly_plotter::json_document;
 
     json_document document;
@@ -87,4 +91,183 @@ TEST_CASE("plotly_plotter::json_converter<Eigen::Matrix>") {
                   yyjson_mut_arr_get(document.root().internal_value(), 1),
                   2)) == 6);
     }
+
+    SECTION("convert a matrix in row-major order") {
+        using matrix_type =
+            Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic,
+                Eigen::RowMajor>;
+        // NOLINTNEXTLINE(*-magic-numbers)
+        document.root() = matrix_type{{1.5, 2.5}, {3.5, 4.5}};
+
+        CHECK(document.serialize_to_string() == "[[1.5,2.5],[3.5,4.5]]");
+    }
+
+    SECTION("convert a matrix to a typed array") {
+        // NOLINTNEXTLINE(*-magic-numbers)
+        const Eigen::MatrixXd matrix{{1.0, 2.0}, {3.0, 4.0}};
+
+        document.root() = plotly_plotter::as_typed_array(matrix);
+
+        CHECK(document.serialize_to_string() ==
+            R"({"dtype":"f8",)"
+            R"("bdata":"AAAAAAAA8D8AAAAAAAAAQAAAAAAAAAhAAAAAAAAAEEA=",)"
+            R"("shape":"2, 2"})");
+    }
+
+    SECTION("convert a map of a buffer") {
+        const std::vector<double> buffer{1.5, 2.5, 3.5, 4.5};
+
+        document.root() =
+            Eigen::Map<const Eigen::VectorXd>(buffer.data(), 3);
+
+        CHECK(document.serialize_to_string() == "[1.5,2.5,3.5]");
+    }
+
+    SECTION("convert a map of a buffer with an inner stride") {
+        const std::vector<int> buffer{1, 2, 3, 4, 5, 6};
+
+        document.root() =
+            Eigen::Map<const Eigen::VectorXi, 0, Eigen::InnerStride<>>(
+                buffer.data(), 3, Eigen::InnerStride<>(2));
+
+        CHECK(document.serialize_to_string() == "[1,3,5]");
+    }
+
+    SECTION("convert a block of a matrix") {
+        // NOLINTNEXTLINE(*-magic-numbers)
+        const Eigen::MatrixXi matrix{{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+
+        document.root() = matrix.block(1, 1, 2, 2);
+
+        CHECK(document.serialize_to_string() == "[[5,6],[8,9]]");
+    }
+
+    SECTION("convert a row of a matrix in column-major order") {
+        // NOLINTNEXTLINE(*-magic-numbers)
+        const Eigen::MatrixXi matrix{{1, 2, 3}, {4, 5, 6}};
+
+        document.root() = matrix.row(1);
+
+        CHECK(document.serialize_to_string() == "[4,5,6]");
+    }
+
+    SECTION("convert a reference to a matrix") {
+        // NOLINTNEXTLINE(*-magic-numbers)
+        const Eigen::MatrixXd matrix{{1.5, 2.5}, {3.5, 4.5}};
+        const Eigen::Ref<const Eigen::MatrixXd> ref = matrix;
+
+        document.root() = ref;
+
+        CHECK(document.serialize_to_string() == "[[1.5,2.5],[3.5,4.5]]");
+    }
+
+    SECTION("convert an array") {
+        // NOLINTNEXTLINE(*-magic-numbers)
+        document.root() = Eigen::ArrayXXd{{1.5, 2.5}, {3.5, 4.5}};
+
+        CHECK(document.serialize_to_string() == "[[1.5,2.5],[3.5,4.5]]");
+    }
+
+    SECTION("convert an expression of vectors") {
+        // NOLINTNEXTLINE(*-magic-numbers)
+        const Eigen::VectorXd a{{1.5, 5.0, 2.0}};
+        // NOLINTNEXTLINE(*-magic-numbers)
+        const Eigen::VectorXd b{{3.0, 1.5, 2.5}};
+
+        document.root() = (a - b).cwiseAbs();
+
+        CHECK(document.serialize_to_string() == "[1.5,3.5,0.5]");
+    }
+
+    SECTION("convert an expression of matrices") {
+        // NOLINTNEXTLINE(*-magic-numbers)
+        const Eigen::MatrixXi matrix{{1, 2, 3}, {4, 5, 6}};
+
+        document.root() = matrix * 2 + Eigen::MatrixXi::Ones(2, 3);
+
+        CHECK(document.serialize_to_string() == "[[3,5,7],[9,11,13]]");
+    }
+
+    SECTION("convert a large expression of matrices") {
+        constexpr Eigen::Index rows = 100;
+        constexpr Eigen::Index cols = 3;
+        const Eigen::MatrixXi matrix = Eigen::MatrixXi::Ones(rows, cols);
+
+        document.root() = matrix.transpose().transpose() * 2;
+
+        auto* root = document.root().internal_value();
+        REQUIRE(yyjson_mut_arr_size(root) == static_cast<std::size_t>(rows));
+        auto* last_row =
+            yyjson_mut_arr_get(root, static_cast<std::size_t>(rows - 1));
+        REQUIRE(yyjson_mut_arr_size(last_row) ==
+            static_cast<std::size_t>(cols));
+        CHECK(yyjson_mut_get_sint(yyjson_mut_arr_get(last_row, 2)) == 2);
+    }
+
+    SECTION("convert a product of matrices") {
+        // NOLINTNEXTLINE(*-magic-numbers)
+        const Eigen::MatrixXi a{{1, 2}, {3, 4}};
+        const Eigen::MatrixXi b{{0, 1}, {1, 0}};
+
+        document.root() = a * b;
+
+        CHECK(document.serialize_to_string() == "[[2,1],[4,3]]");
+    }
+
+    SECTION("convert a comparison of vectors") {
+        // NOLINTNEXTLINE(*-magic-numbers)
+        const Eigen::ArrayXd values{{1.0, -1.0, 2.0}};
+
+        document.root() = values > 0.0;
+
+        CHECK(document.serialize_to_string() == "[true,false,true]");
+    }
+
+    SECTION("convert a block of a matrix to a typed array") {
+        // NOLINTNEXTLINE(*-magic-numbers)
+        const Eigen::MatrixXd matrix{{1.0, 2.0, 0.0}, {3.0, 4.0, 0.0}};
+
+        document.root() =
+            plotly_plotter::as_typed_array(matrix.leftCols(2));
+
+        CHECK(document.serialize_to_string() ==
+            R"({"dtype":"f8",)"
+            R"("bdata":"AAAAAAAA8D8AAAAAAAAAQAAAAAAAAAhAAAAAAAAAEEA=",)"
+            R"("shape":"2, 2"})");
+    }
+}
+
+TEST_CASE("plotly_plotter::data_table with Eigen::Map") {
+    using plotly_plotter::data_table;
+    using plotly_plotter::json_document;
+
+    data_table table;
+    json_document document;
+
+    SECTION("append a column referring to a buffer") {
+        std::vector<double> buffer{1.5, 2.5, 3.5};
+
+        const auto column = table.emplace(
+            "x", Eigen::Map<const Eigen::VectorXd>(buffer.data(), 3));
+        buffer[1] = 5.5;  // NOLINT(*-magic-numbers)
+
+        CHECK(table.rows() == 3);
+        CHECK(column->as_double_vector() == std::vector<double>{1.5, 5.5, 3.5});
+        column->to_json(document.root());
+        CHECK(document.serialize_to_string() == "[1.5,5.5,3.5]");
+    }
+
+    SECTION("append a column referring to a buffer with an inner stride") {
+        const std::vector<int> buffer{1, 2, 3, 4, 5, 6};
+
+        const auto column = table.emplace("x",
+            Eigen::Map<const Eigen::VectorXi, 0, Eigen::InnerStride<>>(
+                buffer.data(), 3, Eigen::InnerStride<>(2)));
+
+        CHECK(column->size() == 3);
+        CHECK(column->get_range() == std::pair<double, double>{1.0, 5.0});
+        const auto [groups, indices] = column->generate_group();
+        CHECK(groups == std::vector<std::string>{"1", "3", "5"});
+        CHECK(indices == std::vector<std::size_t>{0, 1, 2});
+    }
 }
@@ -0,0 +1,177 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of bar class.
+ */
+#include "plotly_plotter/figure_builders/bar.h"
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "plotly_plotter/data_table.h"
+#include "plotly_plotter/figure_builders/aggregation_function.h"
+
+TEST_CASE("plotly_plotter::figure_builders::bar") {
+    using plotly_plotter::data_table;
+    using plotly_plotter::figure_builders::aggregation_function;
+    using plotly_plotter::figure_builders::bar;
+
+    data_table data;
+    // NOLINTBEGIN(*-magic-numbers)
+    data.emplace("x", std::vector<std::string>{"a", "b", "a", "b", "a", "c"});
+    data.emplace("y", std::vector<double>{1.5, 2.5, 3.5, 4.5, 5.5, 6.5});
+    data.emplace("number", std::vector<int>{10, 20, 10, 20, 10, 30});
+    // NOLINTEND(*-magic-numbers)
+    data.emplace(
+        "group", std::vector<std::string>{"A", "A", "A", "B", "B", "B"});
+
+    const auto trace_at = [](const plotly_plotter::figure& figure,
+                              std::size_t index) {
+        return yyjson_mut_arr_get(
+            figure.document().root().at("data").internal_value(), index);
+    };
+
+    SECTION("build a bar for each row") {
+        const auto figure = bar(data).x("x").y("y").create();
+
+        yyjson_mut_val* trace = trace_at(figure, 0);
+        REQUIRE(trace != nullptr);
+        CHECK(yyjson_mut_arr_size(yyjson_mut_obj_get(trace, "y")) == 6);
+    }
+
+    SECTION("count rows") {
+        const auto figure =
+            bar(data).x("x").function(aggregation_function::count).create();
+
+        yyjson_mut_val* trace = trace_at(figure, 0);
+        yyjson_mut_val* x = yyjson_mut_obj_get(trace, "x");
+        yyjson_mut_val* y = yyjson_mut_obj_get(trace, "y");
+        REQUIRE(yyjson_mut_arr_size(x) == 3);
+        CHECK(yyjson_mut_equals_str(yyjson_mut_arr_get(x, 0), "a"));
+        CHECK(yyjson_mut_equals_str(yyjson_mut_arr_get(x, 2), "c"));
+        REQUIRE(yyjson_mut_arr_size(y) == 3);
+        // NOLINTNEXTLINE(*-magic-numbers)
+        CHECK(yyjson_mut_get_real(yyjson_mut_arr_get(y, 0)) == 3.0);
+        auto title = figure.document().root().at("layout").at("title");
+        CHECK(yyjson_mut_equals_str(
+            title.at("text").internal_value(), "count"));
+    }
+
+    SECTION("aggregate values in groups") {
+        const auto figure = bar(data)
+                                .x("x")
+                                .y("y")
+                                .group("group")
+                                .function(aggregation_function::average)
+                                .create();
+
+        yyjson_mut_val* traces =
+            figure.document().root().at("data").internal_value();
+        REQUIRE(yyjson_mut_arr_size(traces) == 2);
+        yyjson_mut_val* x = yyjson_mut_obj_get(trace_at(figure, 0), "x");
+        yyjson_mut_val* y = yyjson_mut_obj_get(trace_at(figure, 0), "y");
+        REQUIRE(yyjson_mut_arr_size(y) == 2);
+        CHECK(yyjson_mut_equals_str(yyjson_mut_arr_get(x, 0), "a"));
+        CHECK_THAT(yyjson_mut_get_real(yyjson_mut_arr_get(y, 0)),
+            Catch::Matchers::WithinRel(2.5));  // NOLINT(*-magic-numbers)
+        // Group B has x = b, a, c in the order of rows, but bars are sorted
+        // in the order of the first rows in the whole data.
+        x = yyjson_mut_obj_get(trace_at(figure, 1), "x");
+        CHECK(yyjson_mut_equals_str(yyjson_mut_arr_get(x, 0), "a"));
+        CHECK(yyjson_mut_equals_str(yyjson_mut_arr_get(x, 1), "b"));
+    }
+
+    SECTION("aggregate values with numeric x coordinates") {
+        const auto figure = bar(data)
+                                .x("number")
+                                .y("y")
+                                .function(aggregation_function::quantile)
+                                .quantile_probability(1.0)
+                                .create();
+
+        yyjson_mut_val* x = yyjson_mut_obj_get(trace_at(figure, 0), "x");
+        yyjson_mut_val* y = yyjson_mut_obj_get(trace_at(figure, 0), "y");
+        REQUIRE(yyjson_mut_arr_size(x) == 3);
+        // NOLINTBEGIN(*-magic-numbers)
+        CHECK(yyjson_mut_get_real(yyjson_mut_arr_get(x, 1)) == 20.0);
+        CHECK_THAT(yyjson_mut_get_real(yyjson_mut_arr_get(y, 1)),
+            Catch::Matchers::WithinRel(4.5));
+        // NOLINTEND(*-magic-numbers)
+    }
+
+    SECTION("build aggregated values repeatedly with changed settings") {
+        const auto y_range_of = [](const plotly_plotter::figure& figure) {
+            yyjson_mut_val* range = figure.document()
+                                        .root()
+                                        .at("layout")
+                                        .at("yaxis")
+                                        .at("range")
+                                        .internal_value();
+            return std::vector<double>{
+                yyjson_mut_get_real(yyjson_mut_arr_get(range, 0)),
+                yyjson_mut_get_real(yyjson_mut_arr_get(range, 1))};
+        };
+        const auto expected_figure = bar(data)
+                                         .x("group")
+                                         .y("y")
+                                         .animation_frame("number")
+                                         .function(aggregation_function::sum)
+                                         .create();
+
+        auto builder = bar(data);
+        builder.x("x")
+            .y("y")
+            .animation_frame("number")
+            .function(aggregation_function::count);
+        (void)builder.create();
+        (void)builder.create();
+        builder.x("group").function(aggregation_function::sum);
+        const auto figure = builder.create();
+
+        yyjson_mut_val* x = yyjson_mut_obj_get(trace_at(figure, 0), "x");
+        REQUIRE(yyjson_mut_arr_size(x) == 2);
+        CHECK(yyjson_mut_equals_str(yyjson_mut_arr_get(x, 0), "A"));
+        CHECK(yyjson_mut_equals_str(yyjson_mut_arr_get(x, 1), "B"));
+        CHECK(y_range_of(figure) == y_range_of(expected_figure));
+    }
+
+    SECTION("try to aggregate values without y") {
+        CHECK_THROWS(
+            bar(data).x("x").function(aggregation_function::sum).create());
+    }
+
+    SECTION("try to downsample rows of aggregated values") {
+        CHECK_THROWS_AS(bar(data)
+                            .x("x")
+                            .function(aggregation_function::count)
+                            .row_budget(3,
+                                plotly_plotter::figure_builders::
+                                    row_budget_policy::downsample)
+                            .create(),
+            std::runtime_error);
+    }
+
+    SECTION("try to set an invalid probability") {
+        CHECK_THROWS_AS(
+            bar(data).quantile_probability(2.0), std::invalid_argument);
+    }
+}
@@ -19,12 +19,15 @@
  */
 #include "plotly_plotter/figure_builders/box.h"
 
+#include <cstddef>
 #include <stdexcept>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include <ApprovalTests.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
 
 #include "plotly_plotter/data_table.h"
 #include "plotly_plotter/write_html.h"
@@ -299,6 +302,103 @@ TEST_CASE("plotly_plotter::figure_builders::box") {
             ApprovalTests::Options().fileOptions().withFileExtension(".html"));
     }
 
+    SECTION("build with precomputed statistics") {
+        data_table data;
+        std::vector<std::string> x(11, "A");
+        x.insert(x.end(), 3, "B");
+        data.emplace("x", x);
+        // NOLINTBEGIN(*-magic-numbers)
+        data.emplace("y",
+            std::vector<double>{7, 100, 3, 1, 9, 4, 10, 2, 6, 8, 5, 1, 2, 3});
+        // NOLINTEND(*-magic-numbers)
+
+        const auto figure =
+            box(data).x("x").y("y").precompute_statistics(true).create();
+
+        yyjson_mut_val* trace = yyjson_mut_arr_get(
+            figure.document().root().at("data").internal_value(), 0);
+        REQUIRE(trace != nullptr);
+        yyjson_mut_val* categories = yyjson_mut_obj_get(trace, "x");
+        REQUIRE(yyjson_mut_arr_size(categories) == 2);
+        CHECK(yyjson_mut_equals_str(yyjson_mut_arr_get(categories, 0), "A"));
+        CHECK(yyjson_mut_equals_str(yyjson_mut_arr_get(categories, 1), "B"));
+        const auto value_at = [trace](const char* key, std::size_t index) {
+            return yyjson_mut_get_real(
+                yyjson_mut_arr_get(yyjson_mut_obj_get(trace, key), index));
+        };
+        // NOLINTBEGIN(*-magic-numbers)
+        CHECK_THAT(value_at("q1", 0), Catch::Matchers::WithinRel(3.25));
+        CHECK_THAT(value_at("median", 0), Catch::Matchers::WithinRel(6.0));
+        CHECK_THAT(value_at("q3", 0), Catch::Matchers::WithinRel(8.75));
+        CHECK_THAT(value_at("lowerfence", 0), Catch::Matchers::WithinRel(1.0));
+        CHECK_THAT(
+            value_at("upperfence", 0), Catch::Matchers::WithinRel(10.0));
+        CHECK_THAT(value_at("q1", 1), Catch::Matchers::WithinRel(1.25));
+        CHECK_THAT(value_at("median", 1), Catch::Matchers::WithinRel(2.0));
+        CHECK_THAT(value_at("q3", 1), Catch::Matchers::WithinRel(2.75));
+        // NOLINTEND(*-magic-numbers)
+
+        // Only outliers are written as points.
+        yyjson_mut_val* points = yyjson_mut_obj_get(trace, "y");
+        REQUIRE(yyjson_mut_arr_size(points) == 2);
+        REQUIRE(yyjson_mut_arr_size(yyjson_mut_arr_get(points, 0)) == 1);
+        CHECK_THAT(yyjson_mut_get_real(yyjson_mut_arr_get(
+                       yyjson_mut_arr_get(points, 0), 0)),
+            Catch::Matchers::WithinRel(100.0));  // NOLINT(*-magic-numbers)
+        CHECK(yyjson_mut_arr_size(yyjson_mut_arr_get(points, 1)) == 0);
+    }
+
+    SECTION("build with precomputed statistics of numeric x") {
+        data_table data;
+        data.emplace("x", std::vector<int>{2, 1, 2, 1, 2});
+        // NOLINTNEXTLINE(*-magic-numbers)
+        data.emplace("y", std::vector<double>{1, 2, 3, 4, 5});
+
+        const auto figure =
+            box(data).x("x").y("y").precompute_statistics(true).create();
+
+        yyjson_mut_val* trace = yyjson_mut_arr_get(
+            figure.document().root().at("data").internal_value(), 0);
+        REQUIRE(trace != nullptr);
+        // Values of x are kept numeric not to change the axis to a
+        // categorical one.
+        yyjson_mut_val* x_values = yyjson_mut_obj_get(trace, "x");
+        REQUIRE(yyjson_mut_arr_size(x_values) == 2);
+        CHECK(yyjson_mut_is_int(yyjson_mut_arr_get(x_values, 0)));
+        CHECK(yyjson_mut_get_int(yyjson_mut_arr_get(x_values, 0)) == 2);
+        CHECK(yyjson_mut_get_int(yyjson_mut_arr_get(x_values, 1)) == 1);
+        CHECK_THAT(yyjson_mut_get_real(yyjson_mut_arr_get(
+                       yyjson_mut_obj_get(trace, "median"), 0)),
+            Catch::Matchers::WithinRel(3.0));  // NOLINT(*-magic-numbers)
+    }
+
+    SECTION("build with precomputed statistics without points") {
+        data_table data;
+        // NOLINTNEXTLINE(*-magic-numbers)
+        data.emplace("y", std::vector<int>{1, 2, 3, 5, 10});
+
+        const auto figure = box(data)
+                                .y("y")
+                                .box_points("false")
+                                .precompute_statistics(true)
+                                .create();
+
+        yyjson_mut_val* trace = yyjson_mut_arr_get(
+            figure.document().root().at("data").internal_value(), 0);
+        REQUIRE(trace != nullptr);
+        CHECK(yyjson_mut_obj_get(trace, "x") == nullptr);
+        CHECK(yyjson_mut_obj_get(trace, "y") == nullptr);
+        CHECK(yyjson_mut_arr_size(yyjson_mut_obj_get(trace, "median")) == 1);
+    }
+
+    SECTION("try to precompute statistics of non-numeric values") {
+        data_table data;
+        data.emplace("y", std::vector<std::string>{"a", "b"});
+
+        REQUIRE_THROWS_AS(box(data).y("y").precompute_statistics(true).create(),
+            std::runtime_error);
+    }
+
     SECTION("try to build without y") {
         data_table data;
         data.emplace("x", std::vector<int>{1, 2, 3});
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of density_heatmap class.
+ */
+#include "plotly_plotter/figure_builders/density_heatmap.h"
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "plotly_plotter/data_table.h"
+#include "plotly_plotter/figure_builders/aggregation_function.h"
+
+TEST_CASE("plotly_plotter::figure_builders::density_heatmap") {
+    using plotly_plotter::data_table;
+    using plotly_plotter::figure_builders::density_heatmap;
+    using plotly_plotter::figure_builders::aggregation_function;
+
+    data_table data;
+    // NOLINTBEGIN(*-magic-numbers)
+    data.emplace("x", std::vector<double>{0.5, 0.5, 1.5, 1.5, 1.5, 0.5});
+    data.emplace("y", std::vector<double>{0.5, 1.5, 0.5, 1.5, 1.5, 0.5});
+    data.emplace("z", std::vector<double>{1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+    // NOLINTEND(*-magic-numbers)
+    data.emplace(
+        "group", std::vector<std::string>{"A", "A", "A", "B", "B", "B"});
+
+    const auto trace_at = [](const plotly_plotter::figure& figure,
+                              std::size_t index) {
+        return yyjson_mut_arr_get(
+            figure.document().root().at("data").internal_value(), index);
+    };
+
+    SECTION("build with minimal settings") {
+        const auto figure = density_heatmap(data).x("x").y("y").create();
+
+        yyjson_mut_val* trace = trace_at(figure, 0);
+        REQUIRE(trace != nullptr);
+        CHECK(yyjson_mut_equals_str(
+            yyjson_mut_obj_get(trace, "type"), "heatmap"));
+        yyjson_mut_val* z = yyjson_mut_obj_get(trace, "z");
+        yyjson_mut_val* x = yyjson_mut_obj_get(trace, "x");
+        // Edges of bins are one more than bins.
+        CHECK(yyjson_mut_arr_size(x) ==
+            yyjson_mut_arr_size(yyjson_mut_arr_get_first(z)) + 1);
+    }
+
+    SECTION("build with groups and an aggregation") {
+        const auto figure = density_heatmap(data)
+                                .x("x")
+                                .y("y")
+                                .z("z")
+                                .function(aggregation_function::sum)
+                                .fixed_bin_width_x(1.0)
+                                .fixed_bin_width_y(1.0)
+                                .group("group")
+                                .create();
+
+        yyjson_mut_val* traces =
+            figure.document().root().at("data").internal_value();
+        REQUIRE(yyjson_mut_arr_size(traces) == 2);
+        // All values are in a single bin.
+        yyjson_mut_val* z = yyjson_mut_obj_get(trace_at(figure, 1), "z");
+        REQUIRE(yyjson_mut_arr_size(z) == 1);
+        CHECK(yyjson_mut_get_real(
+                  yyjson_mut_arr_get(yyjson_mut_arr_get(z, 0), 0)) == 15.0);
+    }
+
+    SECTION("try to build without y") {
+        CHECK_THROWS(density_heatmap(data).x("x").create());
+    }
+
+    SECTION("try to build an aggregation without z") {
+        CHECK_THROWS(density_heatmap(data)
+                .x("x")
+                .y("y")
+                .function(aggregation_function::average)
+                .create());
+    }
+
+    SECTION("try to use quantiles") {
+        CHECK_THROWS_AS(
+            density_heatmap(data).function(aggregation_function::quantile),
+            std::invalid_argument);
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of calculate_box_statistics function.
+ */
+#include "plotly_plotter/figure_builders/details/box_statistics.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+TEST_CASE(
+    "plotly_plotter::figure_builders::details::calculate_box_statistics") {
+    using plotly_plotter::figure_builders::details::calculate_box_statistics;
+
+    SECTION("calculate statistics") {
+        // NOLINTNEXTLINE(*-magic-numbers)
+        std::vector<double> values{7, 100, 3, 1, 9, 4, 10, 2, 6, 8, 5};
+
+        const auto statistics = calculate_box_statistics(values);
+
+        // NOLINTBEGIN(*-magic-numbers)
+        CHECK_THAT(statistics.q1, Catch::Matchers::WithinRel(3.25));
+        CHECK_THAT(statistics.median, Catch::Matchers::WithinRel(6.0));
+        CHECK_THAT(statistics.q3, Catch::Matchers::WithinRel(8.75));
+        CHECK_THAT(statistics.lower_fence, Catch::Matchers::WithinRel(1.0));
+        CHECK_THAT(statistics.upper_fence, Catch::Matchers::WithinRel(10.0));
+        CHECK_THAT(statistics.mean, Catch::Matchers::WithinRel(155.0 / 11.0));
+        CHECK_THAT(statistics.sd,
+            Catch::Matchers::WithinRel(27.304526915561908, 1e-6));
+        // NOLINTEND(*-magic-numbers)
+    }
+
+    SECTION("calculate statistics of a value") {
+        std::vector<double> values{2.5};  // NOLINT(*-magic-numbers)
+
+        const auto statistics = calculate_box_statistics(values);
+
+        // NOLINTBEGIN(*-magic-numbers)
+        CHECK_THAT(statistics.q1, Catch::Matchers::WithinRel(2.5));
+        CHECK_THAT(statistics.median, Catch::Matchers::WithinRel(2.5));
+        CHECK_THAT(statistics.q3, Catch::Matchers::WithinRel(2.5));
+        CHECK_THAT(statistics.lower_fence, Catch::Matchers::WithinRel(2.5));
+        CHECK_THAT(statistics.upper_fence, Catch::Matchers::WithinRel(2.5));
+        CHECK(statistics.sd == 0.0);
+        // NOLINTEND(*-magic-numbers)
+    }
+
+    SECTION("calculate statistics of no value") {
+        std::vector<double> values;
+
+        const auto statistics = calculate_box_statistics(values);
+
+        CHECK(std::isnan(statistics.q1));
+        CHECK(std::isnan(statistics.median));
+        CHECK(std::isnan(statistics.sd));
+    }
+
+    SECTION("compare quantiles with sorting") {
+        constexpr std::size_t size = 1000;
+        std::mt19937 engine(12345);  // NOLINT(*-magic-numbers)
+        std::normal_distribution<double> distribution;
+        std::vector<double> values;
+        for (std::size_t i = 0; i < size; ++i) {
+            values.push_back(distribution(engine));
+        }
+        std::vector<double> sorted = values;
+        std::sort(sorted.begin(), sorted.end());
+
+        const auto statistics = calculate_box_statistics(values);
+
+        // Positions are 249.5, 499.5, and 749.5 in plotly.js.
+        // NOLINTBEGIN(*-magic-numbers)
+        CHECK_THAT(statistics.q1,
+            Catch::Matchers::WithinRel(0.5 * (sorted[249] + sorted[250])));
+        CHECK_THAT(statistics.median,
+            Catch::Matchers::WithinRel(0.5 * (sorted[499] + sorted[500])));
+        CHECK_THAT(statistics.q3,
+            Catch::Matchers::WithinRel(0.5 * (sorted[749] + sorted[750])));
+        // NOLINTEND(*-magic-numbers)
+    }
+}
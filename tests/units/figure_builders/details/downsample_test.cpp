@@ -0,0 +1,130 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of downsample function.
+ */
+#include "plotly_plotter/figure_builders/details/downsample.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "plotly_plotter/data_column.h"
+#include "plotly_plotter/figure_builders/figure_builder_base.h"
+
+TEST_CASE("plotly_plotter::figure_builders::details::downsample") {
+    using plotly_plotter::data_column;
+    using plotly_plotter::figure_builders::downsampling_method;
+    using plotly_plotter::figure_builders::details::downsample;
+
+    constexpr std::size_t num_rows = 1000;
+    std::vector<double> x_values;
+    std::vector<double> y_values;
+    for (std::size_t i = 0; i < num_rows; ++i) {
+        x_values.push_back(static_cast<double>(i));
+        y_values.push_back(std::sin(static_cast<double>(i) * 0.1));
+    }
+    // Spike which must be kept in the downsampled data.
+    constexpr std::size_t spike_index = 501;
+    y_values[spike_index] = 100.0;  // NOLINT(*-magic-numbers)
+    const data_column<double> x(x_values);
+    const data_column<double> y(y_values);
+    const std::vector<bool> parent_mask(num_rows, true);
+    constexpr std::size_t max_points = 100;
+
+    const auto count = [](const std::vector<bool>& mask) {
+        return static_cast<std::size_t>(
+            std::count(mask.begin(), mask.end(), true));
+    };
+
+    SECTION("no downsampling") {
+        const auto mask = downsample(
+            downsampling_method::none, &x, y, parent_mask, max_points);
+        CHECK(mask == parent_mask);
+    }
+
+    SECTION("no downsampling for small data") {
+        const auto mask = downsample(
+            downsampling_method::lttb, &x, y, parent_mask, num_rows);
+        CHECK(mask == parent_mask);
+    }
+
+    SECTION("downsample using LTTB") {
+        const auto mask = downsample(
+            downsampling_method::lttb, &x, y, parent_mask, max_points);
+        CHECK(count(mask) == max_points);
+        CHECK(mask.front());
+        CHECK(mask.back());
+        CHECK(mask[spike_index]);
+    }
+
+    SECTION("downsample using LTTB without x") {
+        const auto mask = downsample(
+            downsampling_method::lttb, nullptr, y, parent_mask, max_points);
+        CHECK(count(mask) == max_points);
+        CHECK(mask[spike_index]);
+    }
+
+    SECTION("downsample using minimum and maximum values") {
+        const auto mask = downsample(
+            downsampling_method::min_max, &x, y, parent_mask, max_points);
+        CHECK(count(mask) <= max_points);
+        CHECK(count(mask) > max_points / 2);
+        CHECK(mask[spike_index]);
+    }
+
+    SECTION("downsample at a regular interval") {
+        const auto mask = downsample(
+            downsampling_method::every_nth, &x, y, parent_mask, max_points);
+        CHECK(count(mask) == max_points);
+        CHECK(mask[0]);
+        CHECK_FALSE(mask[1]);
+        CHECK(mask[10]);  // NOLINT(*-magic-numbers)
+    }
+
+    SECTION("downsample only values in the parent mask") {
+        std::vector<bool> group_mask(num_rows, false);
+        for (std::size_t i = 0; i < num_rows; i += 2) {
+            group_mask[i] = true;
+        }
+        const auto mask = downsample(
+            downsampling_method::lttb, &x, y, group_mask, max_points);
+        CHECK(count(mask) == max_points);
+        for (std::size_t i = 1; i < num_rows; i += 2) {
+            CHECK_FALSE(mask[i]);
+        }
+    }
+
+    SECTION("downsample non-numeric data at a regular interval") {
+        const data_column<std::string> labels(
+            std::vector<std::string>(num_rows, "a"));
+        const auto mask = downsample(
+            downsampling_method::lttb, &x, labels, parent_mask, max_points);
+        CHECK(count(mask) == max_points);
+        CHECK(mask[0]);
+        CHECK_FALSE(mask[1]);
+    }
+
+    SECTION("try to downsample to no point") {
+        CHECK_THROWS(
+            downsample(downsampling_method::lttb, &x, y, parent_mask, 0));
+    }
+}
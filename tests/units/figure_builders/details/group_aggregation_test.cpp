@@ -0,0 +1,167 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of internal functions to aggregate values in groups.
+ */
+#include "plotly_plotter/figure_builders/details/group_aggregation.h"
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "plotly_plotter/figure_builders/aggregation_function.h"
+#include "plotly_plotter/figure_builders/details/group_accumulator.h"
+
+TEST_CASE("plotly_plotter::figure_builders::details::aggregate_groups") {
+    using plotly_plotter::figure_builders::aggregation_function;
+    using plotly_plotter::figure_builders::details::aggregate_groups;
+
+    // NOLINTBEGIN(*-magic-numbers)
+    const std::vector<std::size_t> keys{0, 2, 0, 2, 2, 0, 3};
+    const std::vector<double> values{
+        1.0, 2.0, 3.0, 4.0, 6.0, 8.0, std::nan("")};
+    constexpr std::size_t num_keys = 4;
+
+    SECTION("count rows") {
+        const auto result =
+            aggregate_groups(keys, num_keys, {}, aggregation_function::count);
+
+        CHECK(result.keys == std::vector<std::size_t>{0, 2, 3});
+        CHECK(result.values == std::vector<double>{3.0, 3.0, 1.0});
+    }
+
+    SECTION("count values") {
+        const auto result = aggregate_groups(
+            keys, num_keys, values, aggregation_function::count);
+
+        // NaN values are ignored.
+        CHECK(result.keys == std::vector<std::size_t>{0, 2});
+        CHECK(result.values == std::vector<double>{3.0, 3.0});
+    }
+
+    SECTION("sum") {
+        const auto result =
+            aggregate_groups(keys, num_keys, values, aggregation_function::sum);
+
+        CHECK(result.keys == std::vector<std::size_t>{0, 2});
+        CHECK(result.values == std::vector<double>{12.0, 12.0});
+    }
+
+    SECTION("average") {
+        const auto result = aggregate_groups(
+            keys, num_keys, values, aggregation_function::average);
+
+        CHECK(result.values == std::vector<double>{4.0, 4.0});
+    }
+
+    SECTION("minimum and maximum") {
+        const auto minimum = aggregate_groups(
+            keys, num_keys, values, aggregation_function::minimum);
+        const auto maximum = aggregate_groups(
+            keys, num_keys, values, aggregation_function::maximum);
+
+        CHECK(minimum.values == std::vector<double>{1.0, 2.0});
+        CHECK(maximum.values == std::vector<double>{8.0, 6.0});
+    }
+
+    SECTION("quantile") {
+        const auto median = aggregate_groups(
+            keys, num_keys, values, aggregation_function::quantile);
+        const auto quartile = aggregate_groups(
+            keys, num_keys, values, aggregation_function::quantile, 0.25);
+        const auto maximum = aggregate_groups(
+            keys, num_keys, values, aggregation_function::quantile, 1.0);
+
+        CHECK(median.keys == std::vector<std::size_t>{0, 2});
+        CHECK(median.values == std::vector<double>{3.0, 4.0});
+        // Quantiles are defined as in plotly.js.
+        CHECK_THAT(quartile.values[0], Catch::Matchers::WithinRel(1.5));
+        CHECK_THAT(quartile.values[1], Catch::Matchers::WithinRel(2.5));
+        CHECK(maximum.values == std::vector<double>{8.0, 6.0});
+    }
+
+    SECTION("aggregate many values using threads") {
+        constexpr std::size_t num_values = 600000;
+        std::vector<std::size_t> many_keys(num_values);
+        std::vector<double> many_values(num_values);
+        for (std::size_t i = 0; i < num_values; ++i) {
+            many_keys[i] = i % 3;
+            many_values[i] = static_cast<double>(i % 2);
+        }
+
+        const auto count = aggregate_groups(
+            many_keys, 3, many_values, aggregation_function::count);
+        const auto sum = aggregate_groups(
+            many_keys, 3, many_values, aggregation_function::sum);
+
+        CHECK(count.values ==
+            std::vector<double>(3, static_cast<double>(num_values / 3)));
+        CHECK(sum.values ==
+            std::vector<double>(3, static_cast<double>(num_values / 6)));
+    }
+
+    SECTION("try to aggregate with invalid arguments") {
+        CHECK_THROWS(aggregate_groups(keys, num_keys,
+            std::vector<double>{1.0}, aggregation_function::sum));
+        CHECK_THROWS(aggregate_groups(
+            keys, num_keys, values, aggregation_function::quantile, 1.5));
+    }
+    // NOLINTEND(*-magic-numbers)
+}
+
+TEST_CASE("plotly_plotter::figure_builders::details::accumulate_groups") {
+    using plotly_plotter::figure_builders::aggregation_function;
+    using plotly_plotter::figure_builders::details::accumulate_groups;
+    using plotly_plotter::figure_builders::details::group_accumulator;
+
+    constexpr std::size_t num_keys = 3;
+    constexpr std::size_t num_values = 600000;
+
+    SECTION("propagate an exception in the calling thread") {
+        const auto accumulate = [](group_accumulator& /*accumulator*/,
+                                    std::size_t begin, std::size_t /*end*/) {
+            if (begin == 0) {
+                throw std::runtime_error("Test exception.");
+            }
+        };
+
+        CHECK_THROWS_AS((void)accumulate_groups(num_keys, num_values,
+                            aggregation_function::count, accumulate),
+            std::runtime_error);
+    }
+
+    SECTION("propagate an exception in other threads") {
+        if (std::thread::hardware_concurrency() <= 1) {
+            return;  // Threads are not used in this environment.
+        }
+        const auto accumulate = [](group_accumulator& /*accumulator*/,
+                                    std::size_t begin, std::size_t /*end*/) {
+            if (begin != 0) {
+                throw std::runtime_error("Test exception.");
+            }
+        };
+
+        CHECK_THROWS_AS((void)accumulate_groups(num_keys, num_values,
+                            aggregation_function::count, accumulate),
+            std::runtime_error);
+    }
+}
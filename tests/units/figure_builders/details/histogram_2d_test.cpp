@@ -0,0 +1,187 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of internal functions of 2D histograms.
+ */
+#include "plotly_plotter/figure_builders/details/histogram_2d.h"
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "plotly_plotter/data_column.h"
+#include "plotly_plotter/figure_builders/aggregation_function.h"
+#include "plotly_plotter/utils/calculate_histogram_bin_width.h"
+
+TEST_CASE("plotly_plotter::figure_builders::details::create_histogram_axis") {
+    using plotly_plotter::data_column;
+    using plotly_plotter::figure_builders::details::create_histogram_axis;
+    using plotly_plotter::utils::histogram_bin_width_method;
+
+    SECTION("create bins with a fixed width") {
+        // NOLINTNEXTLINE(*-magic-numbers)
+        const data_column<double> column(std::vector<double>{0.0, 1.0, 10.0});
+
+        const auto axis = create_histogram_axis(
+            column, false, 2.0, histogram_bin_width_method::freedman_diaconis);
+
+        CHECK(axis.min == 0.0);
+        CHECK_THAT(axis.bin_width, Catch::Matchers::WithinRel(2.0));
+        CHECK(axis.num_bins == 5);
+        CHECK(axis.bin_index(0.0) == 0);
+        CHECK(axis.bin_index(1.9) == 0);   // NOLINT(*-magic-numbers)
+        CHECK(axis.bin_index(2.0) == 1);   // NOLINT(*-magic-numbers)
+        CHECK(axis.bin_index(10.0) == 4);  // NOLINT(*-magic-numbers)
+        CHECK(axis.bin_index(-1.0) == 5);
+        CHECK(axis.bin_index(10.1) == 5);  // NOLINT(*-magic-numbers)
+        CHECK(axis.bin_index(std::nan("")) == 5);
+        CHECK(axis.edges().size() == 6);
+    }
+
+    SECTION("create bins in log scale") {
+        const data_column<double> column(
+            // NOLINTNEXTLINE(*-magic-numbers)
+            std::vector<double>{-1.0, 1.0, 10.0, 100.0});
+
+        const auto axis = create_histogram_axis(
+            column, true, 1.0, histogram_bin_width_method::freedman_diaconis);
+
+        CHECK(axis.min == 0.0);
+        CHECK(axis.num_bins == 2);
+        CHECK(axis.bin_index(-1.0) == 2);
+        CHECK(axis.bin_index(5.0) == 0);   // NOLINT(*-magic-numbers)
+        CHECK(axis.bin_index(50.0) == 1);  // NOLINT(*-magic-numbers)
+        const auto edges = axis.edges();
+        REQUIRE(edges.size() == 3);
+        // NOLINTNEXTLINE(*-magic-numbers)
+        CHECK_THAT(edges[2], Catch::Matchers::WithinRel(100.0));
+    }
+
+    SECTION("limit the number of bins") {
+        // NOLINTNEXTLINE(*-magic-numbers)
+        const data_column<double> column(std::vector<double>{0.0, 100.0});
+
+        const auto axis = create_histogram_axis(column, false, 1e-6,
+            histogram_bin_width_method::freedman_diaconis, 10);
+
+        CHECK(axis.num_bins == 10);
+        CHECK_THAT(axis.bin_width, Catch::Matchers::WithinRel(10.0));
+    }
+
+    SECTION("create a bin for constant values") {
+        const data_column<double> column(std::vector<double>{1.0, 1.0});
+
+        const auto axis = create_histogram_axis(
+            column, false, 0.5, histogram_bin_width_method::freedman_diaconis);
+
+        CHECK(axis.num_bins == 1);
+        CHECK(axis.bin_index(1.0) == 0);
+    }
+}
+
+TEST_CASE("plotly_plotter::figure_builders::details::compute_histogram_2d") {
+    using plotly_plotter::figure_builders::aggregation_function;
+    using plotly_plotter::figure_builders::details::compute_histogram_2d;
+    using plotly_plotter::figure_builders::details::histogram_axis;
+
+    histogram_axis x_axis;
+    x_axis.min = 0.0;
+    x_axis.bin_width = 1.0;
+    x_axis.num_bins = 2;
+    histogram_axis y_axis;
+    y_axis.min = 0.0;
+    y_axis.bin_width = 1.0;
+    y_axis.num_bins = 3;
+
+    // NOLINTBEGIN(*-magic-numbers)
+    const std::vector<double> x{0.5, 0.5, 1.5, 1.5, 5.0};
+    const std::vector<double> y{0.5, 0.5, 2.5, 0.5, 0.5};
+    const std::vector<double> z{1.0, 3.0, 5.0, 7.0, 9.0};
+    // NOLINTEND(*-magic-numbers)
+
+    SECTION("count") {
+        const auto values = compute_histogram_2d(
+            x_axis, y_axis, x, y, {}, aggregation_function::count);
+
+        REQUIRE(values.size() == 3);
+        REQUIRE(values[0].size() == 2);
+        CHECK(values[0][0] == 2.0);
+        CHECK(values[0][1] == 1.0);
+        CHECK(values[1][0] == 0.0);
+        CHECK(values[2][1] == 1.0);
+    }
+
+    SECTION("sum") {
+        const auto values = compute_histogram_2d(
+            x_axis, y_axis, x, y, z, aggregation_function::sum);
+
+        CHECK(values[0][0] == 4.0);
+        CHECK(values[0][1] == 7.0);
+        CHECK(values[1][0] == 0.0);
+    }
+
+    SECTION("average") {
+        const auto values = compute_histogram_2d(
+            x_axis, y_axis, x, y, z, aggregation_function::average);
+
+        CHECK(values[0][0] == 2.0);
+        CHECK(std::isnan(values[1][0]));
+    }
+
+    SECTION("minimum and maximum") {
+        const auto minimum = compute_histogram_2d(
+            x_axis, y_axis, x, y, z, aggregation_function::minimum);
+        const auto maximum = compute_histogram_2d(
+            x_axis, y_axis, x, y, z, aggregation_function::maximum);
+
+        CHECK(minimum[0][0] == 1.0);
+        CHECK(maximum[0][0] == 3.0);
+        CHECK(std::isnan(maximum[1][1]));
+    }
+
+    SECTION("count many values using threads") {
+        constexpr std::size_t num_values = 600000;
+        std::vector<double> many_x(num_values);
+        std::vector<double> many_y(num_values);
+        for (std::size_t i = 0; i < num_values; ++i) {
+            many_x[i] = static_cast<double>(i % 2) + 0.5;  // NOLINT
+            many_y[i] = static_cast<double>(i % 3) + 0.5;  // NOLINT
+        }
+
+        const auto values = compute_histogram_2d(
+            x_axis, y_axis, many_x, many_y, {}, aggregation_function::count);
+
+        double total = 0.0;
+        for (const auto& row : values) {
+            for (const double value : row) {
+                total += value;
+            }
+        }
+        CHECK(total == static_cast<double>(num_values));
+        CHECK(values[0][0] == static_cast<double>(num_values / 6));
+    }
+
+    SECTION("try to compute with values of different sizes") {
+        CHECK_THROWS(compute_histogram_2d(
+            x_axis, y_axis, x, {}, {}, aggregation_function::count));
+        CHECK_THROWS(compute_histogram_2d(
+            x_axis, y_axis, x, y, {}, aggregation_function::sum));
+    }
+}
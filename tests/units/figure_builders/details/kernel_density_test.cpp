@@ -0,0 +1,116 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of estimate_kernel_density function.
+ */
+#include "plotly_plotter/figure_builders/details/kernel_density.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include "plotly_plotter/figure_builders/details/box_statistics.h"
+
+TEST_CASE(
+    "plotly_plotter::figure_builders::details::estimate_kernel_density") {
+    using plotly_plotter::figure_builders::details::calculate_box_statistics;
+    using plotly_plotter::figure_builders::details::estimate_kernel_density;
+
+    SECTION("estimate densities of normal distribution") {
+        constexpr std::size_t size = 10000;
+        std::mt19937 engine(12345);  // NOLINT(*-magic-numbers)
+        std::normal_distribution<double> distribution;
+        std::vector<double> values;
+        for (std::size_t i = 0; i < size; ++i) {
+            values.push_back(distribution(engine));
+        }
+        auto values_for_statistics = values;
+        const auto statistics =
+            calculate_box_statistics(values_for_statistics);
+
+        const auto density = estimate_kernel_density(values, statistics);
+
+        // Silverman's rule of thumb.
+        const auto size_in_double = static_cast<double>(size);
+        const double sample_sd =
+            statistics.sd * std::sqrt(size_in_double / (size_in_double - 1.0));
+        // NOLINTBEGIN(*-magic-numbers)
+        const double expected_bandwidth = 1.059 *
+            std::min(sample_sd, (statistics.q3 - statistics.q1) / 1.349) *
+            std::pow(size_in_double, -0.2);
+        // NOLINTEND(*-magic-numbers)
+        CHECK_THAT(
+            density.bandwidth, Catch::Matchers::WithinRel(expected_bandwidth));
+
+        REQUIRE(density.positions.size() == density.densities.size());
+        const auto [min_iter, max_iter] =
+            std::minmax_element(values.begin(), values.end());
+        CHECK_THAT(density.positions.front(),
+            Catch::Matchers::WithinRel(*min_iter - 2.0 * density.bandwidth));
+        CHECK_THAT(density.positions.back(),
+            Catch::Matchers::WithinRel(*max_iter + 2.0 * density.bandwidth));
+
+        // Compare with the exact sums of kernels.
+        constexpr double pi = 3.14159265358979323846;
+        double max_error = 0.0;
+        double max_density = 0.0;
+        for (std::size_t i = 0; i < density.positions.size(); ++i) {
+            double expected = 0.0;
+            for (const double value : values) {
+                const double scaled =
+                    (density.positions[i] - value) / density.bandwidth;
+                expected += std::exp(-0.5 * scaled * scaled);
+            }
+            expected /= std::sqrt(2.0 * pi) * static_cast<double>(size) *
+                density.bandwidth;
+            max_error =
+                std::max(max_error, std::abs(expected - density.densities[i]));
+            max_density = std::max(max_density, expected);
+        }
+        constexpr double tolerance = 0.01;
+        CHECK(max_error < tolerance * max_density);
+    }
+
+    SECTION("estimate densities of the same values") {
+        // NOLINTNEXTLINE(*-magic-numbers)
+        std::vector<double> values{1.5, 1.5, 1.5};
+        auto values_for_statistics = values;
+        const auto statistics =
+            calculate_box_statistics(values_for_statistics);
+
+        const auto density = estimate_kernel_density(values, statistics);
+
+        CHECK(density.bandwidth == 0.0);
+        CHECK(density.positions == std::vector<double>{1.5});
+        CHECK(density.densities.size() == 1);
+    }
+
+    SECTION("estimate densities of no value") {
+        std::vector<double> values;
+        const auto statistics = calculate_box_statistics(values);
+
+        const auto density = estimate_kernel_density(values, statistics);
+
+        CHECK(density.positions.empty());
+        CHECK(density.densities.empty());
+    }
+}
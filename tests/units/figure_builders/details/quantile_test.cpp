@@ -0,0 +1,65 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of select_quantile function.
+ */
+#include "plotly_plotter/figure_builders/details/quantile.h"
+
+#include <cstddef>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+TEST_CASE("plotly_plotter::figure_builders::details::select_quantile") {
+    using plotly_plotter::figure_builders::details::select_quantile;
+
+    // NOLINTBEGIN(*-magic-numbers)
+    std::vector<double> values{4.0, 1.0, 3.0, 2.0};
+
+    SECTION("select quantiles at interpolated positions") {
+        // Positions are 1.5 and 0.5 in sorted values.
+        CHECK_THAT(select_quantile(values.begin(), values.end(), 0.5),
+            Catch::Matchers::WithinRel(2.5));
+        CHECK_THAT(select_quantile(values.begin(), values.end(), 0.25),
+            Catch::Matchers::WithinRel(1.5));
+    }
+
+    SECTION("select quantiles out of the range of positions") {
+        // Positions are clamped to [0, 3].
+        CHECK(select_quantile(values.begin(), values.end(), 0.0) == 1.0);
+        CHECK(select_quantile(values.begin(), values.end(), 1.0) == 4.0);
+    }
+
+    SECTION("select quantiles in the ascending order of probabilities") {
+        std::size_t num_ordered_values = 0;
+        CHECK_THAT(select_quantile(values.begin(), values.end(), 0.25,
+                       num_ordered_values),
+            Catch::Matchers::WithinRel(1.5));
+        CHECK(num_ordered_values == 0);
+        CHECK_THAT(select_quantile(
+                       values.begin(), values.end(), 0.75, num_ordered_values),
+            Catch::Matchers::WithinRel(3.5));
+        CHECK(num_ordered_values == 2);
+    }
+
+    SECTION("select a quantile of a value") {
+        std::vector<double> value{5.0};
+        CHECK(select_quantile(value.begin(), value.end(), 0.3) == 5.0);
+    }
+    // NOLINTEND(*-magic-numbers)
+}
@@ -17,6 +17,10 @@
  * \file
  * \brief Test of figure_builder_base class.
  */
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -24,8 +28,10 @@
 #include <catch2/catch_test_macros.hpp>
 
 #include "plotly_plotter/data_table.h"
+#include "plotly_plotter/figure_builders/bar_based_histogram.h"
 #include "plotly_plotter/figure_builders/line.h"
 #include "plotly_plotter/figure_builders/scatter.h"
+#include "plotly_plotter/io/output_sink.h"
 #include "plotly_plotter/write_html.h"
 
 TEST_CASE("plotly_plotter::figure_builders::figure_builder_base") {
@@ -191,6 +197,254 @@ TEST_CASE("plotly_plotter::figure_builders::figure_builder_base") {
             ApprovalTests::Options().fileOptions().withFileExtension(".html"));
     }
 
+    SECTION("try to create a figure exceeding the row budget") {
+        data_table data;
+        // NOLINTNEXTLINE(*-magic-numbers)
+        data.emplace("y", std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+
+        CHECK_THROWS(line(data).y("y").row_budget(4).create());
+    }
+
+    SECTION("downsample rows exceeding the row budget") {
+        data_table data;
+        data.emplace("y",
+            // NOLINTNEXTLINE(*-magic-numbers)
+            std::vector<int>{10, 11, 12, 13, 14, 15, 16, 17, 18, 19});
+
+        const auto figure =
+            line(data)
+                .y("y")
+                .row_budget(4,
+                    plotly_plotter::figure_builders::row_budget_policy::
+                        downsample)
+                .create();
+
+        const std::string json = figure.document().serialize_to_string();
+        // Indices of rows are used as x coordinates so that points are
+        // placed at the same positions as without the budget.
+        CHECK(json.find(R"("x":[0,2,5,7])") != std::string::npos);
+        CHECK(json.find(R"("y":[10,12,15,17])") != std::string::npos);
+    }
+
+    SECTION("downsample rows of interleaved groups") {
+        data_table data;
+        data.emplace("y",
+            // NOLINTNEXTLINE(*-magic-numbers)
+            std::vector<int>{10, 20, 11, 21, 12, 22, 13, 23, 14, 24});
+        data.emplace("group",
+            std::vector<std::string>{
+                "A", "B", "A", "B", "A", "B", "A", "B", "A", "B"});
+
+        const auto figure =
+            line(data)
+                .y("y")
+                .group("group")
+                .row_budget(4,
+                    plotly_plotter::figure_builders::row_budget_policy::
+                        downsample)
+                .create();
+
+        // The budget is divided among groups, and x coordinates are the
+        // positions of rows in each group.
+        const std::string json = figure.document().serialize_to_string();
+        CHECK(json.find(R"("x":[0,2],"y":[10,12])") != std::string::npos);
+        CHECK(json.find(R"("x":[0,2],"y":[20,22])") != std::string::npos);
+    }
+
+    SECTION("try to downsample rows of a histogram") {
+        data_table data;
+        data.emplace("x", std::vector<int>{1, 2, 3, 1, 2, 3});
+
+        CHECK_THROWS_AS(
+            plotly_plotter::figure_builders::bar_based_histogram(data)
+                .x("x")
+                .row_budget(4,
+                    plotly_plotter::figure_builders::row_budget_policy::
+                        downsample)
+                .create(),
+            std::runtime_error);
+    }
+
+    SECTION("build with animation frames") {
+        data_table data;
+        data.emplace("x", std::vector<int>{1, 2, 3, 1, 2, 3});
+        // NOLINTNEXTLINE(*-magic-numbers)
+        data.emplace("y", std::vector<int>{4, 5, 6, 7, 8, 9});
+        data.emplace(
+            "frame", std::vector<std::string>{"A", "A", "A", "B", "B", "B"});
+
+        const auto figure =
+            line(data).x("x").y("y").animation_frame("frame").create();
+
+        // Frames contain all attributes of traces by default.
+        const std::string json = figure.document().serialize_to_string();
+        CHECK(json.find(R"({"data":[{"type":"scatter")") != std::string::npos);
+        CHECK(json.find(R"("x":[1,2,3],"y":[7,8,9])") != std::string::npos);
+    }
+
+    SECTION("build with animation frames without constant attributes") {
+        data_table data;
+        data.emplace("x", std::vector<int>{1, 2, 3, 1, 2, 3});
+        // NOLINTNEXTLINE(*-magic-numbers)
+        data.emplace("y", std::vector<int>{4, 5, 6, 7, 8, 9});
+        data.emplace(
+            "frame", std::vector<std::string>{"A", "A", "A", "B", "B", "B"});
+
+        const auto figure = line(data)
+                                .x("x")
+                                .y("y")
+                                .animation_frame("frame")
+                                .remove_constant_frame_attributes(true)
+                                .create();
+
+        // Frames contain only attributes changing among frames.
+        const std::string json = figure.document().serialize_to_string();
+        CHECK(json.find(R"({"data":[{"y":[4,5,6]}],"layout":{},"name":"A"})") !=
+            std::string::npos);
+        CHECK(json.find(R"({"data":[{"y":[7,8,9]}],"layout":{},"name":"B"})") !=
+            std::string::npos);
+    }
+
+    SECTION("build with uniformly spaced coordinates") {
+        constexpr int rows = 20;
+        std::vector<int> x;
+        std::vector<int> y;
+        for (int i = 0; i < rows; ++i) {
+            x.push_back(i);
+            y.push_back(i * i);
+        }
+        data_table data;
+        data.emplace("x", x);
+        data.emplace("y", y);
+
+        // Coordinates are kept by default.
+        const std::string default_json =
+            line(data).x("x").y("y").create().document().serialize_to_string();
+        CHECK(default_json.find(R"("x":[0,1,2,)") != std::string::npos);
+        CHECK(default_json.find(R"("dx":)") == std::string::npos);
+
+        const auto figure = line(data)
+                                .x("x")
+                                .y("y")
+                                .compress_uniform_coordinates(true)
+                                .create();
+        const std::string compressed_json =
+            figure.document().serialize_to_string();
+        CHECK(compressed_json.find(R"("x":[)") == std::string::npos);
+        CHECK(compressed_json.find(R"("dx":)") != std::string::npos);
+    }
+
+    SECTION("build with repeated arrays") {
+        constexpr int rows_per_group = 20;
+        std::vector<int> x;
+        std::vector<int> y;
+        std::vector<std::string> group;
+        for (const char* group_name : {"A", "B"}) {
+            for (int i = 0; i < rows_per_group; ++i) {
+                x.push_back(i * i);
+                y.push_back(i);
+                group.emplace_back(group_name);
+            }
+        }
+        data_table data;
+        data.emplace("x", x);
+        data.emplace("y", y);
+        data.emplace("group", group);
+
+        // Arrays are kept in traces by default.
+        const std::string default_json = line(data)
+                                             .x("x")
+                                             .y("y")
+                                             .group("group")
+                                             .create()
+                                             .document()
+                                             .serialize_to_string();
+        CHECK(default_json.find(R"("shared_arrays")") == std::string::npos);
+
+        const auto figure = line(data)
+                                .x("x")
+                                .y("y")
+                                .group("group")
+                                .share_repeated_arrays(true)
+                                .create();
+        const std::string shared_json = figure.document().serialize_to_string();
+        CHECK(shared_json.find(R"("x":{"$shared_array":0})") !=
+            std::string::npos);
+        CHECK(shared_json.find(R"("shared_arrays")") != std::string::npos);
+    }
+
+    SECTION("write HTML writing animation frames one by one") {
+        data_table data;
+        data.emplace("x", std::vector<int>{1, 2, 3, 1, 2, 3});
+        // NOLINTNEXTLINE(*-magic-numbers)
+        data.emplace("y", std::vector<int>{4, 5, 6, 7, 8, 9});
+        data.emplace(
+            "frame", std::vector<std::string>{"A", "A", "A", "B", "B", "B"});
+
+        std::string html;
+        plotly_plotter::io::string_output_sink sink(html);
+        line(data)
+            .x("x")
+            .y("y")
+            .animation_frame("frame")
+            .title("Test Title")
+            .write_html_to(sink);
+
+        CHECK(html.find("<title>Test Title</title>") != std::string::npos);
+        CHECK(html.find("Plotly.addFrames") != std::string::npos);
+        // Frames are written first and contain all attributes of traces.
+        CHECK(html.find(R"(>{&quot;frames&quot;:[{&quot;data&quot;:[{)"
+                        R"(&quot;type&quot;:&quot;scatter&quot;)") !=
+            std::string::npos);
+        CHECK(html.find(R"(&quot;name&quot;:&quot;B&quot;}],)"
+                        R"(&quot;data&quot;:[{)") != std::string::npos);
+    }
+
+    SECTION("try to write HTML with invalid settings") {
+        data_table data;
+        data.emplace("frame", std::vector<std::string>{"A", "B"});
+
+        std::string html;
+        plotly_plotter::io::string_output_sink sink(html);
+        CHECK_THROWS(line(data).animation_frame("frame").write_html_to(sink));
+        CHECK(html.empty());
+    }
+
+    SECTION("keep an existing file when writing HTML fails") {
+        data_table data;
+        data.emplace("x", std::vector<int>{1, 2, 3, 4});
+        // NOLINTNEXTLINE(*-magic-numbers)
+        data.emplace("y", std::vector<int>{5, 6, 7, 8});
+        data.emplace("group", std::vector<std::string>{"a", "a", "b", "b"});
+        data.emplace("frame", std::vector<std::string>{"A", "A", "B", "B"});
+
+        const std::string directory = "figure_builder_base_test_write_html";
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+        const std::string file_path = directory + "/figure.html";
+        {
+            std::ofstream stream(file_path);
+            stream << "old contents";
+        }
+
+        // The color of group b is missing, so writing fails after the output
+        // is opened.
+        CHECK_THROWS_AS(plotly_plotter::figure_builders::scatter(data)
+                            .x("x")
+                            .y("y")
+                            .group("group")
+                            .animation_frame("frame")
+                            .color_map({{"a", "red"}})
+                            .write_html(file_path),
+            std::runtime_error);
+
+        std::ifstream stream(file_path);
+        CHECK(std::string(std::istreambuf_iterator<char>(stream),
+                  std::istreambuf_iterator<char>()) == "old contents");
+        CHECK(std::distance(std::filesystem::directory_iterator(directory),
+                  std::filesystem::directory_iterator()) == 1);
+    }
+
     SECTION("try to create a figure with an inconsistent number of rows") {
         data_table data;
         data.emplace("x", std::vector<int>{1, 2, 3});
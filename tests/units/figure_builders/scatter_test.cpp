@@ -19,7 +19,9 @@
  */
 #include "plotly_plotter/figure_builders/scatter.h"
 
+#include <cstddef>
 #include <stdexcept>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -369,6 +371,135 @@ TEST_CASE("plotly_plotter::figure_builders::scatter") {
             ApprovalTests::Options().fileOptions().withFileExtension(".html"));
     }
 
+    SECTION("downsample points in each group") {
+        constexpr std::size_t rows_per_group = 1000;
+        std::vector<int> x;
+        std::vector<int> y;
+        std::vector<std::string> group;
+        for (std::size_t i = 0; i < 2 * rows_per_group; ++i) {
+            x.push_back(static_cast<int>(i % rows_per_group));
+            y.push_back(static_cast<int>((i * 7) % 13));  // NOLINT
+            group.emplace_back(i < rows_per_group ? "A" : "B");
+        }
+        data_table data;
+        data.emplace("x", x);
+        data.emplace("y", y);
+        data.emplace("group", group);
+
+        constexpr std::size_t width = 10;
+        const auto figure =
+            scatter(data)
+                .x("x")
+                .y("y")
+                .group("group")
+                .mode("lines")
+                .downsampling(
+                    plotly_plotter::figure_builders::downsampling_method::lttb,
+                    width)
+                .create();
+
+        yyjson_mut_val* traces =
+            figure.document().root().at("data").internal_value();
+        REQUIRE(yyjson_mut_arr_size(traces) == 2);
+        for (std::size_t i = 0; i < 2; ++i) {
+            yyjson_mut_val* trace = yyjson_mut_arr_get(traces, i);
+            CHECK(yyjson_mut_arr_size(yyjson_mut_obj_get(trace, "x")) ==
+                2 * width);
+            CHECK(yyjson_mut_arr_size(yyjson_mut_obj_get(trace, "y")) ==
+                2 * width);
+        }
+    }
+
+    SECTION("downsample points without x") {
+        constexpr std::size_t num_rows = 20;
+        constexpr int offset = 100;
+        std::vector<int> y;
+        for (std::size_t i = 0; i < num_rows; ++i) {
+            y.push_back(offset + static_cast<int>(i));
+        }
+        data_table data;
+        data.emplace("y", y);
+
+        constexpr std::size_t width = 3;
+        const auto figure =
+            scatter(data)
+                .y("y")
+                .downsampling(plotly_plotter::figure_builders::
+                                  downsampling_method::every_nth,
+                    width)
+                .create();
+
+        yyjson_mut_val* trace = yyjson_mut_arr_get(
+            figure.document().root().at("data").internal_value(), 0);
+        yyjson_mut_val* x_values = yyjson_mut_obj_get(trace, "x");
+        yyjson_mut_val* y_values = yyjson_mut_obj_get(trace, "y");
+        REQUIRE(yyjson_mut_is_arr(x_values));
+        REQUIRE(yyjson_mut_arr_size(x_values) ==
+            yyjson_mut_arr_size(y_values));
+        CHECK(yyjson_mut_arr_size(x_values) < num_rows);
+        for (std::size_t i = 0; i < yyjson_mut_arr_size(x_values); ++i) {
+            const auto row_index =
+                yyjson_mut_get_int(yyjson_mut_arr_get(x_values, i));
+            CHECK(yyjson_mut_get_int(yyjson_mut_arr_get(y_values, i)) ==
+                offset + row_index);
+        }
+    }
+
+    SECTION("downsample points without x in groups") {
+        constexpr std::size_t rows_per_group = 10;
+        constexpr int offset = 100;
+        std::vector<int> y;
+        std::vector<std::string> group;
+        for (std::size_t i = 0; i < 2 * rows_per_group; ++i) {
+            y.push_back(offset + static_cast<int>(i));
+            group.emplace_back(i < rows_per_group ? "A" : "B");
+        }
+        data_table data;
+        data.emplace("y", y);
+        data.emplace("group", group);
+
+        constexpr std::size_t width = 2;
+        const auto figure =
+            scatter(data)
+                .y("y")
+                .group("group")
+                .downsampling(plotly_plotter::figure_builders::
+                                  downsampling_method::every_nth,
+                    width)
+                .create();
+
+        // x coordinates are positions in each trace as without
+        // downsampling, so the second group starts at zero.
+        yyjson_mut_val* traces =
+            figure.document().root().at("data").internal_value();
+        REQUIRE(yyjson_mut_arr_size(traces) == 2);
+        for (std::size_t trace_index = 0; trace_index < 2; ++trace_index) {
+            yyjson_mut_val* trace = yyjson_mut_arr_get(traces, trace_index);
+            yyjson_mut_val* x_values = yyjson_mut_obj_get(trace, "x");
+            yyjson_mut_val* y_values = yyjson_mut_obj_get(trace, "y");
+            REQUIRE(yyjson_mut_is_arr(x_values));
+            REQUIRE(yyjson_mut_arr_size(x_values) ==
+                yyjson_mut_arr_size(y_values));
+            CHECK(yyjson_mut_arr_size(x_values) < rows_per_group);
+            const int first_value =
+                offset + static_cast<int>(trace_index * rows_per_group);
+            for (std::size_t i = 0; i < yyjson_mut_arr_size(x_values); ++i) {
+                const auto position =
+                    yyjson_mut_get_int(yyjson_mut_arr_get(x_values, i));
+                CHECK(yyjson_mut_get_int(yyjson_mut_arr_get(y_values, i)) ==
+                    first_value + position);
+            }
+        }
+    }
+
+    SECTION("try to set zero width in downsampling") {
+        data_table data;
+        data.emplace("y", std::vector<int>{4, 5, 6});  // NOLINT
+
+        REQUIRE_THROWS(scatter(data).y("y").downsampling(
+            plotly_plotter::figure_builders::downsampling_method::lttb, 0));
+    }
+
     SECTION("try to build without y") {
         data_table data;
         data.emplace("x", std::vector<int>{1, 2, 3});
@@ -20,6 +20,7 @@
 #include "plotly_plotter/figure_builders/violin.h"
 
 #include <stdexcept>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -281,6 +282,80 @@ TEST_CASE("plotly_plotter::figure_builders::violin") {
             ApprovalTests::Options().fileOptions().withFileExtension(".html"));
     }
 
+    SECTION("build with precomputed densities") {
+        data_table data;
+        // NOLINTBEGIN(*-magic-numbers)
+        data.emplace("x", std::vector<int>{1, 1, 1, 1, 2, 2, 2, 2});
+        data.emplace("y",
+            std::vector<double>{1.0, 2.0, 2.5, 3.0, 4.0, 5.0, 5.5, 20.0});
+        data.emplace("group",
+            std::vector<std::string>{"A", "B", "A", "B", "A", "B", "A", "B"});
+        // NOLINTEND(*-magic-numbers)
+
+        const auto figure = violin(data)
+                                .x("x")
+                                .y("y")
+                                .group("group")
+                                .show_box(true)
+                                .show_mean_line(true)
+                                .precompute_density(true)
+                                .create();
+
+        yyjson_mut_val* traces =
+            figure.document().root().at("data").internal_value();
+        // Outline, box, and mean line for each group.
+        // (No outlier is shown for two values in each violin.)
+        REQUIRE(yyjson_mut_arr_size(traces) == 6);
+        yyjson_mut_val* outline = yyjson_mut_arr_get(traces, 0);
+        CHECK(yyjson_mut_equals_str(
+            yyjson_mut_obj_get(outline, "type"), "scatter"));
+        CHECK(yyjson_mut_equals_str(
+            yyjson_mut_obj_get(outline, "fill"), "toself"));
+        CHECK(yyjson_mut_equals_str(
+            yyjson_mut_obj_get(outline, "name"), "A"));
+        yyjson_mut_val* box = yyjson_mut_arr_get(traces, 1);
+        CHECK(yyjson_mut_equals_str(yyjson_mut_obj_get(box, "type"), "box"));
+        CHECK(yyjson_mut_arr_size(yyjson_mut_obj_get(box, "q1")) == 2);
+        yyjson_mut_val* outline_b = yyjson_mut_arr_get(traces, 3);
+        CHECK(yyjson_mut_equals_str(
+            yyjson_mut_obj_get(outline_b, "name"), "B"));
+
+        yyjson_mut_val* xaxis = yyjson_mut_obj_get(
+            figure.document().root().at("layout").internal_value(), "xaxis");
+        yyjson_mut_val* tick_text = yyjson_mut_obj_get(xaxis, "ticktext");
+        REQUIRE(yyjson_mut_arr_size(tick_text) == 2);
+        CHECK(yyjson_mut_equals_str(yyjson_mut_arr_get(tick_text, 0), "1"));
+        CHECK(yyjson_mut_equals_str(yyjson_mut_arr_get(tick_text, 1), "2"));
+    }
+
+    SECTION("build with precomputed densities without x") {
+        data_table data;
+        // NOLINTNEXTLINE(*-magic-numbers)
+        data.emplace("y", std::vector<int>{1, 2, 3, 5, 10});
+
+        const auto figure = violin(data)
+                                .y("y")
+                                .points("false")
+                                .precompute_density(true)
+                                .create();
+
+        yyjson_mut_val* traces =
+            figure.document().root().at("data").internal_value();
+        REQUIRE(yyjson_mut_arr_size(traces) == 1);
+        yyjson_mut_val* outline_y =
+            yyjson_mut_obj_get(yyjson_mut_arr_get(traces, 0), "y");
+        // Closed outline of densities at both sides.
+        CHECK(yyjson_mut_arr_size(outline_y) % 2 == 1);
+    }
+
+    SECTION("try to precompute densities of non-numeric values") {
+        data_table data;
+        data.emplace("y", std::vector<std::string>{"a", "b"});
+
+        REQUIRE_THROWS_AS(violin(data).y("y").precompute_density(true).create(),
+            std::runtime_error);
+    }
+
     SECTION("try to build without y") {
         data_table data;
         data.emplace("x", std::vector<int>{1, 2, 3});
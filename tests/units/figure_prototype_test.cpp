@@ -0,0 +1,62 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of figure_prototype class.
+ */
+#include "plotly_plotter/figure_prototype.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "plotly_plotter/data_table.h"
+#include "plotly_plotter/figure.h"
+#include "plotly_plotter/figure_builders/scatter.h"
+
+TEST_CASE("plotly_plotter::figure_prototype") {
+    plotly_plotter::figure base;
+    base.html_title("Prototype Title");
+    base.config().scroll_zoom(false);
+    const plotly_plotter::figure_prototype prototype(std::move(base));
+
+    SECTION("create figures") {
+        plotly_plotter::figure figure1 = prototype.create();
+        plotly_plotter::figure figure2 = prototype.create();
+        figure1.add_scatter().y(std::vector<int>{1, 2, 3});
+
+        CHECK(figure1.html_title() == "Prototype Title");
+        CHECK(figure2.document().serialize_to_string() ==
+            prototype.prototype().document().serialize_to_string());
+        CHECK(figure1.document().serialize_to_string() !=
+            figure2.document().serialize_to_string());
+    }
+
+    SECTION("create figures using figure builders") {
+        plotly_plotter::data_table data;
+        data.emplace("y", std::vector<int>{1, 2, 3});
+
+        const auto figure =
+            plotly_plotter::figure_builders::scatter(data).y("y").create(
+                prototype);
+
+        const std::string json = figure.document().serialize_to_string();
+        CHECK(json.find(R"("scrollZoom":false)") != std::string::npos);
+        CHECK(json.find(R"("y":[1,2,3])") != std::string::npos);
+    }
+}
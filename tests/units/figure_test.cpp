@@ -19,12 +19,17 @@
  */
 #include "plotly_plotter/figure.h"
 
+#include <cstdio>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 #include <ApprovalTests.hpp>
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include "plotly_plotter/json_document.h"
 #include "plotly_plotter/traces/box.h"
 #include "plotly_plotter/traces/scatter.h"
 
@@ -50,6 +55,56 @@ TEST_CASE("plotly_plotter::figure") {
         ApprovalTests::Approvals::verify(json_string,
             ApprovalTests::Options().fileOptions().withFileExtension(".json"));
     }
+
+    SECTION("clone") {
+        figure.title("Test Title");
+        figure.add_scatter().y(std::vector<int>{1, 2, 3});
+
+        plotly_plotter::figure copied = figure.clone();
+        CHECK(copied.document().serialize_to_string() ==
+            figure.document().serialize_to_string());
+        CHECK(copied.html_title() == figure.html_title());
+
+        // Copied figures are independent of the original ones.
+        copied.title("Changed Title");
+        (void)copied.add_box();
+        CHECK(copied.document().serialize_to_string() !=
+            figure.document().serialize_to_string());
+        CHECK(figure.document().root()["data"].internal_value() !=
+            copied.document().root()["data"].internal_value());
+    }
+
+    SECTION("create from a document") {
+        figure.title("Test Title");
+        figure.add_scatter().y(std::vector<int>{1, 2, 3});
+
+        plotly_plotter::figure created =
+            plotly_plotter::figure::from_document(figure.document().clone());
+        CHECK(created.document().serialize_to_string() ==
+            figure.document().serialize_to_string());
+        CHECK(created.html_title() == "Untitled Plot");
+
+        created.title("Changed Title");
+        CHECK(created.document().serialize_to_string() !=
+            figure.document().serialize_to_string());
+    }
+
+    SECTION("access the root of a parsed document via a const reference") {
+        const std::string file_path = "figure_test_parsed_document.json";
+        std::FILE* file = std::fopen(file_path.c_str(), "w");
+        REQUIRE(file != nullptr);
+        figure.document().serialize_to(file);
+        (void)std::fclose(file);
+
+        plotly_plotter::figure created = plotly_plotter::figure::from_document(
+            plotly_plotter::json_document::parse(file_path));
+        const plotly_plotter::figure& const_created = created;
+
+        // Parsed data must be converted before access via const references.
+        CHECK_THROWS_AS(const_created.document().root(), std::runtime_error);
+        created.document().make_mutable();
+        CHECK_NOTHROW(const_created.document().root());
+    }
 }
 
 TEMPLATE_TEST_CASE("trace types in figures and frames", "",
@@ -0,0 +1,55 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of executable_check_cache class.
+ */
+#include "plotly_plotter/io/details/executable_check_cache.h"
+
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("plotly_plotter::io::details::executable_check_cache") {
+    using plotly_plotter::io::details::executable_check_cache;
+
+    executable_check_cache cache;
+    int num_checks = 0;
+    const auto checker = [&num_checks](const std::string& path) {
+        ++num_checks;
+        return path == "valid";
+    };
+
+    SECTION("check an executable only once") {
+        CHECK(cache.check("valid", checker));
+        CHECK(cache.check("valid", checker));
+        CHECK(num_checks == 1);
+    }
+
+    SECTION("check different executables") {
+        CHECK(cache.check("valid", checker));
+        CHECK_FALSE(cache.check("invalid", checker));
+        CHECK_FALSE(cache.check("invalid", checker));
+        CHECK(num_checks == 2);
+    }
+
+    SECTION("clear the cache") {
+        CHECK(cache.check("valid", checker));
+        cache.clear();
+        CHECK(cache.check("valid", checker));
+        CHECK(num_checks == 2);
+    }
+}
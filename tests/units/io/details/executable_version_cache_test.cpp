@@ -0,0 +1,54 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of executable_version_cache class.
+ */
+#include "plotly_plotter/io/details/executable_version_cache.h"
+
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("plotly_plotter::io::details::executable_version_cache") {
+    using plotly_plotter::io::details::executable_version_cache;
+
+    executable_version_cache cache;
+    int num_calls = 0;
+    const auto getter = [&num_calls](const std::string& path) {
+        ++num_calls;
+        return path + " 1.0";
+    };
+
+    SECTION("get a version only once") {
+        CHECK(cache.get("tool", getter) == "tool 1.0");
+        CHECK(cache.get("tool", getter) == "tool 1.0");
+        CHECK(num_calls == 1);
+    }
+
+    SECTION("get versions of different executables") {
+        CHECK(cache.get("tool", getter) == "tool 1.0");
+        CHECK(cache.get("other", getter) == "other 1.0");
+        CHECK(num_calls == 2);
+    }
+
+    SECTION("clear the cache") {
+        CHECK(cache.get("tool", getter) == "tool 1.0");
+        cache.clear();
+        CHECK(cache.get("tool", getter) == "tool 1.0");
+        CHECK(num_calls == 2);
+    }
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of sha256_hasher class.
+ */
+#include "plotly_plotter/io/details/sha256.h"
+
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("plotly_plotter::io::details::sha256_hasher") {
+    using plotly_plotter::io::details::sha256_hasher;
+
+    SECTION("hash an empty string") {
+        sha256_hasher hasher;
+
+        CHECK(hasher.finish() ==
+            "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+    }
+
+    SECTION("hash a short string") {
+        sha256_hasher hasher;
+        hasher.add("abc");
+
+        CHECK(hasher.finish() ==
+            "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+    }
+
+    SECTION("hash a string over two blocks") {
+        sha256_hasher hasher;
+        hasher.add("abcdbcdecdefdefgefghfghighijhijkijkl");
+        hasher.add("jklmklmnlmnomnopnopq");
+
+        CHECK(hasher.finish() ==
+            "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+    }
+
+    SECTION("hash a long string") {
+        sha256_hasher hasher;
+        const std::string data(1000000, 'a');  // NOLINT(*-magic-numbers)
+        hasher.add(data);
+
+        CHECK(hasher.finish() ==
+            "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+    }
+}
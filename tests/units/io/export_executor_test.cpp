@@ -0,0 +1,108 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of export_executor class.
+ */
+#include "plotly_plotter/io/export_executor.h"
+
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("plotly_plotter::io::export_executor") {
+    using plotly_plotter::io::export_executor;
+
+    SECTION("run jobs") {
+        export_executor executor(2, 4);
+        std::atomic<int> num_runs{0};
+
+        std::vector<std::future<void>> futures;
+        constexpr int num_jobs = 20;
+        for (int i = 0; i < num_jobs; ++i) {
+            futures.push_back(executor.submit([&num_runs] { ++num_runs; }));
+        }
+        for (auto& future : futures) {
+            future.get();
+        }
+
+        CHECK(num_runs.load() == num_jobs);
+    }
+
+    SECTION("propagate exceptions") {
+        export_executor executor(1, 1);
+
+        auto future = executor.submit(
+            [] { throw std::runtime_error("Test exception."); });
+
+        CHECK_THROWS_AS(future.get(), std::runtime_error);
+    }
+
+    SECTION("reject jobs when the queue is full") {
+        export_executor executor(1, 1);
+        std::promise<void> release;
+        std::shared_future<void> released = release.get_future().share();
+        std::promise<void> started;
+
+        auto running = executor.submit([&started, released] {
+            started.set_value();
+            released.wait();
+        });
+        started.get_future().wait();
+        auto pending = executor.try_submit([] {});
+        REQUIRE(pending.has_value());
+        CHECK(executor.num_pending_jobs() == 1);
+
+        CHECK_FALSE(executor.try_submit([] {}).has_value());
+
+        release.set_value();
+        running.get();
+        pending->get();
+        CHECK(executor.num_pending_jobs() == 0);
+    }
+
+    SECTION("cancel pending jobs") {
+        export_executor executor(1, 2);
+        std::promise<void> release;
+        std::shared_future<void> released = release.get_future().share();
+        std::promise<void> started;
+        std::atomic<int> num_runs{0};
+
+        auto running = executor.submit([&started, released] {
+            started.set_value();
+            released.wait();
+        });
+        started.get_future().wait();
+        auto pending1 = executor.submit([&num_runs] { ++num_runs; });
+        auto pending2 = executor.submit([&num_runs] { ++num_runs; });
+
+        CHECK(executor.cancel_pending() == 2);
+
+        release.set_value();
+        running.get();
+        CHECK_THROWS_AS(pending1.get(), std::runtime_error);
+        CHECK_THROWS_AS(pending2.get(), std::runtime_error);
+        CHECK(num_runs.load() == 0);
+    }
+
+    SECTION("invalid arguments") {
+        CHECK_THROWS_AS(export_executor(0, 1), std::invalid_argument);
+        CHECK_THROWS_AS(export_executor(1, 0), std::invalid_argument);
+    }
+}
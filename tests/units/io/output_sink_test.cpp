@@ -0,0 +1,112 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of classes of output sinks.
+ */
+#include "plotly_plotter/io/output_sink.h"
+
+#include <array>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "plotly_plotter/details/config.h"
+
+#if PLOTLY_PLOTTER_USE_UNIX_SUBPROCESS
+#include <unistd.h>
+#endif
+
+TEST_CASE("plotly_plotter::io::string_output_sink") {
+    std::string buffer = "abc";
+    plotly_plotter::io::string_output_sink sink(buffer);
+
+    sink.write("def");
+    const std::array<std::string_view, 2> parts{"gh", "ij"};
+    sink.write_parts(parts.data(), parts.size());
+
+    CHECK(buffer == "abcdefghij");
+}
+
+TEST_CASE("plotly_plotter::io::ostream_output_sink") {
+    std::ostringstream stream;
+    plotly_plotter::io::ostream_output_sink sink(stream);
+
+    sink.write("abc");
+    const std::array<std::string_view, 2> parts{"de", "f"};
+    sink.write_parts(parts.data(), parts.size());
+
+    CHECK(stream.str() == "abcdef");
+}
+
+TEST_CASE("plotly_plotter::io::callback_output_sink") {
+    std::string buffer;
+    plotly_plotter::io::callback_output_sink sink(
+        [&buffer](std::string_view data) { buffer += data; });
+
+    sink.write("abc");
+    const std::array<std::string_view, 2> parts{"de", "f"};
+    sink.write_parts(parts.data(), parts.size());
+
+    CHECK(buffer == "abcdef");
+}
+
+#if PLOTLY_PLOTTER_USE_UNIX_SUBPROCESS
+TEST_CASE("plotly_plotter::io::fd_output_sink") {
+    std::array<int, 2> pipe_fds{};
+    REQUIRE(::pipe(pipe_fds.data()) == 0);
+
+    {
+        plotly_plotter::io::fd_output_sink sink(pipe_fds[1]);
+        sink.write("abc");
+        const std::array<std::string_view, 3> parts{"de", "", "fgh"};
+        sink.write_parts(parts.data(), parts.size());
+    }
+    (void)::close(pipe_fds[1]);
+
+    std::string result;
+    std::array<char, 16> buffer{};  // NOLINT(*-magic-numbers)
+    while (true) {
+        const auto read_size =
+            ::read(pipe_fds[0], buffer.data(), buffer.size());
+        if (read_size <= 0) {
+            break;
+        }
+        result.append(buffer.data(), static_cast<std::size_t>(read_size));
+    }
+    (void)::close(pipe_fds[0]);
+
+    CHECK(result == "abcdefgh");
+}
+#endif
+
+TEST_CASE("plotly_plotter::io::file_output_sink") {
+    const std::string file_path = "output_sink_test.txt";
+    {
+        plotly_plotter::io::file_output_sink sink(file_path);
+        sink.write("abc");
+        const std::array<std::string_view, 2> parts{"de", "f"};
+        sink.write_parts(parts.data(), parts.size());
+    }
+
+    std::ifstream stream(file_path);
+    std::string result;
+    std::getline(stream, result);
+    CHECK(result == "abcdef");
+}
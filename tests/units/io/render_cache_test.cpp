@@ -0,0 +1,158 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of render_cache class.
+ */
+#include "plotly_plotter/io/render_cache.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#include <catch2/catch_test_macros.hpp>
+
+namespace {
+
+void write_file(const std::string& file_path, const std::string& contents) {
+    std::ofstream stream(file_path);
+    stream << contents;
+}
+
+[[nodiscard]] std::string read_file(const std::string& file_path) {
+    std::ifstream stream(file_path);
+    return std::string(std::istreambuf_iterator<char>(stream),
+        std::istreambuf_iterator<char>());
+}
+
+}  // namespace
+
+TEST_CASE("plotly_plotter::io::render_cache") {
+    using plotly_plotter::io::render_cache;
+
+    auto& cache = render_cache::get_instance();
+    const std::string directory = "render_cache_test";
+    std::filesystem::remove_all(directory);
+    cache.reset_counters();
+
+    const std::string entry_name1 =
+        "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef.png";
+    const std::string entry_name2 =
+        "fedcba9876543210fedcba9876543210fedcba9876543210fedcba9876543210.png";
+    const std::string file_path = "render_cache_test.png";
+    int num_renders = 0;
+    const auto renderer = [&num_renders, &file_path] {
+        ++num_renders;
+        write_file(file_path, "rendered");
+    };
+
+    SECTION("create names of cached files") {
+        const std::string name = render_cache::create_entry_name(
+            "png", "title", std::string_view("data"), 1, 2, "converter 1.0");
+
+        CHECK(name.size() == 64 + 4);  // NOLINT(*-magic-numbers)
+        CHECK(name.substr(64) == ".png");  // NOLINT(*-magic-numbers)
+        CHECK(render_cache::create_entry_name("png", "title",
+                  std::string_view("data"), 1, 2, "converter 1.0") == name);
+        CHECK(render_cache::create_entry_name("png", "title",
+                  std::string_view("data"), 1, 2, "converter 1.1") != name);
+        CHECK(render_cache::create_entry_name("png", "title",
+                  std::string_view("date"), 1, 2, "converter 1.0") != name);
+        CHECK(render_cache::create_entry_name("png", "titled",
+                  std::string_view("ata"), 1, 2, "converter 1.0") != name);
+    }
+
+    SECTION("render without the cache") {
+        cache.disable();
+
+        cache.render(
+            file_path.c_str(), [&] { return entry_name1; }, renderer);
+        cache.render(
+            file_path.c_str(), [&] { return entry_name1; }, renderer);
+
+        CHECK(num_renders == 2);
+        CHECK(cache.num_hits() == 0);
+        CHECK(cache.num_misses() == 0);
+    }
+
+    SECTION("render with the cache") {
+        cache.enable(directory);
+
+        cache.render(
+            file_path.c_str(), [&] { return entry_name1; }, renderer);
+        std::filesystem::remove(file_path);
+        cache.render(
+            file_path.c_str(), [&] { return entry_name1; }, renderer);
+
+        CHECK(num_renders == 1);
+        CHECK(read_file(file_path) == "rendered");
+        CHECK(cache.num_hits() == 1);
+        CHECK(cache.num_misses() == 1);
+
+        cache.render(
+            file_path.c_str(), [&] { return entry_name2; }, renderer);
+        CHECK(num_renders == 2);
+        CHECK(cache.num_misses() == 2);
+
+        cache.clear();
+        CHECK_FALSE(std::filesystem::exists(directory + "/" + entry_name1));
+        CHECK_FALSE(std::filesystem::exists(directory + "/" + entry_name2));
+    }
+
+    SECTION("use hard links") {
+        cache.enable(directory);
+        cache.set_use_hard_links(true);
+
+        cache.render(
+            file_path.c_str(), [&] { return entry_name1; }, renderer);
+        cache.render(
+            file_path.c_str(), [&] { return entry_name1; }, renderer);
+
+        CHECK(num_renders == 1);
+        CHECK(read_file(file_path) == "rendered");
+        CHECK(cache.num_hits() == 1);
+
+        cache.set_use_hard_links(false);
+    }
+
+    SECTION("remove old files exceeding the maximum size") {
+        constexpr std::uintmax_t max_size = 10;
+        cache.enable(directory, max_size);
+
+        cache.render(
+            file_path.c_str(), [&] { return entry_name1; }, renderer);
+        cache.render(
+            file_path.c_str(), [&] { return entry_name2; }, renderer);
+
+        CHECK_FALSE(std::filesystem::exists(directory + "/" + entry_name1));
+        CHECK(std::filesystem::exists(directory + "/" + entry_name2));
+    }
+
+    SECTION("keep other files in the directory") {
+        cache.enable(directory, 0);
+        const std::string other_file_path = directory + "/other.png";
+        write_file(other_file_path, "other");
+
+        cache.render(
+            file_path.c_str(), [&] { return entry_name1; }, renderer);
+
+        CHECK(std::filesystem::exists(other_file_path));
+    }
+
+    cache.disable();
+}
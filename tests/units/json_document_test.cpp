@@ -68,6 +68,26 @@ TEST_CASE("plotly_plotter::json_document") {
         ApprovalTests::Approvals::verify(result);
     }
 
+    SECTION("compute statistics") {
+        json_document document;
+        json_value array = document.root()["a"];
+        array.push_back(1);
+        array.push_back(-23);  // NOLINT(*-magic-numbers)
+        array.push_back("xy");
+        array.push_back(true);
+        (void)array.emplace_back();
+        array.push_back(1.5);  // NOLINT(*-magic-numbers)
+
+        const auto statistics = document.compute_statistics();
+
+        CHECK(statistics.num_nodes == 8);
+        CHECK(statistics.string_bytes == 3);
+        // Serialized JSON is {"a":[1,-23,"xy",true,null,1.5]}.
+        CHECK(statistics.estimated_serialized_size ==
+            document.serialize_to_string().size());
+        CHECK(statistics.allocated_bytes > 0);
+    }
+
     SECTION("try to serialize to JSON string with an invalid document") {
         json_document document;
         yyjson_mut_set_real(document.root().internal_value(),
@@ -106,4 +126,58 @@ TEST_CASE("plotly_plotter::json_document") {
         CHECK_THROWS(document.serialize_to(file));
         (void)std::fclose(file);
     }
+
+    SECTION("parse a file") {
+        const std::string file_path = "json_document_test_parse.json";
+        const std::string_view json = R"({"key1":123,"key2":["abc",1.25]})";
+        std::FILE* file = std::fopen(file_path.c_str(), "w");
+        REQUIRE(file != nullptr);
+        (void)std::fwrite(json.data(), 1, json.size(), file);
+        (void)std::fclose(file);
+
+        json_document document = json_document::parse(file_path);
+        CHECK_FALSE(document.is_mutable());
+        CHECK(document.serialize_to_string() == json);
+
+        json_document copied = document.clone();
+        CHECK_FALSE(copied.is_mutable());
+
+        // Const functions never convert parsed data.
+        const json_document& const_document = document;
+        CHECK(const_document.has_root_key("key2"));
+        CHECK_FALSE(const_document.has_root_key("key3"));
+        CHECK(const_document.compute_statistics().num_nodes == 5);
+        CHECK_THROWS(const_document.root());
+        CHECK_FALSE(document.is_mutable());
+
+        document.root()["key3"] = true;
+        CHECK(document.is_mutable());
+        CHECK(document.serialize_to_string() ==
+            R"({"key1":123,"key2":["abc",1.25],"key3":true})");
+        CHECK(copied.serialize_to_string() == json);
+    }
+
+    SECTION("parse an empty file") {
+        const std::string file_path = "json_document_test_parse_empty.json";
+        std::FILE* file = std::fopen(file_path.c_str(), "w");
+        REQUIRE(file != nullptr);
+        (void)std::fclose(file);
+
+        CHECK_THROWS(json_document::parse(file_path));
+    }
+
+    SECTION("try to parse an invalid file") {
+        const std::string file_path = "json_document_test_parse_invalid.json";
+        const std::string_view json = R"({"key1":)";
+        std::FILE* file = std::fopen(file_path.c_str(), "w");
+        REQUIRE(file != nullptr);
+        (void)std::fwrite(json.data(), 1, json.size(), file);
+        (void)std::fclose(file);
+
+        CHECK_THROWS(json_document::parse(file_path));
+    }
+
+    SECTION("try to parse a file which does not exist") {
+        CHECK_THROWS(json_document::parse("json_document_test_not_exist.json"));
+    }
 }
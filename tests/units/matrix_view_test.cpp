@@ -0,0 +1,122 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of matrix_view class.
+ */
+#include "plotly_plotter/matrix_view.h"
+
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "plotly_plotter/json_document.h"
+
+TEST_CASE("plotly_plotter::matrix_view") {
+    using plotly_plotter::as_matrix;
+    using plotly_plotter::json_document;
+    using plotly_plotter::storage_order;
+
+    json_document document;
+
+    SECTION("convert a matrix in row-major order") {
+        const std::vector<int> buffer{1, 2, 3, 4, 5, 6};
+
+        document.root() = as_matrix(buffer.data(), 2, 3);
+
+        CHECK(document.serialize_to_string() == "[[1,2,3],[4,5,6]]");
+    }
+
+    SECTION("convert a matrix in column-major order") {
+        const std::vector<int> buffer{1, 4, 2, 5, 3, 6};
+
+        document.root() =
+            as_matrix(buffer.data(), 2, 3, storage_order::column_major);
+
+        CHECK(document.serialize_to_string() == "[[1,2,3],[4,5,6]]");
+    }
+
+    SECTION("convert a large matrix in column-major order") {
+        constexpr std::size_t rows = 100;
+        constexpr std::size_t cols = 3;
+        std::vector<std::size_t> buffer(rows * cols);
+        for (std::size_t i = 0; i < rows; ++i) {
+            for (std::size_t j = 0; j < cols; ++j) {
+                buffer[j * rows + i] = i * cols + j;
+            }
+        }
+
+        document.root() =
+            as_matrix(buffer.data(), rows, cols, storage_order::column_major);
+
+        yyjson_mut_val* matrix = document.root().internal_value();
+        REQUIRE(yyjson_mut_arr_size(matrix) == rows);
+        for (std::size_t i = 0; i < rows; ++i) {
+            yyjson_mut_val* row = yyjson_mut_arr_get(matrix, i);
+            REQUIRE(yyjson_mut_arr_size(row) == cols);
+            for (std::size_t j = 0; j < cols; ++j) {
+                CHECK(yyjson_mut_get_uint(yyjson_mut_arr_get(row, j)) ==
+                    i * cols + j);
+            }
+        }
+    }
+
+    SECTION("convert a matrix with an outer stride in row-major order") {
+        const std::vector<int> buffer{1, 2, 3, 0, 4, 5, 6, 0};
+
+        document.root() =
+            as_matrix(buffer.data(), 2, 3, storage_order::row_major, 4);
+
+        CHECK(document.serialize_to_string() == "[[1,2,3],[4,5,6]]");
+    }
+
+    SECTION("convert a matrix with an outer stride in column-major order") {
+        const std::vector<int> buffer{1, 4, 0, 2, 5, 0, 3, 6, 0};
+
+        document.root() =
+            as_matrix(buffer.data(), 2, 3, storage_order::column_major, 3);
+
+        CHECK(document.serialize_to_string() == "[[1,2,3],[4,5,6]]");
+    }
+
+    SECTION("convert non-finite values to null") {
+        const std::vector<double> buffer{
+            1.5, std::numeric_limits<double>::quiet_NaN(), 2.5, 3.5};
+
+        document.root() = as_matrix(buffer.data(), 2, 2);
+
+        CHECK(document.serialize_to_string() == "[[1.5,null],[2.5,3.5]]");
+    }
+
+    SECTION("convert a matrix of booleans") {
+        const bool buffer[] = {true, false};  // NOLINT(*-avoid-c-arrays)
+
+        document.root() = as_matrix(buffer, 1, 2);
+
+        CHECK(document.serialize_to_string() == "[[true,false]]");
+    }
+
+    SECTION("convert nested vectors") {
+        const std::vector<std::vector<float>> values{{1.5F, 2.5F}, {3.5F}};
+
+        document.root() = values;
+
+        CHECK(document.serialize_to_string() == "[[1.5,2.5],[3.5]]");
+    }
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of metrics_registry class.
+ */
+#include "plotly_plotter/metrics/metrics_registry.h"
+
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("plotly_plotter::metrics::metrics_registry") {
+    using plotly_plotter::metrics::converter_type;
+    using plotly_plotter::metrics::counter_type;
+    using plotly_plotter::metrics::metrics_registry;
+
+    metrics_registry& registry = metrics_registry::get_instance();
+    registry.reset();
+    registry.enable();
+
+    SECTION("add values to counters") {
+        registry.add(counter_type::figures_created);
+        registry.add(counter_type::bytes_written, 123);
+        registry.add(counter_type::bytes_written, 7);
+
+        const auto snapshot = registry.snapshot();
+        CHECK(snapshot.counter(counter_type::figures_created) == 1);
+        CHECK(snapshot.counter(counter_type::bytes_written) == 130);
+        CHECK(snapshot.counter(counter_type::traces_created) == 0);
+    }
+
+    SECTION("ignore values when disabled") {
+        registry.disable();
+        registry.add(counter_type::figures_created);
+        registry.record_conversion_latency(
+            converter_type::chrome, std::chrono::milliseconds(1));
+
+        const auto snapshot = registry.snapshot();
+        CHECK(snapshot.counter(counter_type::figures_created) == 0);
+        CHECK(snapshot.conversion_latency(converter_type::chrome).count == 0);
+    }
+
+    SECTION("record latencies of conversions") {
+        registry.record_conversion_latency(
+            converter_type::chrome, std::chrono::microseconds(500));
+        registry.record_conversion_latency(
+            converter_type::chrome, std::chrono::milliseconds(200));
+        registry.record_conversion_latency(
+            converter_type::chrome, std::chrono::seconds(100));
+
+        const auto snapshot = registry.snapshot();
+        const auto& histogram =
+            snapshot.conversion_latency(converter_type::chrome);
+        CHECK(histogram.count == 3);
+        CHECK(std::abs(histogram.sum_seconds - 100.2005) < 1e-6);
+        CHECK(histogram.bucket_counts[0] == 1);  // <= 1 ms
+        CHECK(histogram.bucket_counts[7] == 1);  // <= 250 ms
+        CHECK(histogram.bucket_counts.back() == 1);
+        CHECK(snapshot.conversion_latency(converter_type::playwright).count ==
+            0);
+    }
+
+    SECTION("measure conversions in scopes") {
+        {
+            const plotly_plotter::metrics::scoped_conversion_measurement
+                measurement(converter_type::pdftocairo);
+        }
+        try {
+            const plotly_plotter::metrics::scoped_conversion_measurement
+                measurement(converter_type::pdftocairo);
+            throw std::runtime_error("test");
+        } catch (const std::runtime_error& /*error*/) {
+            // Expected.
+        }
+
+        const auto snapshot = registry.snapshot();
+        CHECK(snapshot.conversion_latency(converter_type::pdftocairo).count ==
+            2);
+        CHECK(snapshot.counter(counter_type::conversion_failures) == 1);
+    }
+
+    SECTION("add values from multiple threads") {
+        constexpr std::size_t num_threads = 4;
+        constexpr std::size_t num_additions = 10000;
+        std::vector<std::thread> threads;
+        threads.reserve(num_threads);
+        for (std::size_t i = 0; i < num_threads; ++i) {
+            threads.emplace_back([&registry] {
+                for (std::size_t j = 0; j < num_additions; ++j) {
+                    registry.add(counter_type::traces_created);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        CHECK(registry.snapshot().counter(counter_type::traces_created) ==
+            num_threads * num_additions);
+    }
+
+    SECTION("get names") {
+        CHECK(plotly_plotter::metrics::counter_name(
+                  counter_type::json_nodes_serialized) ==
+            "json_nodes_serialized");
+        CHECK(plotly_plotter::metrics::converter_name(
+                  converter_type::playwright) == "playwright_converter");
+        CHECK(plotly_plotter::metrics::latency_bucket_upper_bound(0) == 0.001);
+        CHECK(std::isinf(plotly_plotter::metrics::latency_bucket_upper_bound(
+            plotly_plotter::metrics::num_latency_buckets - 1)));
+    }
+
+    registry.disable();
+    registry.reset();
+}
@@ -3,28 +3,52 @@ set(SOURCE_FILES
     config_test.cpp
     data_column_test.cpp
     data_table_test.cpp
+    details/compiled_template_test.cpp
+    details/compress_uniform_coordinates_test.cpp
+    details/encode_base64_test.cpp
     details/escape_for_html_test.cpp
     details/file_handle_test.cpp
     details/has_iterator_test.cpp
+    details/share_repeated_arrays_test.cpp
     eigen_test.cpp
+    figure_builders/bar_test.cpp
     figure_builders/box_test.cpp
+    figure_builders/density_heatmap_test.cpp
+    figure_builders/details/box_statistics_test.cpp
+    figure_builders/details/downsample_test.cpp
+    figure_builders/details/group_aggregation_test.cpp
+    figure_builders/details/histogram_2d_test.cpp
+    figure_builders/details/kernel_density_test.cpp
+    figure_builders/details/quantile_test.cpp
     figure_builders/figure_builder_base_test.cpp
     figure_builders/line_test.cpp
     figure_builders/scatter_test.cpp
     figure_builders/violin_test.cpp
+    figure_prototype_test.cpp
     figure_test.cpp
     invert_color_scale_test.cpp
+    io/details/executable_check_cache_test.cpp
+    io/details/executable_version_cache_test.cpp
+    io/details/sha256_test.cpp
+    io/export_executor_test.cpp
+    io/output_sink_test.cpp
+    io/render_cache_test.cpp
     json_converter_test.cpp
     json_document_test.cpp
     json_value_test.cpp
     layout_test.cpp
+    matrix_view_test.cpp
+    metrics/metrics_registry_test.cpp
     test_main.cpp
     to_string_test.cpp
     traces/box_test.cpp
     traces/heatmap_test.cpp
     traces/scatter_test.cpp
     traces/violin_test.cpp
+    tracing/chrome_trace_writer_test.cpp
+    typed_array_test.cpp
     utils/calculate_histogram_bin_width_test.cpp
     utils/percentile_calculator_test.cpp
+    write_html_page_test.cpp
     write_html_test.cpp
 )
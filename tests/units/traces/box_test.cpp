@@ -50,4 +50,26 @@ TEST_CASE("plotly_plotter::traces::box") {
         ApprovalTests::Approvals::verify(json_string,
             ApprovalTests::Options().fileOptions().withFileExtension(".json"));
     }
+
+    SECTION("set precomputed statistics") {
+        auto box = figure.add_box();
+
+        // NOLINTBEGIN(*-magic-numbers)
+        CHECK_NOTHROW(box.x(std::vector<std::string>{"a", "b"}));
+        CHECK_NOTHROW(box.q1(std::vector{1.0, 2.0}));
+        CHECK_NOTHROW(box.median(std::vector{1.5, 2.5}));
+        CHECK_NOTHROW(box.q3(std::vector{2.0, 3.0}));
+        CHECK_NOTHROW(box.lower_fence(std::vector{0.5, 1.5}));
+        CHECK_NOTHROW(box.upper_fence(std::vector{2.5, 3.5}));
+        CHECK_NOTHROW(box.mean(std::vector{1.5, 2.5}));
+        CHECK_NOTHROW(box.sd(std::vector{0.25, 0.5}));
+        // NOLINTEND(*-magic-numbers)
+
+        yyjson_mut_val* trace = yyjson_mut_arr_get(
+            figure.document().root().at("data").internal_value(), 0);
+        for (const char* key :
+            {"q1", "median", "q3", "lowerfence", "upperfence", "mean", "sd"}) {
+            CHECK(yyjson_mut_arr_size(yyjson_mut_obj_get(trace, key)) == 2);
+        }
+    }
 }
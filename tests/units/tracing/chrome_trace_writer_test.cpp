@@ -0,0 +1,97 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of chrome_trace_writer class.
+ */
+#include "plotly_plotter/tracing/chrome_trace_writer.h"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+
+#include "plotly_plotter/tracing/tracer.h"
+
+namespace {
+
+[[nodiscard]] std::string read_file(const std::string& file_path) {
+    std::ifstream stream(file_path);
+    return std::string(std::istreambuf_iterator<char>(stream),
+        std::istreambuf_iterator<char>());
+}
+
+}  // namespace
+
+TEST_CASE("plotly_plotter::tracing::chrome_trace_writer") {
+    using plotly_plotter::tracing::chrome_trace_writer;
+    using plotly_plotter::tracing::clock_type;
+    using plotly_plotter::tracing::span_record;
+
+    const std::string file_path = "chrome_trace_writer_test.json";
+    std::filesystem::remove(file_path);
+
+    SECTION("write recorded spans") {
+        chrome_trace_writer writer(file_path);
+        const auto start = clock_type::now();
+        writer.record(span_record{"first", "test", start,
+            start + std::chrono::microseconds(10), 0});
+        writer.record(span_record{"second \"span\"", "test",
+            start + std::chrono::microseconds(20),
+            start + std::chrono::microseconds(50), 1});
+        writer.flush();
+
+        const std::string contents = read_file(file_path);
+        using Catch::Matchers::ContainsSubstring;
+        using Catch::Matchers::StartsWith;
+        CHECK_THAT(contents,
+            StartsWith(R"({"displayTimeUnit":"ms","traceEvents":[)"));
+        CHECK_THAT(contents, ContainsSubstring(R"("name":"first")"));
+        CHECK_THAT(
+            contents, ContainsSubstring(R"("name":"second \"span\"")"));
+        CHECK_THAT(contents, ContainsSubstring(R"("dur":10.000)"));
+        CHECK_THAT(contents, ContainsSubstring(R"("dur":30.000)"));
+        CHECK_THAT(contents, ContainsSubstring(R"("tid":1)"));
+    }
+
+    SECTION("write without spans") {
+        chrome_trace_writer writer(file_path);
+        writer.flush();
+
+        CHECK(read_file(file_path) ==
+            "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[]}\n");
+    }
+
+    SECTION("record spans via the process-wide tracer") {
+        auto writer = std::make_shared<chrome_trace_writer>(file_path);
+        plotly_plotter::tracing::set_tracer(writer);
+        {
+            const plotly_plotter::tracing::scoped_span span(
+                "scoped", "test");
+        }
+        plotly_plotter::tracing::set_tracer(nullptr);
+        CHECK(plotly_plotter::tracing::get_tracer() == nullptr);
+        writer->flush();
+
+        CHECK_THAT(read_file(file_path),
+            Catch::Matchers::ContainsSubstring(R"("name":"scoped")"));
+    }
+}
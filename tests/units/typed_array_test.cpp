@@ -0,0 +1,65 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of typed_array_view class.
+ */
+#include "plotly_plotter/typed_array.h"
+
+#include <cstdint>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "plotly_plotter/json_document.h"
+#include "plotly_plotter/matrix_view.h"
+
+TEST_CASE("plotly_plotter::typed_array_view") {
+    using plotly_plotter::as_matrix;
+    using plotly_plotter::as_typed_array;
+    using plotly_plotter::json_document;
+    using plotly_plotter::storage_order;
+
+    json_document document;
+
+    SECTION("convert a vector") {
+        const std::vector<float> values{1.0F, -2.0F};
+
+        document.root() = as_typed_array(values);
+
+        CHECK(document.serialize_to_string() ==
+            R"({"dtype":"f4","bdata":"AACAPwAAAMA="})");
+    }
+
+    SECTION("convert a matrix") {
+        const std::vector<std::int16_t> buffer{1, 2, 3, 4, 5, 6};
+
+        document.root() = as_typed_array(as_matrix(buffer.data(), 2, 3));
+
+        CHECK(document.serialize_to_string() ==
+            R"({"dtype":"i2","bdata":"AQACAAMABAAFAAYA","shape":"2, 3"})");
+    }
+
+    SECTION("convert a matrix in column-major order") {
+        const std::vector<std::uint8_t> buffer{1, 4, 2, 5, 3, 6};
+
+        document.root() = as_typed_array(
+            as_matrix(buffer.data(), 2, 3, storage_order::column_major));
+
+        CHECK(document.serialize_to_string() ==
+            R"({"dtype":"u1","bdata":"AQIDBAUG","shape":"2, 3"})");
+    }
+}
@@ -2,27 +2,51 @@
 #include "config_test.cpp"       // NOLINT(bugprone-suspicious-include)
 #include "data_column_test.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "data_table_test.cpp"   // NOLINT(bugprone-suspicious-include)
+#include "details/compiled_template_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "details/compress_uniform_coordinates_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "details/encode_base64_test.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "details/escape_for_html_test.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "details/file_handle_test.cpp"   // NOLINT(bugprone-suspicious-include)
 #include "details/has_iterator_test.cpp"  // NOLINT(bugprone-suspicious-include)
-#include "eigen_test.cpp"                 // NOLINT(bugprone-suspicious-include)
-#include "figure_builders/box_test.cpp"   // NOLINT(bugprone-suspicious-include)
+#include "details/share_repeated_arrays_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "eigen_test.cpp"                // NOLINT(bugprone-suspicious-include)
+#include "figure_builders/bar_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "figure_builders/box_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "figure_builders/density_heatmap_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "figure_builders/details/box_statistics_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "figure_builders/details/downsample_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "figure_builders/details/group_aggregation_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "figure_builders/details/histogram_2d_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "figure_builders/details/kernel_density_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "figure_builders/details/quantile_test.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "figure_builders/figure_builder_base_test.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "figure_builders/line_test.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "figure_builders/scatter_test.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "figure_builders/violin_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "figure_prototype_test.cpp"    // NOLINT(bugprone-suspicious-include)
 #include "figure_test.cpp"              // NOLINT(bugprone-suspicious-include)
 #include "invert_color_scale_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "io/details/executable_check_cache_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "io/details/executable_version_cache_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "io/details/sha256_test.cpp"   // NOLINT(bugprone-suspicious-include)
+#include "io/export_executor_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "io/output_sink_test.cpp"      // NOLINT(bugprone-suspicious-include)
+#include "io/render_cache_test.cpp"     // NOLINT(bugprone-suspicious-include)
 #include "json_converter_test.cpp"      // NOLINT(bugprone-suspicious-include)
 #include "json_document_test.cpp"       // NOLINT(bugprone-suspicious-include)
 #include "json_value_test.cpp"          // NOLINT(bugprone-suspicious-include)
 #include "layout_test.cpp"              // NOLINT(bugprone-suspicious-include)
-#include "test_main.cpp"                // NOLINT(bugprone-suspicious-include)
-#include "to_string_test.cpp"           // NOLINT(bugprone-suspicious-include)
-#include "traces/box_test.cpp"          // NOLINT(bugprone-suspicious-include)
-#include "traces/heatmap_test.cpp"      // NOLINT(bugprone-suspicious-include)
-#include "traces/scatter_test.cpp"      // NOLINT(bugprone-suspicious-include)
-#include "traces/violin_test.cpp"       // NOLINT(bugprone-suspicious-include)
+#include "matrix_view_test.cpp"         // NOLINT(bugprone-suspicious-include)
+#include "metrics/metrics_registry_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "test_main.cpp"            // NOLINT(bugprone-suspicious-include)
+#include "to_string_test.cpp"       // NOLINT(bugprone-suspicious-include)
+#include "traces/box_test.cpp"      // NOLINT(bugprone-suspicious-include)
+#include "traces/heatmap_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "traces/scatter_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "traces/violin_test.cpp"   // NOLINT(bugprone-suspicious-include)
+#include "tracing/chrome_trace_writer_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "typed_array_test.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "utils/calculate_histogram_bin_width_test.cpp"  // NOLINT(bugprone-suspicious-include)
 #include "utils/percentile_calculator_test.cpp"  // NOLINT(bugprone-suspicious-include)
-#include "write_html_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "write_html_page_test.cpp"  // NOLINT(bugprone-suspicious-include)
+#include "write_html_test.cpp"       // NOLINT(bugprone-suspicious-include)
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2026 MusicScience37 (Kenta Kabashima)
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*!
+ * \file
+ * \brief Test of write_html_page function.
+ */
+#include "plotly_plotter/write_html_page.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ApprovalTests.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "plotly_plotter/figure.h"
+#include "plotly_plotter/traces/scatter.h"
+
+TEST_CASE("plotly_plotter::write_html_page") {
+    using plotly_plotter::write_html_page;
+
+    SECTION("write figures") {
+        std::vector<plotly_plotter::figure> figures;
+        for (int i = 1; i <= 2; ++i) {
+            plotly_plotter::figure figure;
+            auto scatter = figure.add_scatter();
+            scatter.name("trace" + std::to_string(i));
+            scatter.x(std::vector{1, 2, 3});
+            scatter.y(std::vector{4, 5, 6});  // NOLINT(*-magic-numbers)
+            figures.push_back(std::move(figure));
+        }
+
+        const std::string file_path = "write_html_page_test.html";
+        write_html_page(file_path, figures, "Test Page");
+
+        ApprovalTests::Approvals::verify(
+            ApprovalTests::FileUtils::readFileThrowIfMissing(file_path),
+            ApprovalTests::Options().fileOptions().withFileExtension(".html"));
+    }
+}
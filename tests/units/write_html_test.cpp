@@ -19,13 +19,19 @@
  */
 #include "plotly_plotter/write_html.h"
 
+#include <cstddef>
+#include <cstdio>
+#include <string>
 #include <string_view>
 #include <vector>
 
 #include <ApprovalTests.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include "plotly_plotter/details/escape_for_html.h"
 #include "plotly_plotter/figure.h"
+#include "plotly_plotter/io/output_sink.h"
+#include "plotly_plotter/json_document.h"
 #include "plotly_plotter/traces/scatter.h"
 
 TEST_CASE("plotly_plotter::write_html") {
@@ -46,4 +52,85 @@ TEST_CASE("plotly_plotter::write_html") {
             ApprovalTests::FileUtils::readFileThrowIfMissing(file_path),
             ApprovalTests::Options().fileOptions().withFileExtension(".html"));
     }
+
+    SECTION("write a figure to a sink") {
+        auto scatter = figure.add_scatter();
+        scatter.name("trace1");
+        scatter.x(std::vector{1, 2, 3});
+        scatter.y(std::vector{4, 5, 6});  // NOLINT(*-magic-numbers)
+
+        std::string buffer;
+        plotly_plotter::io::string_output_sink sink(buffer);
+        plotly_plotter::write_html_to(sink, figure);
+
+        const std::string file_path = "write_html_test_sink.html";
+        write_html(file_path, figure);
+        CHECK(buffer ==
+            ApprovalTests::FileUtils::readFileThrowIfMissing(file_path));
+    }
+
+    SECTION("write a frozen figure") {
+        auto scatter = figure.add_scatter();
+        scatter.name("trace1");
+        scatter.x(std::vector{1, 2, 3});
+        scatter.y(std::vector{4, 5, 6});  // NOLINT(*-magic-numbers)
+        const plotly_plotter::frozen_figure frozen = figure.freeze();
+
+        const std::string file_path = "write_html_test_frozen.html";
+        write_html(file_path, frozen);
+        std::string buffer;
+        plotly_plotter::io::string_output_sink sink(buffer);
+        plotly_plotter::write_html_to(sink, figure);
+
+        CHECK(buffer ==
+            ApprovalTests::FileUtils::readFileThrowIfMissing(file_path));
+    }
+    SECTION("write the script to restore shared arrays only when needed") {
+        // NOLINTNEXTLINE(*-magic-numbers)
+        const std::vector<int> x{1, 2, 3, 4, 5, 6, 7, 8};
+        figure.add_scatter().x(x);
+        figure.add_scatter().x(x);
+        constexpr std::string_view restore_script = "restoreSharedArrays";
+
+        std::string buffer;
+        plotly_plotter::io::string_output_sink sink(buffer);
+        plotly_plotter::write_html_to(sink, figure);
+        CHECK(buffer.find(restore_script) == std::string::npos);
+
+        constexpr std::size_t min_size = 2;
+        REQUIRE(figure.share_repeated_arrays(min_size) > 0);
+        std::string shared_buffer;
+        plotly_plotter::io::string_output_sink shared_sink(shared_buffer);
+        plotly_plotter::write_html_to(shared_sink, figure);
+        CHECK(shared_buffer.find(restore_script) != std::string::npos);
+
+        std::string frozen_buffer;
+        plotly_plotter::io::string_output_sink frozen_sink(frozen_buffer);
+        plotly_plotter::write_html_to(frozen_sink, figure.freeze());
+        CHECK(frozen_buffer == shared_buffer);
+    }
+
+    SECTION("write a figure created from a parsed file") {
+        const std::string json_file_path = "write_html_test_parsed.json";
+        const std::string json =
+            R"({"layout":{"title":{"text":"External"}},)"
+            R"("data":[{"y":[1,2,3]}]})";
+        std::FILE* file = std::fopen(json_file_path.c_str(), "w");
+        REQUIRE(file != nullptr);
+        (void)std::fwrite(json.data(), 1, json.size(), file);
+        (void)std::fclose(file);
+
+        const plotly_plotter::figure parsed_figure =
+            plotly_plotter::figure::from_document(
+                plotly_plotter::json_document::parse(json_file_path));
+        const plotly_plotter::figure copied_figure = parsed_figure.clone();
+        std::string buffer;
+        plotly_plotter::io::string_output_sink sink(buffer);
+        plotly_plotter::write_html_to(sink, copied_figure);
+
+        CHECK(buffer.find(plotly_plotter::details::escape_for_html(json)) !=
+            std::string::npos);
+        CHECK_FALSE(parsed_figure.document().is_mutable());
+        CHECK_FALSE(copied_figure.document().is_mutable());
+    }
 }